@@ -126,6 +126,9 @@ public:
     // clang-format off
      prm.enter_subsection("Application");
        prm.add_parameter("MeshType", mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+       prm.add_parameter("SingleIntegrator", single_integrator, "Use a single integrator for all components in the combined operator.");
+       prm.add_parameter("CellBasedFaceLoops", cell_based_face_loops, "Use cell-based face loops in the combined operator.");
+       prm.add_parameter("FusedStageUpdates", fused_stage_updates, "Fuse the Runge-Kutta stage updates with the inverse mass operator.");
      prm.leave_subsection();
     // clang-format on
   }
@@ -212,7 +215,10 @@ private:
     this->param.IP_factor = 1.0;
 
     // NUMERICAL PARAMETERS
-    this->param.use_combined_operator = true;
+    this->param.use_combined_operator                   = true;
+    this->param.use_combined_operator_single_integrator = single_integrator;
+    this->param.use_cell_based_face_loops               = cell_based_face_loops;
+    this->param.use_fused_stage_updates                 = fused_stage_updates;
   }
 
   void
@@ -307,6 +313,13 @@ private:
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
 
+  // variants of the combined operator
+  bool single_integrator     = false;
+  bool cell_based_face_loops = false;
+
+  // fuse the Runge-Kutta stage updates with the inverse mass operator
+  bool fused_stage_updates = false;
+
   double const start_time = 0.0;
   double const end_time   = 20.0 * CHARACTERISTIC_TIME;
 };
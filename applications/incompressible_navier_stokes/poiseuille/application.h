@@ -45,21 +45,26 @@ string_to_enum(BoundaryCondition & enum_type, std::string const string_type)
 }
 
 template<int dim>
-class AnalyticalSolutionVelocity : public dealii::Function<dim>
+class AnalyticalSolutionVelocity : public FunctionVectorized<dim>
 {
 public:
   AnalyticalSolutionVelocity(double const max_velocity, double const H)
-    : dealii::Function<dim>(dim, 0.0), max_velocity(max_velocity), H(H)
+    : FunctionVectorized<dim>(dim, 0.0), max_velocity(max_velocity), H(H)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   double const /*time*/,
+                   unsigned int const component = 0) const override
   {
-    double result = 0.0;
+    dealii::VectorizedArray<double> result = 0.0;
 
     if(component == 0)
-      result = -max_velocity * (pow(p[1] / (H / 2.), 2.0) - 1.0);
+    {
+      dealii::VectorizedArray<double> const y = p[1] / (H / 2.);
+      result                                  = -max_velocity * (y * y - 1.0);
+    }
 
     return result;
   }
@@ -45,6 +45,18 @@ string_to_enum(MeshType & enum_type, std::string const & string_type)
   // clang-format on
 }
 
+void
+string_to_enum(VariableCoefficientsStorage & enum_type, std::string const & string_type)
+{
+  // clang-format off
+  if     (string_type == "Full")             enum_type = VariableCoefficientsStorage::Full;
+  else if(string_type == "CellwiseConstant") enum_type = VariableCoefficientsStorage::CellwiseConstant;
+  else if(string_type == "Polynomial")       enum_type = VariableCoefficientsStorage::Polynomial;
+  else if(string_type == "ReducedPrecision") enum_type = VariableCoefficientsStorage::ReducedPrecision;
+  else AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  // clang-format on
+}
+
 template<int dim, typename Number>
 class Application : public ApplicationBase<dim, Number>
 {
@@ -62,6 +74,9 @@ public:
     // clang-format off
     prm.enter_subsection("Application");
       prm.add_parameter("MeshType",  mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("UseTurbulenceModel",     use_turbulence_model,     "Use turbulence model (variable viscosity).");
+      prm.add_parameter("ViscosityStorage",       viscosity_storage_string, "Storage of the variable viscosity.", dealii::Patterns::Selection("Full|CellwiseConstant|Polynomial|ReducedPrecision"));
+      prm.add_parameter("ViscosityStorageDegree", viscosity_storage_degree, "Polynomial degree of the variable viscosity for storage Polynomial.");
     prm.leave_subsection();
     // clang-format on
   }
@@ -73,6 +88,7 @@ private:
     ApplicationBase<dim, Number>::parse_parameters();
 
     string_to_enum(mesh_type, mesh_type_string);
+    string_to_enum(viscosity_storage, viscosity_storage_string);
   }
 
   void
@@ -125,7 +141,7 @@ private:
     this->param.apply_penalty_terms_in_postprocessing_step = true;
 
     // TURBULENCE
-    this->param.use_turbulence_model = false;
+    this->param.use_turbulence_model = use_turbulence_model;
     this->param.turbulence_model     = TurbulenceEddyViscosityModel::Sigma;
     // Smagorinsky: 0.165
     // Vreman: 0.28
@@ -133,6 +149,9 @@ private:
     // Sigma: 1.35
     this->param.turbulence_model_constant = 1.35;
 
+    this->param.turbulence_model_viscosity_storage        = viscosity_storage;
+    this->param.turbulence_model_viscosity_storage_degree = viscosity_storage_degree;
+
     // PROJECTION METHODS
 
     // pressure Poisson equation
@@ -233,6 +252,11 @@ private:
 
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
+
+  bool                        use_turbulence_model     = false;
+  std::string                 viscosity_storage_string = "Full";
+  VariableCoefficientsStorage viscosity_storage        = VariableCoefficientsStorage::Full;
+  unsigned int                viscosity_storage_degree = 1;
 };
 
 } // namespace IncNS
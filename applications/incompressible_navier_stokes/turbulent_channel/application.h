@@ -210,8 +210,10 @@ public:
     Base::setup(pde_operator);
 
     // perform setup of turbulent channel related things
-    statistics_turb_ch.reset(new StatisticsManager<dim, Number>(pde_operator.get_dof_handler_u(),
-                                                                *pde_operator.get_mapping()));
+    statistics_turb_ch.reset(
+      new StatisticsManager<dim, Number>(pde_operator.get_matrix_free(),
+                                         pde_operator.get_dof_index_velocity(),
+                                         *pde_operator.get_mapping()));
 
     statistics_turb_ch->setup(&grid_transform_y, turb_ch_data);
   }
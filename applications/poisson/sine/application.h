@@ -22,6 +22,7 @@
 #ifndef APPLICATIONS_POISSON_TEST_CASES_SINE_H_
 #define APPLICATIONS_POISSON_TEST_CASES_SINE_H_
 
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/grid/deformed_cube_manifold.h>
 
 namespace ExaDG
@@ -78,18 +79,20 @@ public:
 
 
 template<int dim>
-class RightHandSide : public dealii::Function<dim>
+class RightHandSide : public FunctionVectorized<dim>
 {
 public:
   RightHandSide(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : FunctionVectorized<dim>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /* component */) const
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   double const /* time */,
+                   unsigned int const /* component */) const override
   {
-    double result = FREQUENCY * FREQUENCY * dim;
+    dealii::VectorizedArray<double> result = FREQUENCY * FREQUENCY * dim;
     for(unsigned int d = 0; d < dim; ++d)
       result *= std::sin(FREQUENCY * p[d]);
 
@@ -22,6 +22,8 @@
 #ifndef APPLICATIONS_STRUCTURE_MANUFACTURED_APPLICATION_H_
 #define APPLICATIONS_STRUCTURE_MANUFACTURED_APPLICATION_H_
 
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
+
 /*
  * Manufactured solution for nonlinear elasticity problem with St. Venant-Kirchhoff
  * material. The test case can be used in both 2d (plane strain!) and 3d, as well as for testing
@@ -116,10 +118,11 @@ time_2nd_derivative(double const time, double const frequency)
   return time_factor;
 }
 
-double
-space_function(double const x, double const length, double const max_displacement)
+template<typename Number>
+Number
+space_function(Number const & x, double const length, double const max_displacement)
 {
-  double space_factor = 1.0;
+  Number space_factor = 1.0;
 
   if(function_type_space == FunctionTypeSpace::Linear)
     space_factor = max_displacement * x / length;
@@ -133,10 +136,11 @@ space_function(double const x, double const length, double const max_displacemen
   return space_factor;
 }
 
-double
-space_derivative(double const x, double const length, double const max_displacement)
+template<typename Number>
+Number
+space_derivative(Number const & x, double const length, double const max_displacement)
 {
-  double space_factor = 1.0;
+  Number space_factor = 1.0;
 
   if(function_type_space == FunctionTypeSpace::Linear)
     space_factor = max_displacement / length;
@@ -151,10 +155,11 @@ space_derivative(double const x, double const length, double const max_displacem
   return space_factor;
 }
 
-double
-space_2nd_derivative(double const x, double const length, double const max_displacement)
+template<typename Number>
+Number
+space_2nd_derivative(Number const & x, double const length, double const max_displacement)
 {
-  double space_factor = 1.0;
+  Number space_factor = 1.0;
 
   if(function_type_space == FunctionTypeSpace::Linear)
     space_factor = 0.0;
@@ -243,7 +248,7 @@ private:
 };
 
 template<int dim>
-class VolumeForce : public dealii::Function<dim>
+class VolumeForce : public FunctionVectorized<dim>
 {
 public:
   VolumeForce(double const max_displacement,
@@ -252,7 +257,7 @@ public:
               bool const   unsteady,
               double const frequency,
               double const f0)
-    : dealii::Function<dim>(dim),
+    : FunctionVectorized<dim>(dim),
       max_displacement(max_displacement),
       length(length),
       density(density),
@@ -262,28 +267,30 @@ public:
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const c) const
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   double const                                                time,
+                   unsigned int const                                          c = 0) const override
   {
+    dealii::VectorizedArray<double> result = 0.0;
+
     if(c == 0)
     {
-      double const time_2nd    = time_2nd_derivative(this->get_time(), frequency);
-      double const time_factor = time_function(this->get_time(), frequency);
+      double const time_2nd    = time_2nd_derivative(time, frequency);
+      double const time_factor = time_function(time, frequency);
 
-      double const acceleration_term =
+      dealii::VectorizedArray<double> const acceleration_term =
         density * space_function(p[0], length, max_displacement) * (unsteady ? time_2nd : 0.0);
-      double const elasticity_term =
-        f0 / 2.0 *
-        (3.0 * std::pow(1.0 + (unsteady ? time_factor : 1.0) *
-                                space_derivative(p[0], length, max_displacement),
-                        2.0) -
-         1.0) *
-        (unsteady ? time_factor : 1.0) * space_2nd_derivative(p[0], length, max_displacement);
-
-      return (acceleration_term - elasticity_term);
+      dealii::VectorizedArray<double> const deformation =
+        1.0 + (unsteady ? time_factor : 1.0) * space_derivative(p[0], length, max_displacement);
+      dealii::VectorizedArray<double> const elasticity_term =
+        f0 / 2.0 * (3.0 * deformation * deformation - 1.0) * (unsteady ? time_factor : 1.0) *
+        space_2nd_derivative(p[0], length, max_displacement);
+
+      result = acceleration_term - elasticity_term;
     }
-    else
-      return 0.0;
+
+    return result;
   }
 
 private:
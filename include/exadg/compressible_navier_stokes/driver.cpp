@@ -71,6 +71,9 @@ Driver<dim, Number>::setup()
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
+  if(application->get_parameters().use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
+                                        matrix_free_data->data);
   matrix_free->reinit(*application->get_grid()->mapping,
                       matrix_free_data->get_dof_handler_vector(),
                       matrix_free_data->get_constraint_vector(),
@@ -89,6 +92,8 @@ Driver<dim, Number>::setup()
     // initialize time integrator
     time_integrator = std::make_shared<TimeIntExplRK<Number>>(
       pde_operator, application->get_parameters(), mpi_comm, is_test, postprocessor);
+    time_integrator->set_dof_numbering_checksum(
+      compute_dof_numbering_checksum(pde_operator->get_dof_handler()));
     time_integrator->setup(application->get_parameters().restarted_simulation);
   }
 
@@ -124,6 +129,16 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  // multirate time integration: wall times of the rate levels, number of cells per level and
+  // speedup compared to global time stepping
+  if(application->get_parameters().n_rate_levels > 1)
+  {
+    pcout << std::endl << "Timings for level 3:" << std::endl;
+    timer_tree.print_level(pcout, 3);
+
+    time_integrator->print_rate_level_statistics();
+  }
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -163,6 +178,26 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   src = 1.0;
   dst = 1.0;
 
+  // Runge-Kutta stages are measured by means of entire time steps of the low-storage scheme
+  // ExplRK3Stage7Reg2, with and without fusing the stage updates with the operator
+  // evaluation. The throughput is reported per stage.
+  typedef ExplicitTimeIntegrator<Operator<dim, Number>, VectorType> TimeIntegrator;
+
+  unsigned int const n_stages       = 7;
+  double const       time_step_size = 1.e-3;
+
+  std::shared_ptr<TimeIntegrator> rk_time_integrator;
+  if(operator_type == OperatorType::RungeKuttaStage)
+  {
+    rk_time_integrator = std::make_shared<LowStorageRKTD<Operator<dim, Number>, VectorType>>(
+      pde_operator, 3, n_stages);
+  }
+  else if(operator_type == OperatorType::RungeKuttaStageFused)
+  {
+    rk_time_integrator = std::make_shared<LowStorageRKTDFused<Operator<dim, Number>, VectorType>>(
+      pde_operator, 3, n_stages);
+  }
+
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::ConvectiveTerm)
       pde_operator->evaluate_convective(dst, src, 0.0);
@@ -178,6 +213,9 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
       dst.sadd(2.0, 1.0, src);
     else if(operator_type == OperatorType::EvaluateOperatorExplicit)
       pde_operator->evaluate(dst, src, 0.0);
+    else if(operator_type == OperatorType::RungeKuttaStage ||
+            operator_type == OperatorType::RungeKuttaStageFused)
+      rk_time_integrator->solve_timestep(dst, src, 0.0, time_step_size);
     else
       AssertThrow(false, dealii::ExcMessage("Specified operator type not implemented"));
   };
@@ -192,7 +230,9 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   // calculate throughput
   dealii::types::global_dof_index const dofs = pde_operator->get_number_of_dofs();
 
-  double const throughput = (double)dofs / wall_time;
+  double throughput = (double)dofs / wall_time;
+  if(rk_time_integrator)
+    throughput *= (double)n_stages;
 
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
@@ -68,8 +68,12 @@ PostProcessor<dim, Number>::setup(Operator<dim, Number> const & pde_operator)
                                  pde_operator.get_quad_index_standard(),
                                  pp_data.lift_and_drag_data);
 
+  point_evaluator = std::make_shared<PointEvaluator<dim>>(mpi_comm);
+  point_evaluator->reinit(pde_operator.get_mapping(),
+                          pde_operator.get_dof_handler_scalar().get_triangulation());
+
   pressure_difference_calculator.setup(pde_operator.get_dof_handler_scalar(),
-                                       pde_operator.get_mapping(),
+                                       point_evaluator,
                                        pp_data.pressure_difference_data);
 
   kinetic_energy_calculator.setup(pde_operator.get_matrix_free(),
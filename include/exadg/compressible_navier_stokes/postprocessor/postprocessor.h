@@ -28,6 +28,7 @@
 #include <exadg/postprocessor/kinetic_energy_calculation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
+#include <exadg/postprocessor/point_evaluator.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 
 namespace ExaDG
@@ -93,6 +94,8 @@ private:
 
   dealii::SmartPointer<Operator<dim, Number> const> navier_stokes_operator;
 
+  std::shared_ptr<PointEvaluator<dim>> point_evaluator;
+
   OutputGenerator<dim, Number>                 output_generator;
   ErrorCalculator<dim, Number>                 error_calculator;
   LiftAndDragCalculator<dim, Number>           lift_and_drag_calculator;
@@ -22,6 +22,11 @@
 #ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// C/C++
+#include <functional>
+#include <vector>
+
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 namespace ExaDG
@@ -36,6 +41,8 @@ class Operator
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
+  typedef std::function<void(unsigned int const, unsigned int const)> VectorUpdate;
+
   Operator()
   {
   }
@@ -64,6 +71,49 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // explicit time integration: evaluate operator and perform vector updates depending on
+  // dst within the same sweep over the data. The function vector_update is called for
+  // ranges of locally owned indices of dst once the final values of dst are available.
+  virtual void
+  evaluate_fused(VectorType &         dst,
+                 VectorType const &   src,
+                 Number const         evaluation_time,
+                 VectorUpdate const & vector_update) const = 0;
+
+  // multirate time integration: calculates the admissible time step size of each locally owned
+  // cell according to the local CFL condition (if cfl > 0) and the diffusion number (if
+  // diffusion_number > 0). Cells are numbered as cell_batch * n_lanes + lane of
+  // dealii::MatrixFree, and the entries of lanes not filled with cells are negative.
+  virtual void
+  calculate_time_step_cells(std::vector<double> & time_step,
+                            VectorType const &    solution,
+                            double const          cfl,
+                            double const          diffusion_number) const = 0;
+
+  // multirate time integration: sets the rate level of each cell (numbered as above, level 0
+  // being the finest level). The entries of lanes not filled with cells are ignored.
+  virtual void
+  set_rate_levels(std::vector<unsigned int> const & cell_levels) = 0;
+
+  // multirate time integration: fills a dof vector with the rate level of each dof
+  virtual void
+  fill_dof_vector_rate_levels(VectorType & dst) const = 0;
+
+  // multirate time integration: extracts the rate level of each cell (numbered as above) from a
+  // dof vector filled by fill_dof_vector_rate_levels(), e.g. read from restart files. The entries
+  // of lanes not filled with cells are set to dealii::numbers::invalid_unsigned_int.
+  virtual void
+  extract_rate_levels(std::vector<unsigned int> & cell_levels,
+                      VectorType const &          dof_vector) const = 0;
+
+  // multirate time integration: same as evaluate(), but only includes the integrals over the cells
+  // of the given rate level and over the faces whose finer adjacent cell belongs to this level
+  virtual void
+  evaluate_rate_level(VectorType &       dst,
+                      VectorType const & src,
+                      Number const       evaluation_time,
+                      unsigned int const level) const = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
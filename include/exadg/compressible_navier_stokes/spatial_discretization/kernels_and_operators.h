@@ -162,7 +162,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
   if(boundary_type == BoundaryType::Dirichlet)
   {
-    auto bc = boundary_descriptor.dirichlet_bc.find(boundary_id)->second;
+    auto bc = boundary_descriptor.dirichlet_bc_vectorized.find(boundary_id)->second;
     auto g  = FunctionEvaluator<rank, dim, Number>::value(bc, q_point, time);
 
     value_p = -value_m + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * g);
@@ -203,7 +203,7 @@ inline DEAL_II_ALWAYS_INLINE //
   }
   else if(boundary_type == BoundaryType::Neumann)
   {
-    auto bc = boundary_descriptor.neumann_bc.find(boundary_id)->second;
+    auto bc = boundary_descriptor.neumann_bc_vectorized.find(boundary_id)->second;
     auto h  = FunctionEvaluator<rank, dim, Number>::value(bc, q_point, time);
 
     grad_P_normal =
@@ -281,6 +281,241 @@ inline DEAL_II_ALWAYS_INLINE //
   return std::max(lambda_m, lambda_p);
 }
 
+/*
+ * Values and gradients of the conserved variables (density, momentum, energy) in a quadrature
+ * point. The convective and viscous kernels are formulated in terms of these point-wise quantities
+ * so that they can be used with separate integrators for density, momentum and energy as well as
+ * with a single integrator for all dim + 2 components.
+ */
+template<int dim, typename Number>
+struct ConservedVariables
+{
+  dealii::VectorizedArray<Number>                         rho;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> rho_u;
+  dealii::VectorizedArray<Number>                         rho_E;
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> grad_rho;
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> grad_rho_u;
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> grad_rho_E;
+};
+
+template<int dim, typename Number, typename IntegratorScalar, typename IntegratorVector>
+inline DEAL_II_ALWAYS_INLINE //
+  ConservedVariables<dim, Number>
+  get_conserved_variables(IntegratorScalar const &                       density,
+                          IntegratorVector const &                       momentum,
+                          IntegratorScalar const &                       energy,
+                          unsigned int const                             q,
+                          dealii::EvaluationFlags::EvaluationFlags const flags)
+{
+  ConservedVariables<dim, Number> w;
+
+  if(flags & dealii::EvaluationFlags::values)
+  {
+    w.rho   = density.get_value(q);
+    w.rho_u = momentum.get_value(q);
+    w.rho_E = energy.get_value(q);
+  }
+
+  if(flags & dealii::EvaluationFlags::gradients)
+  {
+    w.grad_rho   = density.get_gradient(q);
+    w.grad_rho_u = momentum.get_gradient(q);
+    w.grad_rho_E = energy.get_gradient(q);
+  }
+
+  return w;
+}
+
+/*
+ * Same as above for a single integrator with dim + 2 components, where component 0 is the density,
+ * components 1, ..., dim the momentum, and component dim + 1 the energy.
+ */
+template<int dim, typename Number, typename Integrator>
+inline DEAL_II_ALWAYS_INLINE //
+  ConservedVariables<dim, Number>
+  get_conserved_variables(Integrator const &                             integrator,
+                          unsigned int const                             q,
+                          dealii::EvaluationFlags::EvaluationFlags const flags)
+{
+  static_assert(Integrator::n_components == dim + 2,
+                "Integrator has to provide all dim + 2 conserved variables.");
+
+  ConservedVariables<dim, Number> w;
+
+  if(flags & dealii::EvaluationFlags::values)
+  {
+    auto const value = integrator.get_value(q);
+
+    w.rho = value[0];
+    for(unsigned int d = 0; d < dim; ++d)
+      w.rho_u[d] = value[1 + d];
+    w.rho_E = value[1 + dim];
+  }
+
+  if(flags & dealii::EvaluationFlags::gradients)
+  {
+    auto const gradient = integrator.get_gradient(q);
+
+    w.grad_rho = gradient[0];
+    for(unsigned int d = 0; d < dim; ++d)
+      w.grad_rho_u[d] = gradient[1 + d];
+    w.grad_rho_E = gradient[1 + dim];
+  }
+
+  return w;
+}
+
+/*
+ * Combines values of density, momentum and energy into a value to be submitted to an integrator
+ * with dim + 2 components.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<1, dim + 2, dealii::VectorizedArray<Number>>
+  make_conserved_value(dealii::VectorizedArray<Number> const &                         rho,
+                       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_u,
+                       dealii::VectorizedArray<Number> const &                         rho_E)
+{
+  dealii::Tensor<1, dim + 2, dealii::VectorizedArray<Number>> value;
+
+  value[0] = rho;
+  for(unsigned int d = 0; d < dim; ++d)
+    value[1 + d] = rho_u[d];
+  value[1 + dim] = rho_E;
+
+  return value;
+}
+
+/*
+ * Combines gradients (or fluxes) of density, momentum and energy into a gradient to be submitted to
+ * an integrator with dim + 2 components.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<1, dim + 2, dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>>
+  make_conserved_gradient(dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho,
+                          dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & rho_u,
+                          dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_E)
+{
+  dealii::Tensor<1, dim + 2, dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>> gradient;
+
+  gradient[0] = rho;
+  for(unsigned int d = 0; d < dim; ++d)
+    gradient[1 + d] = rho_u[d];
+  gradient[1 + dim] = rho_E;
+
+  return gradient;
+}
+
+/*
+ * Multirate time integration: the rate levels of cells and faces are stored per lane of the cell
+ * and face batches of dealii::MatrixFree, i.e., at index batch * n_lanes + lane, where lanes that
+ * are not filled get an invalid level. The levels are read from a dof vector containing the rate
+ * level of each dof (of the first component).
+ */
+template<int dim, typename Number>
+inline void
+read_cell_rate_levels(std::vector<unsigned int> &                                cell_levels,
+                      dealii::MatrixFree<dim, Number> const &                    matrix_free,
+                      unsigned int const                                         dof_index,
+                      unsigned int const                                         quad_index,
+                      dealii::LinearAlgebra::distributed::Vector<Number> const & dof_levels)
+{
+  unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+  CellIntegrator<dim, 1, Number> integrator(matrix_free, dof_index, quad_index);
+
+  cell_levels.assign(matrix_free.n_cell_batches() * n_lanes, dealii::numbers::invalid_unsigned_int);
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(dof_levels);
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      cell_levels[cell * n_lanes + v] =
+        static_cast<unsigned int>(integrator.begin_dof_values()[0][v]);
+  }
+}
+
+/*
+ * The level of a face is the level of the finer one of the two adjacent cells, which requires the
+ * ghost values of dof_levels to be up to date.
+ */
+template<int dim, typename Number>
+inline void
+read_face_rate_levels(std::vector<unsigned int> &                                face_levels,
+                      dealii::MatrixFree<dim, Number> const &                    matrix_free,
+                      unsigned int const                                         dof_index,
+                      unsigned int const                                         quad_index,
+                      dealii::LinearAlgebra::distributed::Vector<Number> const & dof_levels)
+{
+  unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+  FaceIntegrator<dim, 1, Number> integrator_m(matrix_free, true, dof_index, quad_index);
+  FaceIntegrator<dim, 1, Number> integrator_p(matrix_free, false, dof_index, quad_index);
+
+  unsigned int const n_face_batches =
+    matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+
+  face_levels.assign(n_face_batches * n_lanes, dealii::numbers::invalid_unsigned_int);
+
+  for(unsigned int face = 0; face < n_face_batches; ++face)
+  {
+    bool const interior_face = (face < matrix_free.n_inner_face_batches());
+
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(dof_levels);
+
+    if(interior_face)
+    {
+      integrator_p.reinit(face);
+      integrator_p.read_dof_values(dof_levels);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      unsigned int level = static_cast<unsigned int>(integrator_m.begin_dof_values()[0][v]);
+
+      if(interior_face)
+        level = std::min(level, static_cast<unsigned int>(integrator_p.begin_dof_values()[0][v]));
+
+      face_levels[face * n_lanes + v] = level;
+    }
+  }
+}
+
+/*
+ * Returns true if at least one lane of a batch belongs to the given rate level.
+ */
+template<typename Number>
+inline bool
+batch_has_rate_level(unsigned int const * levels, unsigned int const level)
+{
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    if(levels[v] == level)
+      return true;
+
+  return false;
+}
+
+/*
+ * Sets the (integrated) dof values of all lanes of a batch that do not belong to the given rate
+ * level to zero, so that only the contributions of this level are written to the global vector.
+ */
+template<typename Number, typename Integrator>
+inline void
+restrict_to_rate_level(Integrator &         integrator,
+                       unsigned int const * levels,
+                       unsigned int const   level)
+{
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    if(levels[v] != level)
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        integrator.begin_dof_values()[i][v] = 0.0;
+}
+
 template<int dim>
 struct BodyForceOperatorData
 {
@@ -312,7 +547,7 @@ public:
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0)
+  BodyForceOperator() : matrix_free(nullptr), eval_time(0.0), rate_level(0)
   {
   }
 
@@ -322,6 +557,10 @@ public:
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
+
+    rhs_rho = make_function_vectorized(data.rhs_rho);
+    rhs_u   = make_function_vectorized(data.rhs_u);
+    rhs_E   = make_function_vectorized(data.rhs_E);
   }
 
   void
@@ -339,6 +578,31 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Multirate time integration: sets the rate levels of the cells, see read_cell_rate_levels().
+   */
+  void
+  set_rate_levels(VectorType const & dof_levels)
+  {
+    read_cell_rate_levels(cell_levels, *matrix_free, data.dof_index, data.quad_index, dof_levels);
+  }
+
+  /*
+   * Multirate time integration: same as evaluate_add(), but only for the cells of the given rate
+   * level.
+   */
+  void
+  evaluate_add_rate_level(VectorType &       dst,
+                          VectorType const & src,
+                          double const       evaluation_time,
+                          unsigned int const level) const
+  {
+    this->eval_time  = evaluation_time;
+    this->rate_level = level;
+
+    matrix_free->cell_loop(&This::cell_loop_rate_level, this, dst, src);
+  }
+
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<scalar, vector, scalar>
     get_volume_flux(CellIntegratorScalar & density,
@@ -349,10 +613,9 @@ public:
     scalar rho      = density.get_value(q);
     vector u        = momentum.get_value(q) / rho;
 
-    scalar rhs_density =
-      FunctionEvaluator<0, dim, Number>::value(data.rhs_rho, q_points, eval_time);
-    vector rhs_momentum = FunctionEvaluator<1, dim, Number>::value(data.rhs_u, q_points, eval_time);
-    scalar rhs_energy   = FunctionEvaluator<0, dim, Number>::value(data.rhs_E, q_points, eval_time);
+    scalar rhs_density  = FunctionEvaluator<0, dim, Number>::value(rhs_rho, q_points, eval_time);
+    vector rhs_momentum = FunctionEvaluator<1, dim, Number>::value(rhs_u, q_points, eval_time);
+    scalar rhs_energy   = FunctionEvaluator<0, dim, Number>::value(rhs_E, q_points, eval_time);
 
     return std::make_tuple(rhs_density, rhs_momentum, rhs_momentum * u + rhs_energy);
   }
@@ -378,14 +641,7 @@ private:
 
       energy.reinit(cell);
 
-      for(unsigned int q = 0; q < density.n_q_points; ++q)
-      {
-        std::tuple<scalar, vector, scalar> flux = get_volume_flux(density, momentum, q);
-
-        density.submit_value(std::get<0>(flux), q);
-        momentum.submit_value(std::get<1>(flux), q);
-        energy.submit_value(std::get<2>(flux), q);
-      }
+      do_cell_integral(density, momentum, energy);
 
       density.integrate_scatter(dealii::EvaluationFlags::values, dst);
       momentum.integrate_scatter(dealii::EvaluationFlags::values, dst);
@@ -393,11 +649,75 @@ private:
     }
   }
 
+  void
+  cell_loop_rate_level(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                       VectorType &                                  dst,
+                       VectorType const &                            src,
+                       std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      unsigned int const * levels = &cell_levels[cell * scalar::size()];
+
+      if(not batch_has_rate_level<Number>(levels, rate_level))
+        continue;
+
+      density.reinit(cell);
+      density.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      momentum.reinit(cell);
+      momentum.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      energy.reinit(cell);
+
+      do_cell_integral(density, momentum, energy);
+
+      density.integrate(dealii::EvaluationFlags::values);
+      momentum.integrate(dealii::EvaluationFlags::values);
+      energy.integrate(dealii::EvaluationFlags::values);
+
+      restrict_to_rate_level<Number>(density, levels, rate_level);
+      restrict_to_rate_level<Number>(momentum, levels, rate_level);
+      restrict_to_rate_level<Number>(energy, levels, rate_level);
+
+      density.distribute_local_to_global(dst);
+      momentum.distribute_local_to_global(dst);
+      energy.distribute_local_to_global(dst);
+    }
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    void
+    do_cell_integral(CellIntegratorScalar & density,
+                     CellIntegratorVector & momentum,
+                     CellIntegratorScalar & energy) const
+  {
+    for(unsigned int q = 0; q < density.n_q_points; ++q)
+    {
+      std::tuple<scalar, vector, scalar> flux = get_volume_flux(density, momentum, q);
+
+      density.submit_value(std::get<0>(flux), q);
+      momentum.submit_value(std::get<1>(flux), q);
+      energy.submit_value(std::get<2>(flux), q);
+    }
+  }
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   BodyForceOperatorData<dim> data;
 
+  // vectorized representation of the functions in data, resolved once in initialize()
+  std::shared_ptr<FunctionVectorized<dim>> rhs_rho, rhs_u, rhs_E;
+
   double mutable eval_time;
+
+  // multirate time integration
+  std::vector<unsigned int> cell_levels;
+  unsigned int mutable rate_level;
 };
 
 struct MassOperatorData
@@ -566,9 +886,17 @@ public:
                     CellIntegratorScalar & energy,
                     unsigned int const     q) const
   {
-    scalar rho_inv = 1.0 / density.get_value(q);
-    vector rho_u   = momentum.get_value(q);
-    scalar rho_E   = energy.get_value(q);
+    return get_volume_flux(get_conserved_variables<dim, Number>(
+      density, momentum, energy, q, dealii::EvaluationFlags::values));
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<vector, tensor, vector>
+    get_volume_flux(ConservedVariables<dim, Number> const & w) const
+  {
+    scalar rho_inv = 1.0 / w.rho;
+    vector rho_u   = w.rho_u;
+    scalar rho_E   = w.rho_E;
     vector u       = rho_inv * rho_u;
     scalar p       = calculate_pressure(rho_u, u, rho_E, gamma);
 
@@ -591,17 +919,28 @@ public:
              FaceIntegratorScalar & energy_p,
              unsigned int const     q) const
   {
-    vector normal = momentum_m.get_normal_vector(q);
+    return get_flux(get_conserved_variables<dim, Number>(
+                      density_m, momentum_m, energy_m, q, dealii::EvaluationFlags::values),
+                    get_conserved_variables<dim, Number>(
+                      density_p, momentum_p, energy_p, q, dealii::EvaluationFlags::values),
+                    momentum_m.get_normal_vector(q));
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_flux(ConservedVariables<dim, Number> const & w_m,
+             ConservedVariables<dim, Number> const & w_p,
+             vector const &                          normal) const
+  {
     // get values
-    scalar rho_M   = density_m.get_value(q);
-    scalar rho_P   = density_p.get_value(q);
-    vector rho_u_M = momentum_m.get_value(q);
-    vector rho_u_P = momentum_p.get_value(q);
+    scalar rho_M   = w_m.rho;
+    scalar rho_P   = w_p.rho;
+    vector rho_u_M = w_m.rho_u;
+    vector rho_u_P = w_p.rho_u;
     vector u_M     = rho_u_M / rho_M;
     vector u_P     = rho_u_P / rho_P;
-    scalar rho_E_M = energy_m.get_value(q);
-    scalar rho_E_P = energy_p.get_value(q);
+    scalar rho_E_M = w_m.rho_E;
+    scalar rho_E_P = w_p.rho_E;
 
     // calculate pressure
     scalar p_M = calculate_pressure(rho_u_M, u_M, rho_E_M, gamma);
@@ -648,13 +987,35 @@ public:
                       dealii::types::boundary_id const & boundary_id,
                       unsigned int const                 q) const
   {
-    vector normal = momentum.get_normal_vector(q);
+    return get_flux_boundary(get_conserved_variables<dim, Number>(
+                               density, momentum, energy, q, dealii::EvaluationFlags::values),
+                             momentum.get_normal_vector(q),
+                             momentum.quadrature_point(q),
+                             boundary_type_density,
+                             boundary_type_velocity,
+                             boundary_type_pressure,
+                             boundary_type_energy,
+                             boundary_variable,
+                             boundary_id);
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_flux_boundary(ConservedVariables<dim, Number> const & w_m,
+                      vector const &                          normal,
+                      point const &                           q_point,
+                      BoundaryType const &                    boundary_type_density,
+                      BoundaryType const &                    boundary_type_velocity,
+                      BoundaryType const &                    boundary_type_pressure,
+                      BoundaryType const &                    boundary_type_energy,
+                      EnergyBoundaryVariable const &          boundary_variable,
+                      dealii::types::boundary_id const &      boundary_id) const
+  {
     // element e⁻
-    scalar rho_M   = density.get_value(q);
-    vector rho_u_M = momentum.get_value(q);
+    scalar rho_M   = w_m.rho;
+    vector rho_u_M = w_m.rho_u;
     vector u_M     = rho_u_M / rho_M;
-    scalar rho_E_M = energy.get_value(q);
+    scalar rho_E_M = w_m.rho_E;
     scalar E_M     = rho_E_M / rho_M;
     scalar p_M     = calculate_pressure(rho_M, u_M, E_M, gamma);
 
@@ -665,7 +1026,7 @@ public:
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
     // calculate u_P
@@ -673,7 +1034,7 @@ public:
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          q_point,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
@@ -683,7 +1044,7 @@ public:
                                                           boundary_type_pressure,
                                                           data.bc->pressure,
                                                           boundary_id,
-                                                          density.quadrature_point(q),
+                                                          q_point,
                                                           this->eval_time);
 
     // calculate E_P
@@ -694,7 +1055,7 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     q_point,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -704,7 +1065,7 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
@@ -1008,9 +1369,10 @@ public:
     eval_time = evaluation_time;
   }
 
+  template<typename Integrator>
   inline DEAL_II_ALWAYS_INLINE //
     scalar
-    get_penalty_parameter(FaceIntegratorScalar & fe_eval_m, FaceIntegratorScalar & fe_eval_p) const
+    get_penalty_parameter(Integrator & fe_eval_m, Integrator & fe_eval_p) const
   {
     scalar tau = std::max(fe_eval_m.read_cell_data(array_penalty_parameter),
                           fe_eval_p.read_cell_data(array_penalty_parameter)) *
@@ -1019,9 +1381,10 @@ public:
     return tau;
   }
 
+  template<typename Integrator>
   inline DEAL_II_ALWAYS_INLINE //
     scalar
-    get_penalty_parameter(FaceIntegratorScalar & fe_eval) const
+    get_penalty_parameter(Integrator & fe_eval) const
   {
     scalar tau = fe_eval.read_cell_data(array_penalty_parameter) *
                  IP::get_penalty_factor<Number>(degree, data.IP_factor) * nu;
@@ -1036,15 +1399,27 @@ public:
                     CellIntegratorScalar & energy,
                     unsigned int const     q) const
   {
-    scalar rho_inv  = 1.0 / density.get_value(q);
-    vector grad_rho = density.get_gradient(q);
+    return get_volume_flux(get_conserved_variables<dim, Number>(
+      density,
+      momentum,
+      energy,
+      q,
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients));
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<vector, tensor, vector>
+    get_volume_flux(ConservedVariables<dim, Number> const & w) const
+  {
+    scalar rho_inv  = 1.0 / w.rho;
+    vector grad_rho = w.grad_rho;
 
-    vector rho_u      = momentum.get_value(q);
+    vector rho_u      = w.rho_u;
     vector u          = rho_inv * rho_u;
-    tensor grad_rho_u = momentum.get_gradient(q);
+    tensor grad_rho_u = w.grad_rho_u;
 
-    scalar rho_E      = energy.get_value(q);
-    vector grad_rho_E = energy.get_gradient(q);
+    scalar rho_E      = w.rho_E;
+    vector grad_rho_E = w.grad_rho_E;
 
     // calculate flux momentum
     tensor grad_u = calculate_grad_u(rho_inv, rho_u, grad_rho, grad_rho_u);
@@ -1069,28 +1444,43 @@ public:
                       scalar const &         tau_IP,
                       unsigned int const     q) const
   {
-    vector normal = momentum_m.get_normal_vector(q);
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    return get_gradient_flux(
+      get_conserved_variables<dim, Number>(density_m, momentum_m, energy_m, q, flags),
+      get_conserved_variables<dim, Number>(density_p, momentum_p, energy_p, q, flags),
+      momentum_m.get_normal_vector(q),
+      tau_IP);
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_gradient_flux(ConservedVariables<dim, Number> const & w_m,
+                      ConservedVariables<dim, Number> const & w_p,
+                      vector const &                          normal,
+                      scalar const &                          tau_IP) const
+  {
     // density
-    scalar rho_M      = density_m.get_value(q);
-    vector grad_rho_M = density_m.get_gradient(q);
+    scalar rho_M      = w_m.rho;
+    vector grad_rho_M = w_m.grad_rho;
 
-    scalar rho_P      = density_p.get_value(q);
-    vector grad_rho_P = density_p.get_gradient(q);
+    scalar rho_P      = w_p.rho;
+    vector grad_rho_P = w_p.grad_rho;
 
     // velocity
-    vector rho_u_M      = momentum_m.get_value(q);
-    tensor grad_rho_u_M = momentum_m.get_gradient(q);
+    vector rho_u_M      = w_m.rho_u;
+    tensor grad_rho_u_M = w_m.grad_rho_u;
 
-    vector rho_u_P      = momentum_p.get_value(q);
-    tensor grad_rho_u_P = momentum_p.get_gradient(q);
+    vector rho_u_P      = w_p.rho_u;
+    tensor grad_rho_u_P = w_p.grad_rho_u;
 
     // energy
-    scalar rho_E_M      = energy_m.get_value(q);
-    vector grad_rho_E_M = energy_m.get_gradient(q);
+    scalar rho_E_M      = w_m.rho_E;
+    vector grad_rho_E_M = w_m.grad_rho_E;
 
-    scalar rho_E_P      = energy_p.get_value(q);
-    vector grad_rho_E_P = energy_p.get_gradient(q);
+    scalar rho_E_P      = w_p.rho_E;
+    vector grad_rho_E_P = w_p.grad_rho_E;
 
     // flux density
     scalar jump_density          = rho_M - rho_P;
@@ -1139,25 +1529,52 @@ public:
                                dealii::types::boundary_id const & boundary_id,
                                unsigned int const                 q) const
   {
-    vector normal = momentum.get_normal_vector(q);
+    return get_gradient_flux_boundary(
+      get_conserved_variables<dim, Number>(density,
+                                           momentum,
+                                           energy,
+                                           q,
+                                           dealii::EvaluationFlags::values |
+                                             dealii::EvaluationFlags::gradients),
+      momentum.get_normal_vector(q),
+      momentum.quadrature_point(q),
+      tau_IP,
+      boundary_type_density,
+      boundary_type_velocity,
+      boundary_type_energy,
+      boundary_variable,
+      boundary_id);
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    get_gradient_flux_boundary(ConservedVariables<dim, Number> const & w_m,
+                               vector const &                          normal,
+                               point const &                           q_point,
+                               scalar const &                          tau_IP,
+                               BoundaryType const &                    boundary_type_density,
+                               BoundaryType const &                    boundary_type_velocity,
+                               BoundaryType const &                    boundary_type_energy,
+                               EnergyBoundaryVariable const &          boundary_variable,
+                               dealii::types::boundary_id const &      boundary_id) const
+  {
     // density
-    scalar rho_M      = density.get_value(q);
-    vector grad_rho_M = density.get_gradient(q);
+    scalar rho_M      = w_m.rho;
+    vector grad_rho_M = w_m.grad_rho;
 
     scalar rho_P = calculate_exterior_value<dim, Number, 0>(rho_M,
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
     scalar jump_density          = rho_M - rho_P;
     scalar gradient_flux_density = -tau_IP * jump_density;
 
     // velocity
-    vector rho_u_M      = momentum.get_value(q);
-    tensor grad_rho_u_M = momentum.get_gradient(q);
+    vector rho_u_M      = w_m.rho_u;
+    tensor grad_rho_u_M = w_m.grad_rho_u;
 
     scalar rho_inv_M = 1.0 / rho_M;
     vector u_M       = rho_inv_M * rho_u_M;
@@ -1166,7 +1583,7 @@ public:
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          q_point,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
@@ -1179,15 +1596,15 @@ public:
                                                      boundary_type_velocity,
                                                      data.bc->velocity,
                                                      boundary_id,
-                                                     momentum.quadrature_point(q),
+                                                     q_point,
                                                      this->eval_time);
 
     vector jump_momentum          = rho_u_M - rho_u_P;
     vector gradient_flux_momentum = 0.5 * (tau_M * normal + tau_P_normal) - tau_IP * jump_momentum;
 
     // energy
-    scalar rho_E_M      = energy.get_value(q);
-    vector grad_rho_E_M = energy.get_gradient(q);
+    scalar rho_E_M      = w_m.rho_E;
+    vector grad_rho_E_M = w_m.grad_rho_E;
 
     scalar E_M = rho_inv_M * rho_E_M;
     scalar E_P = dealii::make_vectorized_array<Number>(0.0);
@@ -1197,7 +1614,7 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     q_point,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -1208,7 +1625,7 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
@@ -1225,7 +1642,7 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     q_point,
                                                      this->eval_time);
 
     scalar jump_energy          = rho_E_M - rho_E_P;
@@ -1251,19 +1668,35 @@ public:
                    FaceIntegratorScalar & energy_p,
                    unsigned int const     q) const
   {
-    vector normal = momentum_m.get_normal_vector(q);
+    return get_value_flux(get_conserved_variables<dim, Number>(
+                            density_m, momentum_m, energy_m, q, dealii::EvaluationFlags::values),
+                          get_conserved_variables<dim, Number>(
+                            density_p, momentum_p, energy_p, q, dealii::EvaluationFlags::values),
+                          momentum_m.get_normal_vector(q));
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<vector /*dummy_M*/,
+               tensor /*value_flux_momentum_M*/,
+               vector /*value_flux_energy_M*/,
+               vector /*dummy_P*/,
+               tensor /*value_flux_momentum_P*/,
+               vector /*value_flux_energy_P*/>
+    get_value_flux(ConservedVariables<dim, Number> const & w_m,
+                   ConservedVariables<dim, Number> const & w_p,
+                   vector const &                          normal) const
+  {
     // density
-    scalar rho_M = density_m.get_value(q);
-    scalar rho_P = density_p.get_value(q);
+    scalar rho_M = w_m.rho;
+    scalar rho_P = w_p.rho;
 
     // velocity
-    vector rho_u_M = momentum_m.get_value(q);
-    vector rho_u_P = momentum_p.get_value(q);
+    vector rho_u_M = w_m.rho_u;
+    vector rho_u_P = w_p.rho_u;
 
     // energy
-    scalar rho_E_M = energy_m.get_value(q);
-    scalar rho_E_P = energy_p.get_value(q);
+    scalar rho_E_M = w_m.rho_E;
+    scalar rho_E_P = w_p.rho_E;
 
     vector jump_rho   = (rho_M - rho_P) * normal;
     tensor jump_rho_u = outer_product(rho_u_M - rho_u_P, normal);
@@ -1331,34 +1764,54 @@ public:
                             dealii::types::boundary_id const & boundary_id,
                             unsigned int const                 q) const
   {
-    vector normal = momentum.get_normal_vector(q);
+    return get_value_flux_boundary(get_conserved_variables<dim, Number>(
+                                     density, momentum, energy, q, dealii::EvaluationFlags::values),
+                                   momentum.get_normal_vector(q),
+                                   momentum.quadrature_point(q),
+                                   boundary_type_density,
+                                   boundary_type_velocity,
+                                   boundary_type_energy,
+                                   boundary_variable,
+                                   boundary_id);
+  }
 
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<vector /*dummy_M*/, tensor /*value_flux_momentum_M*/, vector /*value_flux_energy_M*/>
+    get_value_flux_boundary(ConservedVariables<dim, Number> const & w_m,
+                            vector const &                          normal,
+                            point const &                           q_point,
+                            BoundaryType const &                    boundary_type_density,
+                            BoundaryType const &                    boundary_type_velocity,
+                            BoundaryType const &                    boundary_type_energy,
+                            EnergyBoundaryVariable const &          boundary_variable,
+                            dealii::types::boundary_id const &      boundary_id) const
+  {
     // density
-    scalar rho_M = density.get_value(q);
+    scalar rho_M = w_m.rho;
     scalar rho_P = calculate_exterior_value<dim, Number, 0>(rho_M,
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
     scalar rho_inv_M = 1.0 / rho_M;
 
     // velocity
-    vector rho_u_M = momentum.get_value(q);
+    vector rho_u_M = w_m.rho_u;
     vector u_M     = rho_inv_M * rho_u_M;
 
     vector u_P = calculate_exterior_value<dim, Number, 1>(u_M,
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          q_point,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
 
     // energy
-    scalar rho_E_M = energy.get_value(q);
+    scalar rho_E_M = w_m.rho_E;
     scalar E_M     = rho_inv_M * rho_E_M;
 
     scalar E_P = dealii::make_vectorized_array<Number>(0.0);
@@ -1368,7 +1821,7 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     q_point,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -1379,7 +1832,7 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            q_point,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
@@ -1661,7 +2114,8 @@ private:
 template<int dim>
 struct CombinedOperatorData
 {
-  CombinedOperatorData() : dof_index(0), quad_index(0)
+  CombinedOperatorData()
+    : dof_index(0), quad_index(0), use_single_integrator(false), use_cell_based_loops(false)
   {
   }
 
@@ -1669,6 +2123,13 @@ struct CombinedOperatorData
   unsigned int quad_index;
 
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
+
+  // evaluate density, momentum and energy with a single integrator for all dim + 2 components
+  bool use_single_integrator;
+
+  // integrate all faces of a cell within the cell loop (requires use_single_integrator and
+  // MatrixFree set up by Categorization::do_cell_based_loops())
+  bool use_cell_based_loops;
 };
 
 template<int dim, typename Number>
@@ -1686,12 +2147,16 @@ public:
   typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
   typedef FaceIntegrator<dim, dim, Number> FaceIntegratorVector;
 
+  typedef CellIntegrator<dim, dim + 2, Number> CellIntegratorConserved;
+  typedef FaceIntegrator<dim, dim + 2, Number> FaceIntegratorConserved;
+
   typedef dealii::VectorizedArray<Number>                         scalar;
   typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
   typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
 
-  CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
+  CombinedOperator()
+    : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr), rate_level(0)
   {
   }
 
@@ -1706,6 +2171,10 @@ public:
 
     this->convective_operator = &convective_operator_in;
     this->viscous_operator    = &viscous_operator_in;
+
+    AssertThrow(data.use_single_integrator or not data.use_cell_based_loops,
+                dealii::ExcMessage("Cell-based loops are only implemented for the variant of the "
+                                   "combined operator using a single integrator."));
   }
 
   void
@@ -1721,13 +2190,72 @@ public:
     convective_operator->set_evaluation_time(evaluation_time);
     viscous_operator->set_evaluation_time(evaluation_time);
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    if(data.use_cell_based_loops)
+    {
+      matrix_free->loop_cell_centric(&This::cell_based_loop_single_integrator, this, dst, src);
+    }
+    else if(data.use_single_integrator)
+    {
+      matrix_free->loop(&This::cell_loop_single_integrator,
+                        &This::face_loop_single_integrator,
+                        &This::boundary_face_loop_single_integrator,
+                        this,
+                        dst,
+                        src);
+    }
+    else
+    {
+      matrix_free->loop(
+        &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
 
     // perform cell integrals only for performance measurements
     //    matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Multirate time integration: sets the rate levels of cells and faces, see
+   * read_cell_rate_levels() and read_face_rate_levels(). The ghost values of dof_levels have to be
+   * up to date.
+   */
+  void
+  set_rate_levels(VectorType const & dof_levels)
+  {
+    AssertThrow(data.use_single_integrator and not data.use_cell_based_loops,
+                dealii::ExcMessage("Multirate time integration is only implemented for the variant "
+                                   "of the combined operator using a single integrator and "
+                                   "face-based loops."));
+
+    read_cell_rate_levels(cell_levels, *matrix_free, data.dof_index, data.quad_index, dof_levels);
+    read_face_rate_levels(face_levels, *matrix_free, data.dof_index, data.quad_index, dof_levels);
+  }
+
+  /*
+   * Multirate time integration: evaluates the integrals over the cells of the given rate level and
+   * over the faces of this level, i.e., the faces whose finer adjacent cell belongs to this level.
+   * The flux over a face between two levels is hence computed by the finer level only, and is
+   * added to the cells on both sides of the face, which ensures conservation.
+   */
+  void
+  evaluate_rate_level(VectorType &       dst,
+                      VectorType const & src,
+                      Number const       evaluation_time,
+                      unsigned int const level) const
+  {
+    convective_operator->set_evaluation_time(evaluation_time);
+    viscous_operator->set_evaluation_time(evaluation_time);
+
+    rate_level = level;
+
+    matrix_free->loop(&This::cell_loop_rate_level,
+                      &This::face_loop_rate_level,
+                      &This::boundary_face_loop_rate_level,
+                      this,
+                      dst,
+                      src,
+                      true /* zero dst */);
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
@@ -1966,12 +2494,410 @@ private:
     }
   }
 
+  /*
+   * The functions below implement the variant with a single integrator for all dim + 2 components,
+   * i.e., the dof values of density, momentum and energy are gathered, interpolated and integrated
+   * in one pass instead of three separate passes.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    void
+    do_cell_integral(CellIntegratorConserved & integrator) const
+  {
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      ConservedVariables<dim, Number> const w = get_conserved_variables<dim, Number>(
+        integrator, q, dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
+
+      std::tuple<vector, tensor, vector> conv_flux = convective_operator->get_volume_flux(w);
+
+      std::tuple<vector, tensor, vector> visc_flux = viscous_operator->get_volume_flux(w);
+
+      integrator.submit_gradient(
+        make_conserved_gradient<dim, Number>(-std::get<0>(conv_flux),
+                                             -std::get<1>(conv_flux) + std::get<1>(visc_flux),
+                                             -std::get<2>(conv_flux) + std::get<2>(visc_flux)),
+        q);
+    }
+  }
+
+  /*
+   * Submits the fluxes of an interior face to integrator_m and, if exterior_integral is true, also
+   * to integrator_p. Cell-based loops visit each interior face from both sides and only integrate
+   * the interior side.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    void
+    do_face_integral(FaceIntegratorConserved & integrator_m,
+                     FaceIntegratorConserved & integrator_p,
+                     bool const                exterior_integral) const
+  {
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    scalar tau_IP = viscous_operator->get_penalty_parameter(integrator_m, integrator_p);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      ConservedVariables<dim, Number> const w_m =
+        get_conserved_variables<dim, Number>(integrator_m, q, flags);
+      ConservedVariables<dim, Number> const w_p =
+        get_conserved_variables<dim, Number>(integrator_p, q, flags);
+
+      vector const normal = integrator_m.get_normal_vector(q);
+
+      std::tuple<scalar, vector, scalar> conv_flux =
+        convective_operator->get_flux(w_m, w_p, normal);
+
+      std::tuple<scalar, vector, scalar> visc_grad_flux =
+        viscous_operator->get_gradient_flux(w_m, w_p, normal, tau_IP);
+
+      std::tuple<vector, tensor, vector, vector, tensor, vector> visc_value_flux =
+        viscous_operator->get_value_flux(w_m, w_p, normal);
+
+      scalar const flux_density  = std::get<0>(conv_flux) - std::get<0>(visc_grad_flux);
+      vector const flux_momentum = std::get<1>(conv_flux) - std::get<1>(visc_grad_flux);
+      scalar const flux_energy   = std::get<2>(conv_flux) - std::get<2>(visc_grad_flux);
+
+      integrator_m.submit_value(
+        make_conserved_value<dim, Number>(flux_density, flux_momentum, flux_energy), q);
+      integrator_m.submit_gradient(make_conserved_gradient<dim, Number>(
+                                     vector() /* no value flux for density */,
+                                     std::get<1>(visc_value_flux),
+                                     std::get<2>(visc_value_flux)),
+                                   q);
+
+      if(exterior_integral)
+      {
+        // - sign since n⁺ = -n⁻
+        integrator_p.submit_value(
+          make_conserved_value<dim, Number>(-flux_density, -flux_momentum, -flux_energy), q);
+        // note that the value fluxes of momentum and energy are not conservative
+        integrator_p.submit_gradient(make_conserved_gradient<dim, Number>(
+                                       vector() /* no value flux for density */,
+                                       std::get<4>(visc_value_flux),
+                                       std::get<5>(visc_value_flux)),
+                                     q);
+      }
+    }
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    void
+    do_boundary_integral(FaceIntegratorConserved &          integrator,
+                         dealii::types::boundary_id const & boundary_id) const
+  {
+    scalar tau_IP = viscous_operator->get_penalty_parameter(integrator);
+
+    BoundaryType boundary_type_density  = data.bc->density.get_boundary_type(boundary_id);
+    BoundaryType boundary_type_velocity = data.bc->velocity.get_boundary_type(boundary_id);
+    BoundaryType boundary_type_pressure = data.bc->pressure.get_boundary_type(boundary_id);
+    BoundaryType boundary_type_energy   = data.bc->energy.get_boundary_type(boundary_id);
+
+    EnergyBoundaryVariable boundary_variable = data.bc->energy.get_boundary_variable(boundary_id);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      ConservedVariables<dim, Number> const w_m = get_conserved_variables<dim, Number>(
+        integrator, q, dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
+
+      vector const normal  = integrator.get_normal_vector(q);
+      point const  q_point = integrator.quadrature_point(q);
+
+      std::tuple<scalar, vector, scalar> conv_flux =
+        convective_operator->get_flux_boundary(w_m,
+                                               normal,
+                                               q_point,
+                                               boundary_type_density,
+                                               boundary_type_velocity,
+                                               boundary_type_pressure,
+                                               boundary_type_energy,
+                                               boundary_variable,
+                                               boundary_id);
+
+      std::tuple<scalar, vector, scalar> visc_grad_flux =
+        viscous_operator->get_gradient_flux_boundary(w_m,
+                                                     normal,
+                                                     q_point,
+                                                     tau_IP,
+                                                     boundary_type_density,
+                                                     boundary_type_velocity,
+                                                     boundary_type_energy,
+                                                     boundary_variable,
+                                                     boundary_id);
+
+      std::tuple<vector, tensor, vector> visc_value_flux =
+        viscous_operator->get_value_flux_boundary(w_m,
+                                                  normal,
+                                                  q_point,
+                                                  boundary_type_density,
+                                                  boundary_type_velocity,
+                                                  boundary_type_energy,
+                                                  boundary_variable,
+                                                  boundary_id);
+
+      integrator.submit_value(
+        make_conserved_value<dim, Number>(std::get<0>(conv_flux) - std::get<0>(visc_grad_flux),
+                                          std::get<1>(conv_flux) - std::get<1>(visc_grad_flux),
+                                          std::get<2>(conv_flux) - std::get<2>(visc_grad_flux)),
+        q);
+      integrator.submit_gradient(make_conserved_gradient<dim, Number>(
+                                   vector() /* no value flux for density */,
+                                   std::get<1>(visc_value_flux),
+                                   std::get<2>(visc_value_flux)),
+                                 q);
+    }
+  }
+
+  void
+  cell_loop_single_integrator(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                              VectorType &                                  dst,
+                              VectorType const &                            src,
+                              std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorConserved integrator(matrix_free, data.dof_index, data.quad_index);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src,
+                                 dealii::EvaluationFlags::values |
+                                   dealii::EvaluationFlags::gradients);
+
+      do_cell_integral(integrator);
+
+      integrator.integrate_scatter(dealii::EvaluationFlags::gradients, dst);
+    }
+  }
+
+  void
+  face_loop_single_integrator(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                              VectorType &                                  dst,
+                              VectorType const &                            src,
+                              std::pair<unsigned int, unsigned int> const & face_range) const
+  {
+    FaceIntegratorConserved integrator_m(matrix_free, true, data.dof_index, data.quad_index);
+    FaceIntegratorConserved integrator_p(matrix_free, false, data.dof_index, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    for(unsigned int face = face_range.first; face < face_range.second; face++)
+    {
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(src, flags);
+
+      integrator_p.reinit(face);
+      integrator_p.gather_evaluate(src, flags);
+
+      do_face_integral(integrator_m, integrator_p, true);
+
+      integrator_m.integrate_scatter(flags, dst);
+      integrator_p.integrate_scatter(flags, dst);
+    }
+  }
+
+  void
+  boundary_face_loop_single_integrator(
+    dealii::MatrixFree<dim, Number> const &       matrix_free,
+    VectorType &                                  dst,
+    VectorType const &                            src,
+    std::pair<unsigned int, unsigned int> const & face_range) const
+  {
+    FaceIntegratorConserved integrator(matrix_free, true, data.dof_index, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    for(unsigned int face = face_range.first; face < face_range.second; face++)
+    {
+      integrator.reinit(face);
+      integrator.gather_evaluate(src, flags);
+
+      do_boundary_integral(integrator, matrix_free.get_boundary_id(face));
+
+      integrator.integrate_scatter(flags, dst);
+    }
+  }
+
+  void
+  cell_loop_rate_level(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                       VectorType &                                  dst,
+                       VectorType const &                            src,
+                       std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorConserved integrator(matrix_free, data.dof_index, data.quad_index);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      unsigned int const * levels = &cell_levels[cell * scalar::size()];
+
+      if(not batch_has_rate_level<Number>(levels, rate_level))
+        continue;
+
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src,
+                                 dealii::EvaluationFlags::values |
+                                   dealii::EvaluationFlags::gradients);
+
+      do_cell_integral(integrator);
+
+      integrator.integrate(dealii::EvaluationFlags::gradients);
+      restrict_to_rate_level<Number>(integrator, levels, rate_level);
+      integrator.distribute_local_to_global(dst);
+    }
+  }
+
+  void
+  face_loop_rate_level(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                       VectorType &                                  dst,
+                       VectorType const &                            src,
+                       std::pair<unsigned int, unsigned int> const & face_range) const
+  {
+    FaceIntegratorConserved integrator_m(matrix_free, true, data.dof_index, data.quad_index);
+    FaceIntegratorConserved integrator_p(matrix_free, false, data.dof_index, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    for(unsigned int face = face_range.first; face < face_range.second; face++)
+    {
+      unsigned int const * levels = &face_levels[face * scalar::size()];
+
+      if(not batch_has_rate_level<Number>(levels, rate_level))
+        continue;
+
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(src, flags);
+
+      integrator_p.reinit(face);
+      integrator_p.gather_evaluate(src, flags);
+
+      do_face_integral(integrator_m, integrator_p, true);
+
+      integrator_m.integrate(flags);
+      integrator_p.integrate(flags);
+
+      restrict_to_rate_level<Number>(integrator_m, levels, rate_level);
+      restrict_to_rate_level<Number>(integrator_p, levels, rate_level);
+
+      integrator_m.distribute_local_to_global(dst);
+      integrator_p.distribute_local_to_global(dst);
+    }
+  }
+
+  void
+  boundary_face_loop_rate_level(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                                VectorType &                                  dst,
+                                VectorType const &                            src,
+                                std::pair<unsigned int, unsigned int> const & face_range) const
+  {
+    FaceIntegratorConserved integrator(matrix_free, true, data.dof_index, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    for(unsigned int face = face_range.first; face < face_range.second; face++)
+    {
+      unsigned int const * levels = &face_levels[face * scalar::size()];
+
+      if(not batch_has_rate_level<Number>(levels, rate_level))
+        continue;
+
+      integrator.reinit(face);
+      integrator.gather_evaluate(src, flags);
+
+      do_boundary_integral(integrator, matrix_free.get_boundary_id(face));
+
+      integrator.integrate(flags);
+      restrict_to_rate_level<Number>(integrator, levels, rate_level);
+      integrator.distribute_local_to_global(dst);
+    }
+  }
+
+  /*
+   * Element-centric loop: the face integrals of all faces of a cell are performed within the cell
+   * loop, so that the dof values of a cell are read from src and written to dst only once per
+   * operator evaluation. Interior faces are visited from both sides, and only the contribution of
+   * the current cell is integrated. The data of the neighbor is accessed via integrator_p.
+   */
+  void
+  cell_based_loop_single_integrator(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                                    VectorType &                                  dst,
+                                    VectorType const &                            src,
+                                    std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorConserved integrator(matrix_free, data.dof_index, data.quad_index);
+    FaceIntegratorConserved integrator_m(matrix_free, true, data.dof_index, data.quad_index);
+    FaceIntegratorConserved integrator_p(matrix_free, false, data.dof_index, data.quad_index);
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
+
+    // dof values of the current cell, reused for all face integrals of this cell
+    dealii::AlignedVector<scalar> src_cell(integrator.dofs_per_cell);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src);
+
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        src_cell[i] = integrator.begin_dof_values()[i];
+
+      integrator.evaluate(flags);
+
+      do_cell_integral(integrator);
+
+      integrator.integrate(dealii::EvaluationFlags::gradients);
+
+      for(unsigned int face = 0; face < n_faces; ++face)
+      {
+        // all cells of a batch have the same boundary IDs, see Categorization
+        dealii::types::boundary_id const boundary_id =
+          matrix_free.get_faces_by_cells_boundary_id(cell, face)[0];
+
+        integrator_m.reinit(cell, face);
+
+        for(unsigned int i = 0; i < integrator_m.dofs_per_cell; ++i)
+          integrator_m.begin_dof_values()[i] = src_cell[i];
+
+        integrator_m.evaluate(flags);
+
+        if(boundary_id == dealii::numbers::internal_face_boundary_id) // interior face
+        {
+          integrator_p.reinit(cell, face);
+          integrator_p.gather_evaluate(src, flags);
+
+          do_face_integral(integrator_m, integrator_p, false);
+        }
+        else // boundary face
+        {
+          do_boundary_integral(integrator_m, boundary_id);
+        }
+
+        integrator_m.integrate(flags);
+
+        for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+          integrator.begin_dof_values()[i] += integrator_m.begin_dof_values()[i];
+      }
+
+      integrator.distribute_local_to_global(dst);
+    }
+  }
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   CombinedOperatorData<dim> data;
 
   ConvectiveOperator<dim, Number> const * convective_operator;
   ViscousOperator<dim, Number> const *    viscous_operator;
+
+  // multirate time integration
+  std::vector<unsigned int> cell_levels;
+  std::vector<unsigned int> face_levels;
+  unsigned int mutable rate_level;
 };
 
 } // namespace CompNS
@@ -206,6 +206,50 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   wall_time_operator_evaluation += timer.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_fused(VectorType &         dst,
+                                      VectorType const &   src,
+                                      Number const         time,
+                                      VectorUpdate const & vector_update) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  evaluate_convective_and_viscous(dst, src, time);
+
+  // In the absence of a body force term, the viscous and convective terms are shifted to
+  // the right-hand side of the equation inside the loop of the inverse mass operator in
+  // order to avoid a separate sweep over dst.
+  bool const shift_to_rhs_in_loop = not(param.right_hand_side);
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    dst *= -1.0;
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  // apply inverse mass operator and perform the vector updates while the data is in cache
+  inverse_mass_all.apply(dst,
+                         dst,
+                         {} /* no operation before loop */,
+                         [&](unsigned int const start_range, unsigned int const end_range) {
+                           if(shift_to_rhs_in_loop)
+                           {
+                             Number * dst_ptr = dst.begin();
+
+                             DEAL_II_OPENMP_SIMD_PRAGMA
+                             for(unsigned int i = start_range; i < end_range; ++i)
+                               dst_ptr[i] = -dst_ptr[i];
+                           }
+
+                           vector_update(start_range, end_range);
+                         });
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective(VectorType &       dst,
@@ -444,6 +488,175 @@ Operator<dim, Number>::calculate_time_step_diffusion() const
                                                param.exponent_fe_degree_viscous);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::calculate_time_step_cells(std::vector<double> & time_step,
+                                                 VectorType const &    solution,
+                                                 double const          cfl,
+                                                 double const          diffusion_number) const
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  dealii::AlignedVector<scalar> time_step_cfl, time_step_diffusion;
+
+  if(cfl > 0.0)
+  {
+    VectorType velocity, speed_of_sound;
+    initialize_dof_vector_dim_components(velocity);
+    initialize_dof_vector_scalar(speed_of_sound);
+
+    compute_velocity(velocity, solution);
+
+    // speed of sound a = sqrt(gamma * R * T)
+    compute_temperature(speed_of_sound, solution);
+    for(Number & value : speed_of_sound)
+      value = std::sqrt(param.heat_capacity_ratio * param.specific_gas_constant *
+                        std::max(value, Number(0.0)));
+
+    ExaDG::calculate_time_step_cfl_local(time_step_cfl,
+                                         *matrix_free,
+                                         get_dof_index_vector(),
+                                         get_quad_index_standard(),
+                                         velocity,
+                                         param.degree,
+                                         param.exponent_fe_degree_cfl,
+                                         CFLConditionType::VelocityNorm,
+                                         &speed_of_sound,
+                                         get_dof_index_scalar());
+  }
+
+  if(diffusion_number > 0.0 and param.equation_type == EquationType::NavierStokes)
+  {
+    ExaDG::calculate_time_step_diffusion_local(time_step_diffusion,
+                                               *matrix_free,
+                                               get_dof_index_scalar(),
+                                               get_quad_index_standard(),
+                                               param.dynamic_viscosity / param.reference_density,
+                                               param.degree,
+                                               param.exponent_fe_degree_viscous);
+  }
+
+  unsigned int const n_lanes = scalar::size();
+
+  time_step.assign(matrix_free->n_cell_batches() * n_lanes, -1.0);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      double dt = std::numeric_limits<double>::max();
+
+      if(time_step_cfl.size() > 0)
+        dt = std::min(dt, cfl * time_step_cfl[cell][v]);
+
+      if(time_step_diffusion.size() > 0)
+        dt = std::min(dt, diffusion_number * time_step_diffusion[cell][v]);
+
+      time_step[cell * n_lanes + v] = dt;
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_rate_levels(std::vector<unsigned int> const & cell_levels)
+{
+  unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+  AssertThrow(cell_levels.size() == matrix_free->n_cell_batches() * n_lanes,
+              dealii::ExcMessage("The rate levels have to be given for all cells."));
+
+  initialize_dof_vector(dof_vector_rate_levels);
+
+  CellIntegrator<dim, dim + 2, Number> integrator(*matrix_free,
+                                                  get_dof_index_all(),
+                                                  get_quad_index_standard());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    dealii::VectorizedArray<Number> level = 0.0;
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      level[v] = cell_levels[cell * n_lanes + v];
+
+    integrator.reinit(cell);
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] = level;
+    integrator.set_dof_values(dof_vector_rate_levels);
+  }
+
+  // the level of faces at processor boundaries depends on the level of ghost cells
+  dof_vector_rate_levels.update_ghost_values();
+
+  if(param.right_hand_side == true)
+    body_force_operator.set_rate_levels(dof_vector_rate_levels);
+
+  combined_operator.set_rate_levels(dof_vector_rate_levels);
+
+  dof_vector_rate_levels.zero_out_ghost_values();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::fill_dof_vector_rate_levels(VectorType & dst) const
+{
+  dst = dof_vector_rate_levels;
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::extract_rate_levels(std::vector<unsigned int> & cell_levels,
+                                           VectorType const &          dof_vector) const
+{
+  unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+  cell_levels.assign(matrix_free->n_cell_batches() * n_lanes,
+                     dealii::numbers::invalid_unsigned_int);
+
+  CellIntegrator<dim, dim + 2, Number> integrator(*matrix_free,
+                                                  get_dof_index_all(),
+                                                  get_quad_index_standard());
+
+  // the rate level is constant within each cell
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(dof_vector);
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      cell_levels[cell * n_lanes + v] =
+        static_cast<unsigned int>(std::round(integrator.begin_dof_values()[0][v]));
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_rate_level(VectorType &       dst,
+                                           VectorType const & src,
+                                           Number const       time,
+                                           unsigned int const level) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  AssertThrow(param.use_combined_operator == true,
+              dealii::ExcMessage("Multirate time integration requires the combined operator."));
+
+  combined_operator.evaluate_rate_level(dst, src, time, level);
+
+  // shift viscous and convective terms to the right-hand side of the equation
+  dst *= -1.0;
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add_rate_level(dst, src, time, level);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::distribute_dofs()
@@ -520,9 +733,11 @@ Operator<dim, Number>::setup_operators()
                                    "and viscous term in case of combined operator."));
 
     CombinedOperatorData<dim> combined_operator_data;
-    combined_operator_data.dof_index  = get_dof_index_all();
-    combined_operator_data.quad_index = get_quad_index_overintegration_vis();
-    combined_operator_data.bc         = boundary_descriptor;
+    combined_operator_data.dof_index             = get_dof_index_all();
+    combined_operator_data.quad_index            = get_quad_index_overintegration_vis();
+    combined_operator_data.bc                    = boundary_descriptor;
+    combined_operator_data.use_single_integrator = param.use_combined_operator_single_integrator;
+    combined_operator_data.use_cell_based_loops  = param.use_cell_based_face_loops;
 
     combined_operator.initialize(*matrix_free,
                                  combined_operator_data,
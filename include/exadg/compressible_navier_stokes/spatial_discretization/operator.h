@@ -48,6 +48,8 @@ class Operator : public dealii::Subscriptor, public Interface::Operator<Number>
 private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
+  typedef typename Interface::Operator<Number>::VectorUpdate VectorUpdate;
+
 public:
   Operator(std::shared_ptr<Grid<dim> const>               grid,
            std::shared_ptr<BoundaryDescriptor<dim> const> boundary_descriptor,
@@ -90,6 +92,20 @@ public:
   void
   evaluate(VectorType & dst, VectorType const & src, Number const time) const;
 
+  /*
+   *  Same as evaluate(), but the function vector_update is called on index ranges of dst
+   *  from within the loop applying the inverse mass operator. This allows to fuse the
+   *  vector updates of explicit Runge-Kutta stages with the inverse mass operator. Note that
+   *  the convective and viscous terms are still evaluated in a separate loop before, since
+   *  the inverse mass operator can only be applied to a cell once all face integrals
+   *  contributing to this cell have been added.
+   */
+  void
+  evaluate_fused(VectorType &         dst,
+                 VectorType const &   src,
+                 Number const         time,
+                 VectorUpdate const & vector_update) const;
+
   void
   evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const;
 
@@ -163,6 +179,33 @@ public:
   double
   calculate_time_step_diffusion() const;
 
+  // multirate time integration
+  void
+  calculate_time_step_cells(std::vector<double> & time_step,
+                            VectorType const &    solution,
+                            double const          cfl,
+                            double const          diffusion_number) const;
+
+  void
+  set_rate_levels(std::vector<unsigned int> const & cell_levels);
+
+  void
+  fill_dof_vector_rate_levels(VectorType & dst) const;
+
+  void
+  extract_rate_levels(std::vector<unsigned int> & cell_levels, VectorType const & dof_vector) const;
+
+  /*
+   *  Same as evaluate(), but restricted to the cells and faces of the given rate level, see
+   *  CombinedOperator::evaluate_rate_level(). The inverse mass operator is block-diagonal and is
+   *  applied to the whole vector, which is zero outside the cells of this level.
+   */
+  void
+  evaluate_rate_level(VectorType &       dst,
+                      VectorType const & src,
+                      Number const       time,
+                      unsigned int const level) const;
+
 private:
   double
   calculate_minimum_element_length() const;
@@ -275,6 +318,9 @@ private:
    */
   dealii::ConditionalOStream pcout;
 
+  // multirate time integration: rate level of each dof
+  VectorType dof_vector_rate_levels;
+
   // wall time for operator evaluation
   mutable double wall_time_operator_evaluation;
 };
@@ -0,0 +1,148 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_RATE_LEVEL_OPERATOR_H_
+#define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_RATE_LEVEL_OPERATOR_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/interface.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+/*
+ *  Operator seen by the explicit Runge-Kutta time integrator of one rate level in multirate time
+ *  integration, see TimeIntExplRK. The operator is evaluated for the cells and faces of this level
+ *  only. The dofs of coarser levels are not advanced by this level, and their values at
+ *  intermediate times are obtained by linear interpolation in time between the solution at the
+ *  beginning of the macro time step and the solution predicted by the coarser levels at the end of
+ *  the macro time step.
+ */
+template<typename Number>
+class RateLevelOperator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Interface::Operator<Number> Operator;
+
+  typedef typename Operator::VectorUpdate VectorUpdate;
+
+  RateLevelOperator(std::shared_ptr<Operator> operator_in,
+                    VectorType const &        dof_vector_rate_levels_in,
+                    unsigned int const        level_in)
+    : pde_operator(operator_in),
+      dof_vector_rate_levels(dof_vector_rate_levels_in),
+      level(level_in),
+      solution_n(nullptr),
+      solution_np(nullptr),
+      time_n(0.0),
+      time_step(1.0)
+  {
+  }
+
+  /*
+   * Sets the solution at the beginning of the macro time step and the predicted solution at the
+   * end of the macro time step, which are used to interpolate the dofs of coarser levels.
+   */
+  void
+  set_macro_time_step(VectorType const & solution_n_in,
+                      VectorType const & solution_np_in,
+                      double const       time_n_in,
+                      double const       time_step_in)
+  {
+    solution_n  = &solution_n_in;
+    solution_np = &solution_np_in;
+    time_n      = time_n_in;
+    time_step   = time_step_in;
+  }
+
+  void
+  initialize_dof_vector(VectorType & src) const
+  {
+    pde_operator->initialize_dof_vector(src);
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const
+  {
+    AssertThrow(solution_n != nullptr and solution_np != nullptr,
+                dealii::ExcMessage("Macro time step has not been set."));
+
+    // local check only, since a collective check would synchronize all processes in every stage
+    if(not src_level.partitioners_are_compatible(*src.get_partitioner()))
+      src_level.reinit(src, true);
+
+    Number const theta = (evaluation_time - time_n) / time_step;
+
+    Number const * levels = dof_vector_rate_levels.begin();
+    Number const * u      = src.begin();
+    Number const * u_n    = solution_n->begin();
+    Number const * u_np   = solution_np->begin();
+    Number *       u_l    = src_level.begin();
+
+    Number const this_level = level;
+
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for(unsigned int i = 0; i < src.locally_owned_size(); ++i)
+      u_l[i] = (levels[i] > this_level) ? u_n[i] + theta * (u_np[i] - u_n[i]) : u[i];
+
+    pde_operator->evaluate_rate_level(dst, src_level, evaluation_time, level);
+  }
+
+  /*
+   * The vector updates are performed after the operator evaluation on the whole vector.
+   */
+  void
+  evaluate_fused(VectorType &         dst,
+                 VectorType const &   src,
+                 Number const         evaluation_time,
+                 VectorUpdate const & vector_update) const
+  {
+    evaluate(dst, src, evaluation_time);
+
+    vector_update(0, dst.locally_owned_size());
+  }
+
+private:
+  std::shared_ptr<Operator> pde_operator;
+
+  VectorType const & dof_vector_rate_levels;
+
+  unsigned int const level;
+
+  VectorType const * solution_n;
+  VectorType const * solution_np;
+
+  double time_n;
+  double time_step;
+
+  mutable VectorType src_level;
+};
+
+} // namespace CompNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_RATE_LEVEL_OPERATOR_H_ */
@@ -30,74 +30,142 @@ namespace ExaDG
 {
 namespace CompNS
 {
-template<typename Number>
-TimeIntExplRK<Number>::TimeIntExplRK(
-  std::shared_ptr<Operator>                       operator_in,
-  Parameters const &                              param_in,
-  MPI_Comm const &                                mpi_comm_in,
-  bool const                                      is_test_in,
-  std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in)
-  : TimeIntExplRKBase<Number>(param_in.start_time,
-                              param_in.end_time,
-                              param_in.max_number_of_time_steps,
-                              param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
-                              mpi_comm_in,
-                              is_test_in),
-    pde_operator(operator_in),
-    param(param_in),
-    refine_steps_time(param_in.n_refine_time),
-    postprocessor(postprocessor_in),
-    l2_norm(0.0),
-    cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
-    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
+namespace
 {
-}
-
-template<typename Number>
-void
-TimeIntExplRK<Number>::initialize_time_integrator()
+/*
+ *  Creates the Runge-Kutta time integrator specified in the parameters for a given operator.
+ */
+template<typename Operator, typename VectorType>
+std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>>
+create_explicit_time_integrator(std::shared_ptr<Operator> const & pde_operator,
+                                Parameters const &                param)
 {
-  // initialize Runge-Kutta time integrator
-  if(this->param.temporal_discretization == TemporalDiscretization::ExplRK)
+  std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>> rk_time_integrator;
+
+  if(param.use_fused_stage_updates)
+  {
+    if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 3, 4);
+    }
+    else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 4, 5);
+    }
+    else if(param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKReg2Fused<Operator, VectorType>>(pde_operator, 5, 9);
+    }
+    else if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKTDFused<Operator, VectorType>>(pde_operator, 3, 7);
+    }
+    else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2)
+    {
+      rk_time_integrator =
+        std::make_shared<LowStorageRKTDFused<Operator, VectorType>>(pde_operator, 4, 8);
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    }
+  }
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK)
   {
     rk_time_integrator = std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
       param.order_time_integrator, pde_operator);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(pde_operator);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(pde_operator);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK4Stage5Reg3C<Operator, VectorType>>(pde_operator);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(pde_operator);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
   {
     rk_time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(pde_operator, 3, 7);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2)
+  else if(param.temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2)
   {
     rk_time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(pde_operator, 4, 8);
   }
-  else if(this->param.temporal_discretization == TemporalDiscretization::SSPRK)
+  else if(param.temporal_discretization == TemporalDiscretization::SSPRK)
   {
     rk_time_integrator = std::make_shared<SSPRK<Operator, VectorType>>(pde_operator,
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+
+  return rk_time_integrator;
+}
+} // namespace
+
+template<typename Number>
+TimeIntExplRK<Number>::TimeIntExplRK(
+  std::shared_ptr<Operator>                       operator_in,
+  Parameters const &                              param_in,
+  MPI_Comm const &                                mpi_comm_in,
+  bool const                                      is_test_in,
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in)
+  : TimeIntExplRKBase<Number>(param_in.start_time,
+                              param_in.end_time,
+                              param_in.max_number_of_time_steps,
+                              param_in.restart_data,
+                              false, // currently no adaptive time stepping implemented
+                              mpi_comm_in,
+                              is_test_in),
+    pde_operator(operator_in),
+    param(param_in),
+    refine_steps_time(param_in.n_refine_time),
+    postprocessor(postprocessor_in),
+    l2_norm(0.0),
+    cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
+    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time)),
+    n_rate_levels(param.n_rate_levels),
+    rate_levels_initialized(false),
+    wall_time_global_time_step(0.0),
+    wall_time_macro_time_steps(0.0),
+    n_macro_time_steps(0)
+{
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::initialize_time_integrator()
+{
+  // initialize Runge-Kutta time integrator
+  rk_time_integrator = create_explicit_time_integrator<Operator, VectorType>(pde_operator, param);
+
+  // multirate time integration: one Runge-Kutta time integrator per rate level
+  if(n_rate_levels > 1)
+  {
+    for(unsigned int level = 0; level < n_rate_levels; ++level)
+    {
+      level_operators.push_back(
+        std::make_shared<LevelOperator>(pde_operator, dof_vector_rate_levels, level));
+
+      level_time_integrators.push_back(
+        create_explicit_time_integrator<LevelOperator, VectorType>(level_operators.back(), param));
+    }
+  }
 }
 
 /*
@@ -109,6 +177,13 @@ TimeIntExplRK<Number>::initialize_vectors()
 {
   pde_operator->initialize_dof_vector(this->solution_n);
   pde_operator->initialize_dof_vector(this->solution_np);
+
+  if(n_rate_levels > 1)
+  {
+    pde_operator->initialize_dof_vector(dof_vector_rate_levels);
+    pde_operator->initialize_dof_vector(solution_level);
+    pde_operator->initialize_dof_vector(solution_level_np);
+  }
 }
 
 /*
@@ -130,7 +205,31 @@ TimeIntExplRK<Number>::calculate_time_step_size()
 {
   this->pcout << std::endl << "Calculation of time step size:" << std::endl << std::endl;
 
-  if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  if(n_rate_levels > 1)
+  {
+    // The time step size of the finest rate level is the minimum of the admissible time step sizes
+    // of all cells, and the macro time step comprises 2^{L-1} time steps of the finest level.
+    std::vector<double> time_step_cells;
+    double const        time_step_finest = calculate_time_step_cells(time_step_cells);
+
+    if(param.calculation_of_time_step_size != TimeStepCalculation::Diffusion)
+      print_parameter(this->pcout, "CFL", cfl_number);
+    if(param.calculation_of_time_step_size != TimeStepCalculation::CFL)
+      print_parameter(this->pcout, "Diffusion number", diffusion_number);
+    print_parameter(this->pcout, "Time step size (finest rate level)", time_step_finest);
+
+    this->time_step = adjust_time_step_to_hit_end_time(this->start_time,
+                                                       this->end_time,
+                                                       std::pow(2.0, n_rate_levels - 1) *
+                                                         time_step_finest);
+
+    print_parameter(this->pcout, "Time step size (macro time step)", this->time_step);
+
+    assign_rate_levels(time_step_cells);
+
+    measure_wall_time_global_time_step();
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
   {
     this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
 
@@ -193,6 +292,186 @@ TimeIntExplRK<Number>::calculate_time_step_size()
   }
 }
 
+template<typename Number>
+double
+TimeIntExplRK<Number>::calculate_time_step_cells(std::vector<double> & time_step_cells) const
+{
+  bool const use_cfl =
+    param.calculation_of_time_step_size == TimeStepCalculation::CFL or
+    param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion;
+  bool const use_diffusion =
+    param.calculation_of_time_step_size == TimeStepCalculation::Diffusion or
+    param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion;
+
+  pde_operator->calculate_time_step_cells(time_step_cells,
+                                          this->solution_n,
+                                          use_cfl ? cfl_number : -1.0,
+                                          use_diffusion ? diffusion_number : -1.0);
+
+  double time_step_min = std::numeric_limits<double>::max();
+  for(double const time_step_cell : time_step_cells)
+  {
+    // lane not filled with a cell
+    if(time_step_cell < 0.0)
+      continue;
+
+    time_step_min = std::min(time_step_min, time_step_cell);
+  }
+
+  return dealii::Utilities::MPI::min(time_step_min, this->mpi_comm);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::assign_rate_levels(std::vector<double> const & time_step_cells)
+{
+  double const time_step_finest = this->time_step / std::pow(2.0, n_rate_levels - 1);
+
+  std::vector<unsigned int> cell_levels(time_step_cells.size(),
+                                        dealii::numbers::invalid_unsigned_int);
+
+  for(unsigned int i = 0; i < time_step_cells.size(); ++i)
+  {
+    // lane not filled with a cell
+    if(time_step_cells[i] < 0.0)
+      continue;
+
+    unsigned int level = 0;
+    while(level + 1 < n_rate_levels and
+          time_step_finest * std::pow(2.0, level + 1) <= time_step_cells[i])
+      ++level;
+
+    cell_levels[i] = level;
+  }
+
+  set_rate_levels(cell_levels);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::assign_rate_levels(VectorType const & dof_vector)
+{
+  std::vector<unsigned int> cell_levels;
+  pde_operator->extract_rate_levels(cell_levels, dof_vector);
+
+  set_rate_levels(cell_levels);
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::set_rate_levels(std::vector<unsigned int> const & cell_levels)
+{
+  std::vector<dealii::types::global_cell_index> n_cells_level_local(n_rate_levels, 0);
+  for(unsigned int const level : cell_levels)
+    if(level != dealii::numbers::invalid_unsigned_int)
+      ++n_cells_level_local[level];
+
+  pde_operator->set_rate_levels(cell_levels);
+  pde_operator->fill_dof_vector_rate_levels(dof_vector_rate_levels);
+
+  n_cells_level.resize(n_rate_levels);
+  dealii::Utilities::MPI::sum(n_cells_level_local, this->mpi_comm, n_cells_level);
+
+  rate_levels_initialized = true;
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::measure_wall_time_global_time_step()
+{
+  // Measure the wall time of a global time step with the time step size of the finest level as a
+  // reference for the achieved speedup. The result of this time step is discarded, and the first
+  // time step is not measured since it includes the allocation of temporary vectors.
+  double const time_step_finest = this->time_step / std::pow(2.0, n_rate_levels - 1);
+
+  VectorType src, dst;
+  pde_operator->initialize_dof_vector(src);
+  pde_operator->initialize_dof_vector(dst);
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < 2; ++i)
+  {
+    src = this->solution_n;
+
+    timer.restart();
+    rk_time_integrator->solve_timestep(dst, src, this->time, time_step_finest);
+    wall_time_global_time_step = timer.wall_time();
+  }
+}
+
+template<typename Number>
+std::vector<typename TimeIntExplRK<Number>::VectorType const *>
+TimeIntExplRK<Number>::get_additional_restart_vectors() const
+{
+  // multirate time integration: the rate levels are part of the time integration scheme
+  if(n_rate_levels > 1)
+    return {&dof_vector_rate_levels};
+  else
+    return {};
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::set_additional_restart_vectors(std::vector<VectorType> const & vectors)
+{
+  AssertDimension(vectors.size(), 1);
+
+  assign_rate_levels(vectors[0]);
+
+  measure_wall_time_global_time_step();
+}
+
+template<typename Number>
+double
+TimeIntExplRK<Number>::calculate_theoretical_speedup() const
+{
+  // number of cell updates per macro time step for global and multirate time stepping
+  double work_global = 0.0, work_multirate = 0.0;
+  for(unsigned int level = 0; level < n_rate_levels; ++level)
+  {
+    work_global += n_cells_level[level] * std::pow(2.0, n_rate_levels - 1);
+    work_multirate += n_cells_level[level] * std::pow(2.0, n_rate_levels - 1 - level);
+  }
+
+  return work_global / work_multirate;
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::print_rate_level_statistics() const
+{
+  if(n_rate_levels == 1 or not rate_levels_initialized)
+    return;
+
+  this->pcout << std::endl << "Multirate time integration:" << std::endl << std::endl;
+
+  for(unsigned int level = 0; level < n_rate_levels; ++level)
+  {
+    std::string const name = "level " + std::to_string(level);
+
+    print_parameter(this->pcout, "Cells on " + name, n_cells_level[level]);
+    print_parameter(this->pcout,
+                    "Time step size " + name,
+                    this->time_step / std::pow(2.0, n_rate_levels - 1 - level));
+  }
+
+  print_parameter(this->pcout, "Theoretical speedup", calculate_theoretical_speedup());
+
+  if(n_macro_time_steps > 0)
+  {
+    double const wall_time_global =
+      dealii::Utilities::MPI::min_max_avg(wall_time_global_time_step, this->mpi_comm).avg;
+    double const wall_time_macro =
+      dealii::Utilities::MPI::min_max_avg(wall_time_macro_time_steps / n_macro_time_steps,
+                                          this->mpi_comm)
+        .avg;
+
+    print_parameter(this->pcout,
+                    "Achieved speedup",
+                    std::pow(2.0, n_rate_levels - 1) * wall_time_global / wall_time_macro);
+  }
+}
+
 template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
@@ -241,10 +520,17 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(n_rate_levels > 1)
+  {
+    do_timestep_solve_multirate();
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() and not(this->is_test))
   {
@@ -255,6 +541,86 @@ TimeIntExplRK<Number>::do_timestep_solve()
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::do_timestep_solve_multirate()
+{
+  AssertThrow(rate_levels_initialized, dealii::ExcMessage("Rate levels have not been set up."));
+
+  // The admissible time step sizes of the cells change with the solution, so that the rate levels
+  // are recomputed regularly. The time step size of the finest level has to remain admissible for
+  // all cells, where the CFL and diffusion numbers act as safety factors.
+  if(param.rate_levels_update_interval > 0 and n_macro_time_steps > 0 and
+     n_macro_time_steps % param.rate_levels_update_interval == 0)
+  {
+    std::vector<double> time_step_cells;
+    double const        time_step_min = calculate_time_step_cells(time_step_cells);
+
+    AssertThrow(this->time_step / std::pow(2.0, n_rate_levels - 1) <= time_step_min,
+                dealii::ExcMessage("The time step size of the finest rate level exceeds the "
+                                   "admissible time step size. Reduce the CFL number or the "
+                                   "diffusion number."));
+
+    assign_rate_levels(time_step_cells);
+  }
+
+  dealii::Timer timer_macro_time_step;
+  timer_macro_time_step.restart();
+
+  // solution_np accumulates the updates of all levels. Since the levels are processed from coarse
+  // to fine, solution_np contains the solution predicted by the coarser levels when processing a
+  // level, which is used for the values of coarser neighbors.
+  this->solution_np = this->solution_n;
+
+  for(unsigned int level = n_rate_levels; level-- > 0;)
+  {
+    if(n_cells_level[level] == 0)
+      continue;
+
+    dealii::Timer timer;
+    timer.restart();
+
+    unsigned int const n_substeps      = dealii::Utilities::pow(2, n_rate_levels - 1 - level);
+    double const       time_step_level = this->time_step / n_substeps;
+
+    level_operators[level]->set_macro_time_step(this->solution_n,
+                                                this->solution_np,
+                                                this->time,
+                                                this->time_step);
+
+    solution_level = this->solution_n;
+    for(unsigned int step = 0; step < n_substeps; ++step)
+    {
+      level_time_integrators[level]->solve_timestep(solution_level_np,
+                                                    solution_level,
+                                                    this->time + step * time_step_level,
+                                                    time_step_level);
+
+      solution_level.swap(solution_level_np);
+    }
+
+    // Add the update of the dofs of this level as well as the fluxes over the faces to coarser
+    // levels accumulated over the substeps of this level. The dofs of finer levels are not changed
+    // by this level.
+    Number const   this_level = level;
+    Number const * levels     = dof_vector_rate_levels.begin();
+    Number const * u_n        = this->solution_n.begin();
+    Number const * u_level    = solution_level.begin();
+    Number *       u_np       = this->solution_np.begin();
+
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for(unsigned int i = 0; i < this->solution_np.locally_owned_size(); ++i)
+      if(levels[i] >= this_level)
+        u_np[i] += u_level[i] - u_n[i];
+
+    this->timer_tree->insert({"Timeloop", "Solve-explicit", "Level " + std::to_string(level)},
+                             timer.wall_time());
+  }
+
+  wall_time_macro_time_steps += timer_macro_time_step.wall_time();
+  ++n_macro_time_steps;
+}
+
 template<typename Number>
 bool
 TimeIntExplRK<Number>::print_solver_info() const
@@ -27,6 +27,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/compressible_navier_stokes/time_integration/rate_level_operator.h>
 #include <exadg/time_integration/explicit_runge_kutta.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
@@ -47,6 +48,21 @@ template<typename Number>
 class Operator;
 }
 
+/*
+ *  Explicit Runge-Kutta time integration of the compressible Navier-Stokes equations.
+ *
+ *  With more than one rate level (multirate or local time stepping), the cells are grouped into
+ *  levels according to the admissible local time step size, where level l is advanced with time
+ *  step size 2^l dt_0 and dt_0 is the time step size of the finest level 0. One time step of the
+ *  time integrator is a macro time step of size 2^{L-1} dt_0 with L rate levels. The levels are
+ *  processed from coarse to fine, and each level is advanced by its own Runge-Kutta substeps of
+ *  the operator restricted to the cells of this level and the faces whose finer adjacent cell
+ *  belongs to this level. The values of coarser neighbors are interpolated linearly in time. The
+ *  fluxes over faces between two levels are hence integrated by the finer level, and the
+ *  contributions to the coarser cells accumulated over the substeps are added to the solution of
+ *  the coarser cells at the end of the macro time step, which ensures conservation. Note that the
+ *  coupling of levels is first-order accurate in time at the interfaces between levels.
+ */
 template<typename Number>
 class TimeIntExplRK : public TimeIntExplRKBase<Number>
 {
@@ -55,6 +71,8 @@ public:
 
   typedef Interface::Operator<Number> Operator;
 
+  typedef RateLevelOperator<Number> LevelOperator;
+
   TimeIntExplRK(std::shared_ptr<Operator>                       operator_in,
                 Parameters const &                              param_in,
                 MPI_Comm const &                                mpi_comm_in,
@@ -64,6 +82,13 @@ public:
   void
   get_wall_times(std::vector<std::string> & name, std::vector<double> & wall_time) const;
 
+  /*
+   * Multirate time integration: prints the number of cells per rate level as well as the
+   * theoretical and the achieved speedup compared to global time stepping.
+   */
+  void
+  print_rate_level_statistics() const;
+
 private:
   void
   initialize_time_integrator();
@@ -83,6 +108,44 @@ private:
   void
   do_timestep_solve() final;
 
+  void
+  do_timestep_solve_multirate();
+
+  /*
+   * Calculates the admissible time step size of each cell (negative for lanes not filled with a
+   * cell) and returns the minimum over all cells.
+   */
+  double
+  calculate_time_step_cells(std::vector<double> & time_step_cells) const;
+
+  /*
+   * Assigns each cell to the coarsest rate level whose time step size does not exceed the
+   * admissible time step size of the cell.
+   */
+  void
+  assign_rate_levels(std::vector<double> const & time_step_cells);
+
+  /*
+   * Assigns the rate levels given by a dof vector as read from restart files.
+   */
+  void
+  assign_rate_levels(VectorType const & dof_vector);
+
+  void
+  set_rate_levels(std::vector<unsigned int> const & cell_levels);
+
+  void
+  measure_wall_time_global_time_step();
+
+  double
+  calculate_theoretical_speedup() const;
+
+  std::vector<VectorType const *>
+  get_additional_restart_vectors() const final;
+
+  void
+  set_additional_restart_vectors(std::vector<VectorType> const & vectors) final;
+
   bool
   print_solver_info() const;
 
@@ -123,6 +186,30 @@ private:
   // time step calculation
   double const cfl_number;
   double const diffusion_number;
+
+  // multirate time integration
+  unsigned int const n_rate_levels;
+
+  std::vector<std::shared_ptr<LevelOperator>> level_operators;
+
+  std::vector<std::shared_ptr<ExplicitTimeIntegrator<LevelOperator, VectorType>>>
+    level_time_integrators;
+
+  bool rate_levels_initialized;
+
+  // rate level of each dof
+  VectorType dof_vector_rate_levels;
+
+  // solution of the current rate level
+  VectorType solution_level, solution_level_np;
+
+  std::vector<dealii::types::global_cell_index> n_cells_level;
+
+  // wall time of a global time step with the time step size of the finest level and accumulated
+  // wall time of macro time steps, used to measure the speedup of multirate time integration
+  double       wall_time_global_time_step;
+  double       wall_time_macro_time_steps;
+  unsigned int n_macro_time_steps;
 };
 
 } // namespace CompNS
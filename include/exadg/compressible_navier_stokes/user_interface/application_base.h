@@ -102,6 +102,7 @@ public:
     boundary_descriptor = std::make_shared<BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions<dim, Number>(*boundary_descriptor, *grid);
+    set_vectorized_functions(*boundary_descriptor);
 
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
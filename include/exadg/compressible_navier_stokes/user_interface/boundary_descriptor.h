@@ -30,6 +30,7 @@
 
 // ExaDG
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
 namespace ExaDG
@@ -49,6 +50,21 @@ struct BoundaryDescriptorStd
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> neumann_bc;
 
+  // Vectorized representation of dirichlet_bc and neumann_bc evaluated by the matrix-free
+  // kernels, see set_vectorized_functions().
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    dirichlet_bc_vectorized;
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    neumann_bc_vectorized;
+
+  // has to be called once all boundary conditions have been prescribed
+  void
+  set_vectorized_functions()
+  {
+    dirichlet_bc_vectorized = make_function_vectorized(dirichlet_bc);
+    neumann_bc_vectorized   = make_function_vectorized(neumann_bc);
+  }
+
   // return the boundary type
   inline DEAL_II_ALWAYS_INLINE //
     BoundaryType
@@ -124,6 +140,16 @@ verify_boundary_conditions(BoundaryDescriptor<dim> const & boundary_descriptor,
   ExaDG::verify_boundary_conditions(boundary_descriptor.energy, grid);
 }
 
+template<int dim>
+inline void
+set_vectorized_functions(BoundaryDescriptor<dim> & boundary_descriptor)
+{
+  boundary_descriptor.density.set_vectorized_functions();
+  boundary_descriptor.velocity.set_vectorized_functions();
+  boundary_descriptor.pressure.set_vectorized_functions();
+  boundary_descriptor.energy.set_vectorized_functions();
+}
+
 } // namespace CompNS
 } // namespace ExaDG
 
@@ -58,6 +58,8 @@ Parameters::Parameters()
     diffusion_number(-1.),
     exponent_fe_degree_cfl(2.0),
     exponent_fe_degree_viscous(4.0),
+    n_rate_levels(1),
+    rate_levels_update_interval(10),
     // restart
     restarted_simulation(false),
     restart_data(RestartData()),
@@ -76,7 +78,10 @@ Parameters::Parameters()
 
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
-    use_combined_operator(false)
+    use_combined_operator(false),
+    use_combined_operator_single_integrator(false),
+    use_cell_based_face_loops(false),
+    use_fused_stage_updates(false)
 {
 }
 
@@ -120,6 +125,22 @@ Parameters::check() const
     AssertThrow(diffusion_number > 0.0, dealii::ExcMessage("parameter must be defined"));
   }
 
+  AssertThrow(n_rate_levels >= 1, dealii::ExcMessage("Invalid parameter n_rate_levels."));
+
+  if(n_rate_levels > 1)
+  {
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL ||
+                  calculation_of_time_step_size == TimeStepCalculation::Diffusion ||
+                  calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+                dealii::ExcMessage("Multirate time stepping requires a time step calculation "
+                                   "based on the CFL condition and/or the diffusion number."));
+
+    AssertThrow(use_combined_operator and use_combined_operator_single_integrator and
+                  not use_cell_based_face_loops,
+                dealii::ExcMessage("Multirate time stepping is only implemented for the combined "
+                                   "operator using a single integrator and face-based loops."));
+  }
+
 
   // SPATIAL DISCRETIZATION
   grid.check();
@@ -135,6 +156,31 @@ Parameters::check() const
   }
 
   // NUMERICAL PARAMETERS
+  if(use_combined_operator_single_integrator)
+  {
+    AssertThrow(use_combined_operator,
+                dealii::ExcMessage("A single integrator is only implemented for the combined "
+                                   "operator. Set use_combined_operator = true."));
+  }
+
+  if(use_cell_based_face_loops)
+  {
+    AssertThrow(use_combined_operator and use_combined_operator_single_integrator,
+                dealii::ExcMessage("Cell-based face loops are only implemented for the combined "
+                                   "operator using a single integrator."));
+  }
+
+  if(use_fused_stage_updates)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S ||
+                  temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2 ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage8Reg2,
+                dealii::ExcMessage(
+                  "Fused stage updates are only implemented for low-storage Runge-Kutta "
+                  "schemes with 2 registers."));
+  }
 }
 
 
@@ -214,6 +260,12 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Temporal refinements", n_refine_time);
 
+  if(n_rate_levels > 1)
+  {
+    print_parameter(pcout, "Number of rate levels", n_rate_levels);
+    print_parameter(pcout, "Update interval of rate levels", rate_levels_update_interval);
+  }
+
 
   // here we do not print quantities such as cfl_number, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -257,6 +309,12 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   print_parameter(pcout, "Detect instabilities", detect_instabilities);
   print_parameter(pcout, "Use combined operator", use_combined_operator);
+  if(use_combined_operator)
+  {
+    print_parameter(pcout, "Single integrator", use_combined_operator_single_integrator);
+    print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
+  }
+  print_parameter(pcout, "Use fused stage updates", use_fused_stage_updates);
 }
 
 } // namespace CompNS
@@ -152,6 +152,17 @@ public:
   // exponent of fe_degree used in the calculation of the diffusion time step size
   double exponent_fe_degree_viscous;
 
+  // number of rate levels of multirate (local) time stepping: cells are grouped into levels
+  // according to the local time step size, and level l (l = 0 being the finest level) is advanced
+  // with time step size 2^l times the time step size of the finest level. The default value of 1
+  // corresponds to global time stepping.
+  unsigned int n_rate_levels;
+
+  // the rate levels are recomputed every rate_levels_update_interval macro time steps, since the
+  // admissible local time step sizes change with the solution (0: rate levels are only computed
+  // at the beginning of the simulation)
+  unsigned int rate_levels_update_interval;
+
   // set this variable to true to start the simulation from restart files
   bool restarted_simulation;
 
@@ -192,6 +203,19 @@ public:
   // use combined operator for viscous term and convective term in order to improve run
   // time
   bool use_combined_operator;
+
+  // evaluate the combined operator with a single integrator for all dim + 2 components of the
+  // conserved variables instead of separate integrators for density, momentum and energy
+  bool use_combined_operator_single_integrator;
+
+  // use cell-based face loops (element-centric loops) for the combined operator, i.e., the faces
+  // of a cell are integrated within the cell loop so that the data of a cell is read only once
+  // per operator evaluation (requires use_combined_operator_single_integrator)
+  bool use_cell_based_face_loops;
+
+  // fuse the vector updates of low-storage Runge-Kutta stages with the application of the
+  // inverse mass operator in order to reduce memory transfer
+  bool use_fused_stage_updates;
 };
 
 } // namespace CompNS
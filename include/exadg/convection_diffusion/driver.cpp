@@ -112,6 +112,8 @@ Driver<dim, Number>::setup()
       time_integrator = create_time_integrator<dim, Number>(
         pde_operator, application->get_parameters(), mpi_comm, is_test, postprocessor);
 
+      time_integrator->set_dof_numbering_checksum(
+        compute_dof_numbering_checksum(pde_operator->get_dof_handler()));
       time_integrator->setup(application->get_parameters().restarted_simulation);
     }
     else if(application->get_parameters().problem_type == ProblemType::Steady)
@@ -33,7 +33,7 @@ namespace ConvDiff
 {
 template<int dim, typename Number>
 MultigridPreconditioner<dim, Number>::MultigridPreconditioner(MPI_Comm const & mpi_comm)
-  : Base(mpi_comm),
+  : Base(mpi_comm, "Multigrid convection-diffusion"),
     pde_operator(nullptr),
     mg_operator_type(MultigridOperatorType::Undefined),
     mesh_is_moving(false)
@@ -143,6 +143,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
   mass_operator_data.use_cell_based_loops = param.use_cell_based_face_loops;
   mass_operator_data.implement_block_diagonal_preconditioner_matrix_free =
     param.implement_block_diagonal_preconditioner_matrix_free;
+  mass_operator_data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+  mass_operator_data.block_diagonal_single_precision = param.block_diagonal_single_precision;
 
   mass_operator.initialize(*matrix_free, affine_constraints, mass_operator_data);
 
@@ -176,6 +178,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
     convective_operator_data.use_cell_based_loops = param.use_cell_based_face_loops;
     convective_operator_data.implement_block_diagonal_preconditioner_matrix_free =
       param.implement_block_diagonal_preconditioner_matrix_free;
+    convective_operator_data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+    convective_operator_data.block_diagonal_single_precision = param.block_diagonal_single_precision;
     convective_operator_data.kernel_data = convective_kernel_data;
 
     convective_operator.initialize(*matrix_free,
@@ -202,6 +206,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
     diffusive_operator_data.use_cell_based_loops = param.use_cell_based_face_loops;
     diffusive_operator_data.implement_block_diagonal_preconditioner_matrix_free =
       param.implement_block_diagonal_preconditioner_matrix_free;
+    diffusive_operator_data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+    diffusive_operator_data.block_diagonal_single_precision = param.block_diagonal_single_precision;
     diffusive_operator_data.kernel_data = diffusive_kernel_data;
 
     diffusive_operator.initialize(*matrix_free,
@@ -227,6 +233,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
     combined_operator_data.use_cell_based_loops = param.use_cell_based_face_loops;
     combined_operator_data.implement_block_diagonal_preconditioner_matrix_free =
       param.implement_block_diagonal_preconditioner_matrix_free;
+    combined_operator_data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+    combined_operator_data.block_diagonal_single_precision = param.block_diagonal_single_precision;
     combined_operator_data.solver_block_diagonal         = param.solver_block_diagonal;
     combined_operator_data.preconditioner_block_diagonal = param.preconditioner_block_diagonal;
     combined_operator_data.solver_data_block_diagonal    = param.solver_data_block_diagonal;
@@ -91,7 +91,7 @@ inline DEAL_II_ALWAYS_INLINE //
     {
       dealii::VectorizedArray<Number> g;
 
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+      auto bc       = boundary_descriptor->dirichlet_bc_vectorized.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       g = FunctionEvaluator<0, dim, Number>::value(bc, q_points, time);
@@ -194,7 +194,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full || operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
+      auto bc       = boundary_descriptor->neumann_bc_vectorized.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       auto h = FunctionEvaluator<0, dim, Number>::value(bc, q_points, time);
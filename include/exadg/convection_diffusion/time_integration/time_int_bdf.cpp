@@ -359,7 +359,7 @@ TimeIntBDF<dim, Number>::print_solver_info() const
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_vectors(RestartInputArchive<VectorType> & ia)
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
@@ -389,7 +389,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(RestartOutputArchive<VectorType> & oa) const
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
@@ -101,10 +101,10 @@ private:
   print_solver_info() const final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(RestartInputArchive<VectorType> & ia) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(RestartOutputArchive<VectorType> & oa) const final;
 
   void
   postprocessing() const final;
@@ -98,6 +98,7 @@ public:
     boundary_descriptor = std::make_shared<BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions(*boundary_descriptor, *grid);
+    boundary_descriptor->set_vectorized_functions();
 
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
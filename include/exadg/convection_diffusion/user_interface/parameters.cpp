@@ -77,6 +77,8 @@ Parameters::Parameters()
     update_preconditioner(false),
     update_preconditioner_every_time_steps(1),
     implement_block_diagonal_preconditioner_matrix_free(false),
+    compact_block_diagonal_storage(false),
+    block_diagonal_single_precision(false),
     solver_block_diagonal(Elementwise::Solver::Undefined),
     preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
@@ -323,6 +325,12 @@ Parameters::check() const
         "Invalid parameter. A solver type needs to be specified for elementwise matrix-free iterative solver."));
   }
 
+  AssertThrow(preconditioner_block_diagonal != Elementwise::Preconditioner::FastDiagonalization or
+                implement_block_diagonal_preconditioner_matrix_free,
+              dealii::ExcMessage("The fast diagonalization preconditioner is only available for "
+                                 "the matrix-free implementation of the block diagonal "
+                                 "preconditioner."));
+
   // NUMERICAL PARAMETERS
 }
 
@@ -540,6 +548,13 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
                   "Block Jacobi matrix-free",
                   implement_block_diagonal_preconditioner_matrix_free);
 
+  if(not(implement_block_diagonal_preconditioner_matrix_free))
+  {
+    print_parameter(pcout, "Block Jacobi compact storage", compact_block_diagonal_storage);
+    if(compact_block_diagonal_storage)
+      print_parameter(pcout, "Block Jacobi single precision", block_diagonal_single_precision);
+  }
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     print_parameter(pcout, "Solver block diagonal", enum_to_string(solver_block_diagonal));
@@ -263,6 +263,13 @@ public:
   // matrix-free operator evaluation
   bool implement_block_diagonal_preconditioner_matrix_free;
 
+  // Only relevant for the matrix-based block Jacobi preconditioner: store the LU factors of all
+  // cells in a compact format vectorized over cells, optionally in single precision, in order to
+  // reduce the memory consumption. The block matrices are assembled and factorized one cell batch
+  // at a time, which requires cell-based face loops for operators with face integrals.
+  bool compact_block_diagonal_storage;
+  bool block_diagonal_single_precision;
+
   // description: see enum declaration
   Elementwise::Solver solver_block_diagonal;
 
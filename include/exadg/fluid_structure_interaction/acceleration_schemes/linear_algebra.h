@@ -23,10 +23,23 @@
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_LINEAR_ALGEBRA_H_
 
 // C/C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 // deal.II
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/component_mask.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
 
 namespace ExaDG
 {
@@ -187,6 +200,350 @@ inv_jacobian_times_residual(VectorType &
   }
 }
 
+/*
+ * Same as above for vectors restricted to the locally owned interface DoFs, for which the
+ * inner products of one time step are summed over all processes in a single reduction.
+ */
+template<typename Number>
+void
+inv_jacobian_times_residual(
+  dealii::Vector<Number> &                                                  b,
+  std::vector<std::shared_ptr<std::vector<dealii::Vector<Number>>>> const & D_history,
+  std::vector<std::shared_ptr<std::vector<dealii::Vector<Number>>>> const & R_history,
+  std::vector<std::shared_ptr<std::vector<dealii::Vector<Number>>>> const & Z_history,
+  dealii::Vector<Number> const &                                            residual,
+  MPI_Comm const &                                                          mpi_comm)
+{
+  dealii::Vector<Number> a = residual;
+
+  // reset
+  b = 0.0;
+
+  for(int idx = Z_history.size() - 1; idx >= 0; --idx)
+  {
+    std::shared_ptr<std::vector<dealii::Vector<Number>>> D = D_history[idx];
+    std::shared_ptr<std::vector<dealii::Vector<Number>>> R = R_history[idx];
+    std::shared_ptr<std::vector<dealii::Vector<Number>>> Z = Z_history[idx];
+
+    int const           k = Z->size();
+    std::vector<Number> Z_times_a(k, 0.0);
+    for(int i = 0; i < k; ++i)
+      Z_times_a[i] = (*Z)[i] * a;
+    dealii::Utilities::MPI::sum(Z_times_a, mpi_comm, Z_times_a);
+
+    // add to b
+    for(int i = 0; i < k; ++i)
+      b.add(Z_times_a[i], (*D)[i]);
+
+    // add to a
+    for(int i = 0; i < k; ++i)
+      a.add(-Z_times_a[i], (*R)[i]);
+  }
+}
+
+/*
+ * Restriction of displacement vectors of the structure to the locally owned DoFs located at
+ * the fluid-structure interface. The Dirichlet-Neumann scheme only depends on the interface
+ * displacements, so that quasi-Newton methods can operate on these DoFs only.
+ */
+template<typename Number>
+class InterfaceRestriction
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  typedef dealii::Vector<Number>                             InterfaceVectorType;
+
+public:
+  template<int dim>
+  void
+  reinit(dealii::DoFHandler<dim> const &              dof_handler,
+         std::set<dealii::types::boundary_id> const & boundary_ids)
+  {
+    dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+    dealii::IndexSet const interface_dofs =
+      dealii::DoFTools::extract_boundary_dofs(dof_handler, dealii::ComponentMask(), boundary_ids) &
+      locally_owned_dofs;
+
+    local_indices.clear();
+    local_indices.reserve(interface_dofs.n_elements());
+    for(auto const dof : interface_dofs)
+      local_indices.push_back(locally_owned_dofs.index_within_set(dof));
+  }
+
+  void
+  initialize_vector(InterfaceVectorType & dst) const
+  {
+    dst.reinit(local_indices.size());
+  }
+
+  /*
+   * dst = src restricted to the interface
+   */
+  void
+  extract(InterfaceVectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < local_indices.size(); ++i)
+      dst[i] = src.local_element(local_indices[i]);
+  }
+
+  /*
+   * dst += factor * src on the interface DoFs
+   */
+  void
+  add(VectorType & dst, Number const factor, InterfaceVectorType const & src) const
+  {
+    for(unsigned int i = 0; i < local_indices.size(); ++i)
+      dst.local_element(local_indices[i]) += factor * src[i];
+  }
+
+private:
+  std::vector<unsigned int> local_indices;
+};
+
+/*
+ * QR decomposition V = Q U of a matrix whose columns v are added one after the other.
+ * The new column is orthogonalized by classical Gram-Schmidt with one reorthogonalization
+ * (CGS2), i.e., two global reductions per column. The right-hand side Q^T r of the
+ * least-squares problem is obtained in the first of these reductions. Columns that are
+ * (almost) linearly dependent on the columns in front of them are rejected, using the same
+ * criterion as compute_QR_decomposition(). Columns can also be inserted in front of existing
+ * columns, in which case the existing columns behind the new one that become linearly
+ * dependent are removed instead. The upper triangular form is then restored by Givens
+ * rotations, which require no communication.
+ */
+template<typename Number>
+class IncrementalQR
+{
+private:
+  typedef dealii::Vector<Number> InterfaceVectorType;
+
+public:
+  IncrementalQR(MPI_Comm const & comm, Number const tolerance = 1.e-2)
+    : mpi_comm(comm), eps(tolerance)
+  {
+  }
+
+  unsigned int
+  size() const
+  {
+    return U.size();
+  }
+
+  /*
+   * Appends column v and returns whether it has been accepted. In both cases, Q_times_r
+   * contains the vector Q^T r of the updated decomposition on return.
+   */
+  bool
+  append(InterfaceVectorType const & v,
+         InterfaceVectorType const & r,
+         std::vector<Number> &       Q_times_r)
+  {
+    std::vector<unsigned int> removed_columns;
+    return insert(size(), v, r, Q_times_r, removed_columns);
+  }
+
+  /*
+   * Inserts column v in front of column position and returns whether it has been accepted,
+   * i.e., whether v is not (almost) linearly dependent on the columns 0, ..., position-1.
+   * Columns behind the new column that become linearly dependent are removed, and their
+   * indices (at the time of removal) are appended to removed_columns. In all cases,
+   * Q_times_r contains the vector Q^T r of the updated decomposition on return.
+   */
+  bool
+  insert(unsigned int const          position,
+         InterfaceVectorType const & v,
+         InterfaceVectorType const & r,
+         std::vector<Number> &       Q_times_r,
+         std::vector<unsigned int> & removed_columns)
+  {
+    unsigned int const k = Q.size();
+
+    AssertIndexRange(position, k + 1);
+
+    // first pass
+    std::vector<Number> products(2 * k + 2, 0.0);
+    for(unsigned int j = 0; j < k; ++j)
+    {
+      products[j]     = Q[j] * v;
+      products[k + j] = Q[j] * r;
+    }
+    products[2 * k]     = v * v;
+    products[2 * k + 1] = v * r;
+    dealii::Utilities::MPI::sum(products, mpi_comm, products);
+
+    Q_times_r.assign(products.begin() + k, products.begin() + 2 * k);
+
+    Number const norm_sqr_initial = products[2 * k];
+
+    std::vector<Number> u(products.begin(), products.begin() + k);
+
+    InterfaceVectorType q = v;
+    for(unsigned int j = 0; j < k; ++j)
+      q.add(-u[j], Q[j]);
+
+    // second pass
+    std::vector<Number> corrections(k + 2, 0.0);
+    for(unsigned int j = 0; j < k; ++j)
+      corrections[j] = Q[j] * q;
+    corrections[k]     = q * q;
+    corrections[k + 1] = q * r;
+    dealii::Utilities::MPI::sum(corrections, mpi_comm, corrections);
+
+    for(unsigned int j = 0; j < k; ++j)
+    {
+      q.add(-corrections[j], Q[j]);
+      u[j] += corrections[j];
+    }
+
+    // the corrections are small after the first pass, so that the Pythagorean theorem can be
+    // applied to the norm of the orthogonalized column without cancellation
+    Number norm_sqr  = corrections[k];
+    Number q_times_r = corrections[k + 1];
+    for(unsigned int j = 0; j < k; ++j)
+    {
+      norm_sqr -= corrections[j] * corrections[j];
+      q_times_r -= corrections[j] * Q_times_r[j];
+    }
+    norm_sqr = std::max(norm_sqr, Number(0.0));
+
+    // diagonal entry of the new column once it has been moved to the given position
+    Number diagonal_sqr = norm_sqr;
+    for(unsigned int j = position; j < k; ++j)
+      diagonal_sqr += u[j] * u[j];
+
+    // drop if linear dependent on the columns in front of it
+    if(norm_sqr_initial == 0.0 or diagonal_sqr < eps * eps * norm_sqr_initial)
+      return false;
+
+    // a new direction is added unless v lies in the span of Q up to round-off, in which case
+    // one of the columns behind the new column is removed below
+    Number const u_kk = std::sqrt(norm_sqr);
+    if(u_kk > std::sqrt(std::numeric_limits<Number>::epsilon() * norm_sqr_initial))
+    {
+      q *= 1. / u_kk;
+      Q.push_back(std::move(q));
+
+      for(auto & column : U)
+        column.push_back(0.0);
+      u.push_back(u_kk);
+
+      Q_times_r.push_back(q_times_r / u_kk);
+    }
+
+    U.insert(U.begin() + position, std::move(u));
+    norms.insert(norms.begin() + position, std::sqrt(norm_sqr_initial));
+
+    // restore the upper triangular form
+    for(unsigned int i = Q.size() - 1; i-- > position;)
+      apply_givens_rotation(i, position, Q_times_r);
+
+    // remove the columns behind the new column that became linearly dependent
+    for(unsigned int j = position + 1; j < U.size();)
+    {
+      Number const diagonal = j < Q.size() ? std::abs(U[j][j]) : 0.0;
+      if(diagonal < eps * norms[j])
+      {
+        remove_column(j, Q_times_r);
+        removed_columns.push_back(j);
+      }
+      else
+      {
+        ++j;
+      }
+    }
+
+    AssertDimension(U.size(), Q.size());
+
+    return true;
+  }
+
+  std::vector<InterfaceVectorType> const &
+  get_Q() const
+  {
+    return Q;
+  }
+
+  Matrix<Number>
+  get_U() const
+  {
+    Matrix<Number> matrix(U.size());
+    for(unsigned int j = 0; j < U.size(); ++j)
+      for(unsigned int i = 0; i <= j; ++i)
+        matrix.set(U[j][i], i, j);
+
+    return matrix;
+  }
+
+private:
+  /*
+   * Eliminates entry (i+1, column) of U by a Givens rotation of the rows i, i+1 of U and Q^T r
+   * and of the columns i, i+1 of Q, which leaves the product Q U unchanged. The columns in
+   * front of column are zero in these rows.
+   */
+  void
+  apply_givens_rotation(unsigned int const    i,
+                        unsigned int const    column,
+                        std::vector<Number> & Q_times_r)
+  {
+    Number const rho = std::hypot(U[column][i], U[column][i + 1]);
+    if(rho == 0.0)
+      return;
+
+    Number const c = U[column][i] / rho;
+    Number const s = U[column][i + 1] / rho;
+
+    auto const rotate = [&](Number & x, Number & y) {
+      Number const x_old = x;
+      x                  = c * x_old + s * y;
+      y                  = -s * x_old + c * y;
+    };
+
+    for(unsigned int j = column; j < U.size(); ++j)
+      rotate(U[j][i], U[j][i + 1]);
+    U[column][i + 1] = 0.0;
+
+    rotate(Q_times_r[i], Q_times_r[i + 1]);
+
+    for(unsigned int l = 0; l < Q[i].size(); ++l)
+      rotate(Q[i][l], Q[i + 1][l]);
+  }
+
+  /*
+   * Removes column j of V and restores the upper triangular form of U. The last column of Q
+   * is dropped if it is no longer needed.
+   */
+  void
+  remove_column(unsigned int const j, std::vector<Number> & Q_times_r)
+  {
+    U.erase(U.begin() + j);
+    norms.erase(norms.begin() + j);
+
+    for(unsigned int i = j; i + 1 < Q.size() and i < U.size(); ++i)
+      apply_givens_rotation(i, i, Q_times_r);
+
+    if(U.size() < Q.size())
+    {
+      Q.pop_back();
+      Q_times_r.pop_back();
+      for(auto & column : U)
+        column.pop_back();
+    }
+  }
+
+  MPI_Comm const mpi_comm;
+
+  Number const eps;
+
+  std::vector<InterfaceVectorType> Q;
+
+  // columns of the upper triangular matrix U (with Q.size() rows)
+  std::vector<std::vector<Number>> U;
+
+  // norms of the columns of V
+  std::vector<Number> norms;
+};
+
 } // namespace FSI
 } // namespace ExaDG
 
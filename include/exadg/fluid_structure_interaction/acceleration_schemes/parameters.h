@@ -34,8 +34,10 @@ struct Parameters
       rel_tol(1.e-3),
       omega_init(0.1),
       reused_time_steps(0),
+      restrict_to_interface(false),
       partitioned_iter_max(100),
-      geometric_tolerance(1.e-10)
+      geometric_tolerance(1.e-10),
+      n_processes_structure(0)
   {
   }
 
@@ -69,6 +71,11 @@ struct Parameters
                         "Number of time steps reused for acceleration.",
                         dealii::Patterns::Integer(0, 100),
                         false);
+      prm.add_parameter("RestrictToInterface",
+                        restrict_to_interface,
+                        "Apply quasi-Newton methods to the interface DoFs of the structure only.",
+                        dealii::Patterns::Bool(),
+                        false);
       prm.add_parameter("PartitionedIterMax",
                         partitioned_iter_max,
                         "Maximum number of fixed-point iterations.",
@@ -79,6 +86,11 @@ struct Parameters
                         "Tolerance used to locate points at FSI interface.",
                         dealii::Patterns::Double(0.0, 1.0),
                         false);
+      prm.add_parameter("ProcessesStructure",
+                        n_processes_structure,
+                        "Number of processes dedicated to the structure (0: all processes).",
+                        dealii::Patterns::Integer(0),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
@@ -88,10 +100,21 @@ struct Parameters
   double       rel_tol;
   double       omega_init;
   unsigned int reused_time_steps;
+
+  // only relevant for quasi-Newton methods: if true, the least-squares problems are set up
+  // for the displacement DoFs at the fluid-structure interface instead of all DoFs of the
+  // structure, which reduces memory consumption and costs in case of many reused time steps
+  bool restrict_to_interface;
+
   unsigned int partitioned_iter_max;
 
   // tolerance used to locate points at the fluid-structure interface
   double geometric_tolerance;
+
+  // If 0, fluid and structure are solved one after the other on all processes. Otherwise,
+  // the structure is solved on the first n_processes_structure processes and the fluid
+  // (including the mesh motion) on the remaining processes.
+  unsigned int n_processes_structure;
 };
 } // namespace FSI
 } // namespace ExaDG
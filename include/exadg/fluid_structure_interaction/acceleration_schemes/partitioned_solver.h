@@ -42,17 +42,24 @@ class PartitionedSolver
 {
 private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  typedef dealii::Vector<Number>                             InterfaceVectorType;
+
+  typedef std::function<void(VectorType &, VectorType const &, unsigned int)> DirichletNeumann;
 
 public:
+  /*
+   * The communicator comm contains the processes on which the structure is solved. It is
+   * MPI_COMM_NULL on processes that only solve the fluid.
+   */
   PartitionedSolver(Parameters const & parameters, MPI_Comm const & comm);
 
   void
   setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-        std::shared_ptr<SolverStructure<dim, Number>> structure_);
+        std::shared_ptr<SolverStructure<dim, Number>> structure_,
+        std::set<dealii::types::boundary_id> const &  interface_boundary_ids);
 
   void
-  solve(std::function<void(VectorType &, VectorType const &, unsigned int)> const &
-          apply_dirichlet_neumann_scheme);
+  solve(DirichletNeumann const & apply_dirichlet_neumann_scheme);
 
   void
   print_iterations(dealii::ConditionalOStream const & pcout) const;
@@ -64,6 +71,26 @@ private:
   bool
   check_convergence(VectorType const & residual) const;
 
+  /*
+   * Variants of the quasi-Newton methods IQN-ILS and IQN-IMVLS operating on the interface
+   * DoFs only. Return the number of partitioned iterations.
+   */
+  unsigned int
+  solve_iqn_ils_interface(DirichletNeumann const & apply_dirichlet_neumann_scheme);
+
+  unsigned int
+  solve_iqn_imvls_interface(DirichletNeumann const & apply_dirichlet_neumann_scheme);
+
+  /*
+   * The fluid dictates the time stepping. If the fluid is solved on other processes, the
+   * structure is used instead, which performs the same time steps.
+   */
+  unsigned int
+  get_number_of_time_steps() const;
+
+  bool
+  print_solver_info() const;
+
   void
   print_solver_info_header(unsigned int const iteration) const;
 
@@ -72,6 +99,8 @@ private:
 
   Parameters parameters;
 
+  MPI_Comm const mpi_comm;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
@@ -81,6 +110,11 @@ private:
   // required for quasi-Newton methods
   std::vector<std::shared_ptr<std::vector<VectorType>>> D_history, R_history, Z_history;
 
+  // required for quasi-Newton methods restricted to the interface
+  InterfaceRestriction<Number> interface;
+  std::vector<std::shared_ptr<std::vector<InterfaceVectorType>>> D_history_interface,
+    R_history_interface, Z_history_interface;
+
   // Computation time (wall clock time).
   std::shared_ptr<TimerTree> timer_tree;
 
@@ -95,7 +129,9 @@ template<int dim, typename Number>
 PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
                                                   MPI_Comm const &   comm)
   : parameters(parameters),
-    pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
+    mpi_comm(comm),
+    pcout(std::cout,
+          comm != MPI_COMM_NULL and dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     partitioned_iterations({0, 0})
 {
   timer_tree = std::make_shared<TimerTree>();
@@ -103,11 +139,22 @@ PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
 
 template<int dim, typename Number>
 void
-PartitionedSolver<dim, Number>::setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-                                      std::shared_ptr<SolverStructure<dim, Number>> structure_)
+PartitionedSolver<dim, Number>::setup(
+  std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
+  std::shared_ptr<SolverStructure<dim, Number>> structure_,
+  std::set<dealii::types::boundary_id> const &  interface_boundary_ids)
 {
   fluid     = fluid_;
   structure = structure_;
+
+  if(parameters.restrict_to_interface)
+  {
+    AssertThrow(parameters.method == "IQN-ILS" or parameters.method == "IQN-IMVLS",
+                dealii::ExcMessage("The restriction to the interface is only available for "
+                                   "quasi-Newton methods."));
+
+    interface.reinit(structure->pde_operator->get_dof_handler(), interface_boundary_ids);
+  }
 }
 
 template<int dim, typename Number>
@@ -125,11 +172,31 @@ PartitionedSolver<dim, Number>::check_convergence(VectorType const & residual) c
   return converged;
 }
 
+template<int dim, typename Number>
+unsigned int
+PartitionedSolver<dim, Number>::get_number_of_time_steps() const
+{
+  if(fluid.get() != nullptr)
+    return fluid->time_integrator->get_number_of_time_steps();
+  else
+    return structure->time_integrator->get_number_of_time_steps();
+}
+
+template<int dim, typename Number>
+bool
+PartitionedSolver<dim, Number>::print_solver_info() const
+{
+  if(fluid.get() != nullptr)
+    return fluid->time_integrator->print_solver_info();
+  else
+    return structure->time_integrator->print_solver_info();
+}
+
 template<int dim, typename Number>
 void
 PartitionedSolver<dim, Number>::print_solver_info_header(unsigned int const iteration) const
 {
-  if(fluid->time_integrator->print_solver_info())
+  if(print_solver_info())
   {
     pcout << std::endl
           << "======================================================================" << std::endl
@@ -143,7 +210,7 @@ template<int dim, typename Number>
 void
 PartitionedSolver<dim, Number>::print_solver_info_converged(unsigned int const iteration) const
 {
-  if(fluid->time_integrator->print_solver_info())
+  if(print_solver_info())
   {
     pcout << std::endl
           << "Partitioned FSI iteration converged in " << iteration << " iterations." << std::endl;
@@ -172,11 +239,311 @@ PartitionedSolver<dim, Number>::get_timings() const
   return timer_tree;
 }
 
+template<int dim, typename Number>
+unsigned int
+PartitionedSolver<dim, Number>::solve_iqn_ils_interface(
+  DirichletNeumann const & apply_dirichlet_neumann_scheme)
+{
+  // iteration counter
+  unsigned int k = 0;
+
+  std::shared_ptr<std::vector<InterfaceVectorType>> D, R;
+  D = std::make_shared<std::vector<InterfaceVectorType>>();
+  R = std::make_shared<std::vector<InterfaceVectorType>>();
+
+  // at most one column is appended per iteration, so that pointers to the columns of D remain
+  // valid
+  D->reserve(parameters.partitioned_iter_max);
+  R->reserve(parameters.partitioned_iter_max);
+
+  // QR-decomposition of the residual differences (including reuse), which is updated in every
+  // iteration. The columns of the current time step come first, so that linearly dependent
+  // columns of previous time steps are dropped instead. D_all contains the corresponding
+  // differences of the displacements.
+  IncrementalQR<Number>                    QR(mpi_comm);
+  std::vector<InterfaceVectorType const *> D_all;
+  unsigned int                             n_columns_current = 0;
+
+  VectorType d, d_tilde, r;
+  structure->pde_operator->initialize_dof_vector(d);
+  structure->pde_operator->initialize_dof_vector(d_tilde);
+  structure->pde_operator->initialize_dof_vector(r);
+
+  InterfaceVectorType d_tilde_interface, d_tilde_old_interface, r_interface, r_old_interface;
+  interface.initialize_vector(d_tilde_interface);
+  interface.initialize_vector(d_tilde_old_interface);
+  interface.initialize_vector(r_interface);
+  interface.initialize_vector(r_old_interface);
+
+  unsigned int const q = parameters.reused_time_steps;
+  unsigned int const n = get_number_of_time_steps();
+
+  bool converged = false;
+  while(not(converged) and k < parameters.partitioned_iter_max)
+  {
+    print_solver_info_header(k);
+
+    if(k == 0)
+      structure->time_integrator->extrapolate_displacement_to_np(d);
+    else
+      d = structure->time_integrator->get_displacement_np();
+
+    apply_dirichlet_neumann_scheme(d_tilde, d, k);
+
+    // compute residual and check convergence
+    r = d_tilde;
+    r.add(-1.0, d);
+    converged = check_convergence(r);
+
+    // relaxation
+    if(not(converged))
+    {
+      dealii::Timer timer;
+      timer.restart();
+
+      interface.extract(d_tilde_interface, d_tilde);
+      interface.extract(r_interface, r);
+
+      if(k == 0 and (q == 0 or n == 0))
+      {
+        d.add(parameters.omega_init, r);
+      }
+      else
+      {
+        std::vector<Number> Q_times_r;
+        if(k == 0)
+        {
+          for(unsigned int idx = 0; idx < R_history_interface.size(); ++idx)
+          {
+            for(unsigned int i = 0; i < R_history_interface[idx]->size(); ++i)
+            {
+              if(QR.append((*R_history_interface[idx])[i], r_interface, Q_times_r))
+                D_all.push_back(&(*D_history_interface[idx])[i]);
+            }
+          }
+        }
+        else
+        {
+          // append D, R matrices
+          D->push_back(d_tilde_interface);
+          D->back().add(-1.0, d_tilde_old_interface);
+
+          R->push_back(r_interface);
+          R->back().add(-1.0, r_old_interface);
+
+          // insert the new column behind the columns of the current time step
+          std::vector<unsigned int> removed_columns;
+          if(QR.insert(n_columns_current, R->back(), r_interface, Q_times_r, removed_columns))
+          {
+            D_all.insert(D_all.begin() + n_columns_current, &D->back());
+            ++n_columns_current;
+          }
+
+          for(auto const j : removed_columns)
+            D_all.erase(D_all.begin() + j);
+        }
+
+        unsigned int const k_all = QR.size();
+        if(k_all >= 1)
+        {
+          std::vector<Number> rhs(k_all, 0.0);
+          for(unsigned int i = 0; i < k_all; ++i)
+            rhs[i] = -Q_times_r[i];
+
+          // alpha = U^{-1} rhs
+          std::vector<Number> alpha(k_all, 0.0);
+          backward_substitution(QR.get_U(), alpha, rhs);
+
+          // d_{k+1} = d_tilde_{k} + delta d_tilde, where delta d_tilde is non-zero at the
+          // interface only
+          d = d_tilde;
+          for(unsigned int i = 0; i < k_all; ++i)
+            interface.add(d, alpha[i], *D_all[i]);
+        }
+        else // despite reuse, the vectors might be empty
+        {
+          d.add(parameters.omega_init, r);
+        }
+      }
+
+      d_tilde_old_interface = d_tilde_interface;
+      r_old_interface       = r_interface;
+
+      structure->time_integrator->set_displacement(d);
+
+      timer_tree->insert({"IQN-ILS"}, timer.wall_time());
+    }
+
+    // increment counter of partitioned iteration
+    ++k;
+  }
+
+  dealii::Timer timer;
+  timer.restart();
+
+  // Update history
+  D_history_interface.push_back(D);
+  R_history_interface.push_back(R);
+  if(D_history_interface.size() > q)
+    D_history_interface.erase(D_history_interface.begin());
+  if(R_history_interface.size() > q)
+    R_history_interface.erase(R_history_interface.begin());
+
+  timer_tree->insert({"IQN-ILS"}, timer.wall_time());
+
+  return k;
+}
+
+template<int dim, typename Number>
+unsigned int
+PartitionedSolver<dim, Number>::solve_iqn_imvls_interface(
+  DirichletNeumann const & apply_dirichlet_neumann_scheme)
+{
+  // iteration counter
+  unsigned int k = 0;
+
+  // only columns accepted by the QR-decomposition are stored
+  std::shared_ptr<std::vector<InterfaceVectorType>> D, R;
+  D = std::make_shared<std::vector<InterfaceVectorType>>();
+  R = std::make_shared<std::vector<InterfaceVectorType>>();
+
+  std::vector<InterfaceVectorType> B;
+
+  IncrementalQR<Number> QR(mpi_comm);
+
+  VectorType d, d_tilde, r;
+  structure->pde_operator->initialize_dof_vector(d);
+  structure->pde_operator->initialize_dof_vector(d_tilde);
+  structure->pde_operator->initialize_dof_vector(r);
+
+  InterfaceVectorType d_tilde_interface, d_tilde_old_interface, r_interface, r_old_interface, b,
+    b_old;
+  interface.initialize_vector(d_tilde_interface);
+  interface.initialize_vector(d_tilde_old_interface);
+  interface.initialize_vector(r_interface);
+  interface.initialize_vector(r_old_interface);
+  interface.initialize_vector(b);
+  interface.initialize_vector(b_old);
+
+  unsigned int const q = parameters.reused_time_steps;
+  unsigned int const n = get_number_of_time_steps();
+
+  bool converged = false;
+  while(not converged and k < parameters.partitioned_iter_max)
+  {
+    print_solver_info_header(k);
+
+    if(k == 0)
+      structure->time_integrator->extrapolate_displacement_to_np(d);
+    else
+      d = structure->time_integrator->get_displacement_np();
+
+    apply_dirichlet_neumann_scheme(d_tilde, d, k);
+
+    // compute residual and check convergence
+    r = d_tilde;
+    r.add(-1.0, d);
+    converged = check_convergence(r);
+
+    // relaxation
+    if(not(converged))
+    {
+      dealii::Timer timer;
+      timer.restart();
+
+      interface.extract(d_tilde_interface, d_tilde);
+      interface.extract(r_interface, r);
+
+      // compute b vector
+      inv_jacobian_times_residual(
+        b, D_history_interface, R_history_interface, Z_history_interface, r_interface, mpi_comm);
+
+      if(k == 0 and (q == 0 or n == 0))
+      {
+        d.add(parameters.omega_init, r);
+      }
+      else
+      {
+        d = d_tilde;
+        interface.add(d, -1.0, b);
+
+        if(k >= 1)
+        {
+          InterfaceVectorType delta_d_tilde = d_tilde_interface;
+          delta_d_tilde.add(-1.0, d_tilde_old_interface);
+
+          InterfaceVectorType delta_r = r_interface;
+          delta_r.add(-1.0, r_old_interface);
+
+          // append D, R, B matrices if the new column is not linearly dependent
+          std::vector<Number> Q_times_r;
+          if(QR.append(delta_r, r_interface, Q_times_r))
+          {
+            InterfaceVectorType delta_b = delta_d_tilde;
+            delta_b.add(1.0, b_old);
+            delta_b.add(-1.0, b);
+            B.push_back(delta_b);
+
+            D->push_back(delta_d_tilde);
+            R->push_back(delta_r);
+          }
+
+          unsigned int const k_all = QR.size();
+
+          std::vector<Number> rhs(k_all, 0.0);
+          for(unsigned int i = 0; i < k_all; ++i)
+            rhs[i] = -Q_times_r[i];
+
+          // alpha = U^{-1} rhs
+          std::vector<Number> alpha(k_all, 0.0);
+          backward_substitution(QR.get_U(), alpha, rhs);
+
+          for(unsigned int i = 0; i < k_all; ++i)
+            interface.add(d, alpha[i], B[i]);
+        }
+      }
+
+      d_tilde_old_interface = d_tilde_interface;
+      r_old_interface       = r_interface;
+      b_old                 = b;
+
+      structure->time_integrator->set_displacement(d);
+
+      timer_tree->insert({"IQN-IMVLS"}, timer.wall_time());
+    }
+
+    // increment counter of partitioned iteration
+    ++k;
+  }
+
+  dealii::Timer timer;
+  timer.restart();
+
+  // Update history
+  D_history_interface.push_back(D);
+  R_history_interface.push_back(R);
+  if(D_history_interface.size() > q)
+    D_history_interface.erase(D_history_interface.begin());
+  if(R_history_interface.size() > q)
+    R_history_interface.erase(R_history_interface.begin());
+
+  // compute Z and add to Z_history
+  std::shared_ptr<std::vector<InterfaceVectorType>> Z;
+  Z = std::make_shared<std::vector<InterfaceVectorType>>(QR.get_Q()); // correct size
+  backward_substitution_multiple_rhs(QR.get_U(), *Z, QR.get_Q());
+  Z_history_interface.push_back(Z);
+  if(Z_history_interface.size() > q)
+    Z_history_interface.erase(Z_history_interface.begin());
+
+  timer_tree->insert({"IQN-IMVLS"}, timer.wall_time());
+
+  return k;
+}
+
 template<int dim, typename Number>
 void
 PartitionedSolver<dim, Number>::solve(
-  std::function<void(VectorType &, VectorType const &, unsigned int)> const &
-    apply_dirichlet_neumann_scheme)
+  DirichletNeumann const & apply_dirichlet_neumann_scheme)
 {
   // iteration counter
   unsigned int k = 0;
@@ -236,6 +603,14 @@ PartitionedSolver<dim, Number>::solve(
       ++k;
     }
   }
+  else if(parameters.method == "IQN-ILS" and parameters.restrict_to_interface)
+  {
+    k = solve_iqn_ils_interface(apply_dirichlet_neumann_scheme);
+  }
+  else if(parameters.method == "IQN-IMVLS" and parameters.restrict_to_interface)
+  {
+    k = solve_iqn_imvls_interface(apply_dirichlet_neumann_scheme);
+  }
   else if(parameters.method == "IQN-ILS")
   {
     std::shared_ptr<std::vector<VectorType>> D, R;
@@ -250,7 +625,7 @@ PartitionedSolver<dim, Number>::solve(
     structure->pde_operator->initialize_dof_vector(r_old);
 
     unsigned int const q = parameters.reused_time_steps;
-    unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
+    unsigned int const n = get_number_of_time_steps();
 
     bool converged = false;
     while(not(converged) and k < parameters.partitioned_iter_max)
@@ -378,7 +753,7 @@ PartitionedSolver<dim, Number>::solve(
     std::vector<VectorType>         Q;
 
     unsigned int const q = parameters.reused_time_steps;
-    unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
+    unsigned int const n = get_number_of_time_steps();
 
     bool converged = false;
     while(not converged and k < parameters.partitioned_iter_max)
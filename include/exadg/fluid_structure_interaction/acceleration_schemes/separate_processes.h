@@ -0,0 +1,69 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_SEPARATE_PROCESSES_H_
+#define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_SEPARATE_PROCESSES_H_
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+namespace FSI
+{
+/*
+ * Protocol of the partitioned iterations in case the structure is solved on separate
+ * processes. The communicator comm contains all processes, the processes of the structure
+ * come first. The processes of the structure run the partitioned solver and call
+ * broadcast_next_iteration(comm, true) before every partitioned iteration and
+ * broadcast_next_iteration(comm, false) once the partitioned solver has finished. The
+ * processes of the fluid follow these iterations by means of follow_partitioned_iterations(),
+ * so that the data exchange between fluid and structure within an iteration is collective
+ * over comm.
+ */
+inline bool
+broadcast_next_iteration(MPI_Comm const & comm, bool const next_iteration)
+{
+  return dealii::Utilities::MPI::broadcast(comm, next_iteration, 0);
+}
+
+/*
+ * Calls iteration(k) for every partitioned iteration k announced by the processes of the
+ * structure and returns the number of iterations.
+ */
+template<typename Iteration>
+unsigned int
+follow_partitioned_iterations(MPI_Comm const & comm, Iteration const & iteration)
+{
+  unsigned int k = 0;
+  while(broadcast_next_iteration(comm, false))
+  {
+    iteration(k);
+    ++k;
+  }
+
+  return k;
+}
+
+} // namespace FSI
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_SEPARATE_PROCESSES_H_ */
@@ -34,7 +34,13 @@ Driver<dim, Number>::Driver(std::string const &                           input_
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test)
   : mpi_comm(comm),
+    mpi_comm_structure(comm),
+    mpi_comm_fluid(comm),
+    is_structure_process(true),
+    is_fluid_process(true),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
+    pcout_structure(std::cout, false),
+    pcout_fluid(std::cout, false),
     is_test(is_test),
     application(app)
 {
@@ -44,10 +50,95 @@ Driver<dim, Number>::Driver(std::string const &                           input_
   parameters.add_parameters(prm);
   prm.parse_input(input_file, "", true, true);
 
+  setup_communicators();
+
   structure = std::make_shared<SolverStructure<dim, Number>>();
   fluid     = std::make_shared<SolverFluid<dim, Number>>();
 
-  partitioned_solver = std::make_shared<PartitionedSolver<dim, Number>>(parameters, mpi_comm);
+  partitioned_solver =
+    std::make_shared<PartitionedSolver<dim, Number>>(parameters, mpi_comm_structure);
+}
+
+template<int dim, typename Number>
+Driver<dim, Number>::~Driver()
+{
+  if(separate_processes())
+  {
+    partitioned_solver.reset();
+    structure_to_fluid.reset();
+    structure_to_ale.reset();
+    fluid_to_structure.reset();
+    structure.reset();
+    fluid.reset();
+    application.reset();
+
+    MPI_Comm sub_comm = is_structure_process ? mpi_comm_structure : mpi_comm_fluid;
+    MPI_Comm_free(&sub_comm);
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_communicators()
+{
+  if(separate_processes())
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+    unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    AssertThrow(parameters.n_processes_structure < n_processes,
+                dealii::ExcMessage("At least one process has to be left for the fluid."));
+
+    is_structure_process = (rank < parameters.n_processes_structure);
+    is_fluid_process     = not(is_structure_process);
+
+    // The communicator is freed in the destructor.
+    MPI_Comm sub_comm;
+    MPI_Comm_split(mpi_comm, is_structure_process ? 0 : 1, rank, &sub_comm);
+
+    mpi_comm_structure = is_structure_process ? sub_comm : MPI_COMM_NULL;
+    mpi_comm_fluid     = is_fluid_process ? sub_comm : MPI_COMM_NULL;
+
+    pcout << std::endl
+          << "Structure is solved on " << parameters.n_processes_structure << " of "
+          << n_processes << " processes." << std::endl;
+  }
+
+  pcout_structure.set_condition(is_structure_process and
+                                dealii::Utilities::MPI::this_mpi_process(mpi_comm_structure) == 0);
+  pcout_fluid.set_condition(is_fluid_process and
+                            dealii::Utilities::MPI::this_mpi_process(mpi_comm_fluid) == 0);
+}
+
+template<int dim, typename Number>
+bool
+Driver<dim, Number>::separate_processes() const
+{
+  return parameters.n_processes_structure > 0;
+}
+
+template<int dim, typename Number>
+template<typename T>
+T
+Driver<dim, Number>::broadcast_from_fluid(T const & value) const
+{
+  if(separate_processes())
+  {
+    // the fluid processes are the last processes of mpi_comm
+    return dealii::Utilities::MPI::broadcast(mpi_comm, value, parameters.n_processes_structure);
+  }
+  else
+  {
+    return value;
+  }
+}
+
+template<int dim, typename Number>
+bool
+Driver<dim, Number>::finished() const
+{
+  // The fluid domain is the master that dictates when the time loop is finished
+  return broadcast_from_fluid(is_fluid_process ? fluid->time_integrator->finished() : false);
 }
 
 template<int dim, typename Number>
@@ -63,40 +154,103 @@ Driver<dim, Number>::setup()
   {
     dealii::Timer timer_local;
 
-    application->setup();
+    if(is_structure_process)
+    {
+      application->structure->set_mpi_comm(mpi_comm_structure);
+      application->structure->setup();
+    }
+
+    if(is_fluid_process)
+    {
+      application->fluid->set_mpi_comm(mpi_comm_fluid);
+      application->fluid->setup();
+    }
 
     timer_tree.insert({"FSI", "Setup", "Application"}, timer_local.wall_time());
   }
 
   // setup structure
+  if(is_structure_process)
   {
     dealii::Timer timer_local;
 
-    structure->setup(application->structure, mpi_comm, is_test);
+    structure->setup(application->structure, mpi_comm_structure, is_test);
 
     timer_tree.insert({"FSI", "Setup", "Structure"}, timer_local.wall_time());
   }
 
   // setup fluid
+  if(is_fluid_process)
   {
     dealii::Timer timer_local;
 
-    fluid->setup(application->fluid, mpi_comm, is_test);
+    fluid->setup(application->fluid, mpi_comm_fluid, is_test);
 
     timer_tree.insert({"FSI", "Setup", "Fluid"}, timer_local.wall_time());
   }
 
   setup_interface_coupling();
 
-  partitioned_solver->setup(fluid, structure);
+  if(is_structure_process)
+  {
+    auto const interface_boundary_ids = extract_set_of_keys_from_map(
+      application->structure->get_boundary_descriptor()->neumann_cached_bc);
+    partitioned_solver->setup(is_fluid_process ? fluid : nullptr,
+                              structure,
+                              interface_boundary_ids);
+  }
 
   timer_tree.insert({"FSI", "Setup"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_coupling(
+  InterfaceCoupling<dim, dim, Number> &                   coupling,
+  std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_dst,
+  dealii::DoFHandler<dim> const *                         dof_handler_src,
+  dealii::Mapping<dim> const *                            mapping_src,
+  std::vector<bool> const &                               marked_vertices_src) const
+{
+  if(separate_processes())
+  {
+    coupling.setup(interface_data_dst,
+                   dof_handler_src,
+                   mapping_src,
+                   marked_vertices_src,
+                   parameters.geometric_tolerance,
+                   mpi_comm);
+  }
+  else
+  {
+    coupling.setup(interface_data_dst,
+                   *dof_handler_src,
+                   *mapping_src,
+                   marked_vertices_src,
+                   parameters.geometric_tolerance);
+  }
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::setup_interface_coupling()
 {
+  // The src-side and dst-side data below are only available on the processes of the
+  // respective field and remain uninitialized on the other processes.
+  std::vector<bool>               marked_vertices_structure;
+  dealii::DoFHandler<dim> const * dof_handler_structure = nullptr;
+  dealii::Mapping<dim> const *    mapping_structure     = nullptr;
+  if(is_structure_process)
+  {
+    auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
+    auto const   boundary_ids = extract_set_of_keys_from_map(
+      application->structure->get_boundary_descriptor()->neumann_cached_bc);
+    marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+
+    dof_handler_structure = &structure->pde_operator->get_dof_handler();
+    mapping_structure     = application->structure->get_grid()->mapping.get();
+  }
+
   // structure to ALE
   {
     dealii::Timer timer_local;
@@ -104,36 +258,33 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling structure -> ALE ..." << std::endl;
 
-    auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->structure->get_boundary_descriptor()->neumann_cached_bc);
-    auto const marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
-
-    if(application->fluid->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
+    std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_ale;
+    if(is_fluid_process)
     {
-      structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-      structure_to_ale->setup(fluid->ale_poisson_operator->get_container_interface_data(),
-                              structure->pde_operator->get_dof_handler(),
-                              *application->structure->get_grid()->mapping,
-                              marked_vertices_structure,
-                              parameters.geometric_tolerance);
-    }
-    else if(application->fluid->get_parameters().mesh_movement_type ==
-            IncNS::MeshMovementType::Elasticity)
-    {
-      structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-      structure_to_ale->setup(
-        fluid->ale_elasticity_operator->get_container_interface_data_dirichlet(),
-        structure->pde_operator->get_dof_handler(),
-        *application->structure->get_grid()->mapping,
-        marked_vertices_structure,
-        parameters.geometric_tolerance);
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("not implemented."));
+      if(application->fluid->get_parameters().mesh_movement_type ==
+         IncNS::MeshMovementType::Poisson)
+      {
+        interface_data_ale = fluid->ale_poisson_operator->get_container_interface_data();
+      }
+      else if(application->fluid->get_parameters().mesh_movement_type ==
+              IncNS::MeshMovementType::Elasticity)
+      {
+        interface_data_ale =
+          fluid->ale_elasticity_operator->get_container_interface_data_dirichlet();
+      }
+      else
+      {
+        AssertThrow(false, dealii::ExcMessage("not implemented."));
+      }
     }
 
+    structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
+    setup_coupling(*structure_to_ale,
+                   interface_data_ale,
+                   dof_handler_structure,
+                   mapping_structure,
+                   marked_vertices_structure);
+
     pcout << std::endl << "... done!" << std::endl;
 
     timer_tree.insert({"FSI", "Setup", "Coupling structure -> ALE"}, timer_local.wall_time());
@@ -146,17 +297,16 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling structure -> fluid ..." << std::endl;
 
-    auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->structure->get_boundary_descriptor()->neumann_cached_bc);
-    auto const marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+    std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_fluid;
+    if(is_fluid_process)
+      interface_data_fluid = fluid->pde_operator->get_container_interface_data();
 
     structure_to_fluid = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-    structure_to_fluid->setup(fluid->pde_operator->get_container_interface_data(),
-                              structure->pde_operator->get_dof_handler(),
-                              *application->structure->get_grid()->mapping,
-                              marked_vertices_structure,
-                              parameters.geometric_tolerance);
+    setup_coupling(*structure_to_fluid,
+                   interface_data_fluid,
+                   dof_handler_structure,
+                   mapping_structure,
+                   marked_vertices_structure);
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -170,20 +320,32 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling fluid -> structure ..." << std::endl;
 
-    std::shared_ptr<dealii::Mapping<dim> const> mapping_fluid =
-      get_dynamic_mapping<dim, Number>(application->fluid->get_grid(), fluid->ale_grid_motion);
+    std::shared_ptr<dealii::Mapping<dim> const> mapping_fluid;
+    std::vector<bool>                           marked_vertices_fluid;
+    dealii::DoFHandler<dim> const *             dof_handler_fluid = nullptr;
+    if(is_fluid_process)
+    {
+      mapping_fluid =
+        get_dynamic_mapping<dim, Number>(application->fluid->get_grid(), fluid->ale_grid_motion);
 
-    auto const & tria         = fluid->pde_operator->get_dof_handler_u().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->fluid->get_boundary_descriptor()->velocity->dirichlet_cached_bc);
-    auto const marked_vertices_fluid = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+      auto const & tria         = fluid->pde_operator->get_dof_handler_u().get_triangulation();
+      auto const   boundary_ids = extract_set_of_keys_from_map(
+        application->fluid->get_boundary_descriptor()->velocity->dirichlet_cached_bc);
+      marked_vertices_fluid = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+
+      dof_handler_fluid = &fluid->pde_operator->get_dof_handler_u();
+    }
+
+    std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_structure;
+    if(is_structure_process)
+      interface_data_structure = structure->pde_operator->get_container_interface_data_neumann();
 
     fluid_to_structure = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-    fluid_to_structure->setup(structure->pde_operator->get_container_interface_data_neumann(),
-                              fluid->pde_operator->get_dof_handler_u(),
-                              *mapping_fluid,
-                              marked_vertices_fluid,
-                              parameters.geometric_tolerance);
+    setup_coupling(*fluid_to_structure,
+                   interface_data_structure,
+                   dof_handler_fluid,
+                   mapping_fluid.get(),
+                   marked_vertices_fluid);
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -196,7 +358,11 @@ void
 Driver<dim, Number>::set_start_time() const
 {
   // The fluid domain is the master that dictates the start time
-  structure->time_integrator->reset_time(fluid->time_integrator->get_time());
+  double const time =
+    broadcast_from_fluid(is_fluid_process ? fluid->time_integrator->get_time() : 0.0);
+
+  if(is_structure_process)
+    structure->time_integrator->reset_time(time);
 }
 
 template<int dim, typename Number>
@@ -204,8 +370,11 @@ void
 Driver<dim, Number>::synchronize_time_step_size() const
 {
   // The fluid domain is the master that dictates the time step size
-  structure->time_integrator->set_current_time_step_size(
-    fluid->time_integrator->get_time_step_size());
+  double const time_step_size =
+    broadcast_from_fluid(is_fluid_process ? fluid->time_integrator->get_time_step_size() : 0.0);
+
+  if(is_structure_process)
+    structure->time_integrator->set_current_time_step_size(time_step_size);
 }
 
 template<int dim, typename Number>
@@ -227,11 +396,14 @@ Driver<dim, Number>::coupling_structure_to_fluid(bool const extrapolate) const
   sub_timer.restart();
 
   VectorType velocity_structure;
-  structure->pde_operator->initialize_dof_vector(velocity_structure);
-  if(extrapolate)
-    structure->time_integrator->extrapolate_velocity_to_np(velocity_structure);
-  else
-    velocity_structure = structure->time_integrator->get_velocity_np();
+  if(is_structure_process)
+  {
+    structure->pde_operator->initialize_dof_vector(velocity_structure);
+    if(extrapolate)
+      structure->time_integrator->extrapolate_velocity_to_np(velocity_structure);
+    else
+      velocity_structure = structure->time_integrator->get_velocity_np();
+  }
 
   structure_to_fluid->update_data(velocity_structure);
 
@@ -246,22 +418,26 @@ Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) co
   sub_timer.restart();
 
   VectorType stress_fluid;
-  fluid->pde_operator->initialize_vector_velocity(stress_fluid);
-  // calculate fluid stress at fluid-structure interface
-  if(end_of_time_step)
-  {
-    fluid->pde_operator->interpolate_stress_bc(stress_fluid,
-                                               fluid->time_integrator->get_velocity_np(),
-                                               fluid->time_integrator->get_pressure_np());
-  }
-  else
+  if(is_fluid_process)
   {
-    fluid->pde_operator->interpolate_stress_bc(stress_fluid,
-                                               fluid->time_integrator->get_velocity(),
-                                               fluid->time_integrator->get_pressure());
+    fluid->pde_operator->initialize_vector_velocity(stress_fluid);
+    // calculate fluid stress at fluid-structure interface
+    if(end_of_time_step)
+    {
+      fluid->pde_operator->interpolate_stress_bc(stress_fluid,
+                                                 fluid->time_integrator->get_velocity_np(),
+                                                 fluid->time_integrator->get_pressure_np());
+    }
+    else
+    {
+      fluid->pde_operator->interpolate_stress_bc(stress_fluid,
+                                                 fluid->time_integrator->get_velocity(),
+                                                 fluid->time_integrator->get_pressure());
+    }
+
+    stress_fluid *= -1.0;
   }
 
-  stress_fluid *= -1.0;
   fluid_to_structure->update_data(stress_fluid);
 
   timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
@@ -276,21 +452,26 @@ Driver<dim, Number>::apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
   coupling_structure_to_ale(d);
 
   // move the fluid mesh and update dependent data structures
-  fluid->solve_ale(application->fluid, is_test);
+  if(is_fluid_process)
+    fluid->solve_ale(application->fluid, is_test);
 
   // update velocity boundary condition for fluid
   coupling_structure_to_fluid(iteration == 0);
 
   // solve fluid problem
-  fluid->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+  if(is_fluid_process)
+    fluid->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
 
   // update stress boundary condition for solid
   coupling_fluid_to_structure(/* end_of_time_step = */ true);
 
   // solve structural problem
-  structure->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+  if(is_structure_process)
+  {
+    structure->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
 
-  d_tilde = structure->time_integrator->get_displacement_np();
+    d_tilde = structure->time_integrator->get_displacement_np();
+  }
 }
 
 template<int dim, typename Number>
@@ -301,35 +482,67 @@ Driver<dim, Number>::solve() const
 
   synchronize_time_step_size();
 
+  bool const adaptive_time_stepping = broadcast_from_fluid(
+    is_fluid_process ? application->fluid->get_parameters().adaptive_time_stepping : false);
+
   // compute initial acceleration for structural problem
   {
     // update stress boundary condition for solid at time t_n (not t_{n+1})
     coupling_fluid_to_structure(/* end_of_time_step = */ false);
-    structure->time_integrator->compute_initial_acceleration(
-      application->structure->get_parameters().restarted_simulation);
+
+    if(is_structure_process)
+    {
+      structure->time_integrator->compute_initial_acceleration(
+        application->structure->get_parameters().restarted_simulation);
+    }
   }
 
   // The fluid domain is the master that dictates when the time loop is finished
-  while(!fluid->time_integrator->finished())
+  while(not(finished()))
   {
     // pre-solve
-    fluid->time_integrator->advance_one_timestep_pre_solve(true);
-    structure->time_integrator->advance_one_timestep_pre_solve(false);
+    if(is_fluid_process)
+      fluid->time_integrator->advance_one_timestep_pre_solve(true);
+    if(is_structure_process)
+      structure->time_integrator->advance_one_timestep_pre_solve(false);
 
     // solve (using strongly-coupled partitioned scheme)
-    auto const lambda_dirichlet_neumann =
-      [&](VectorType & d_tilde, VectorType const & d, unsigned int k) {
+    if(is_structure_process)
+    {
+      auto const lambda_dirichlet_neumann =
+        [&](VectorType & d_tilde, VectorType const & d, unsigned int k) {
+          if(separate_processes())
+            broadcast_next_iteration(mpi_comm, true);
+
+          apply_dirichlet_neumann_scheme(d_tilde, d, k);
+        };
+      partitioned_solver->solve(lambda_dirichlet_neumann);
+
+      if(separate_processes())
+        broadcast_next_iteration(mpi_comm, false);
+    }
+    else
+    {
+      // the processes of the fluid follow the iterations of the partitioned solver, the
+      // displacement vectors are only accessed on the processes of the structure
+      VectorType d_tilde, d;
+      follow_partitioned_iterations(mpi_comm, [&](unsigned int const k) {
         apply_dirichlet_neumann_scheme(d_tilde, d, k);
-      };
-    partitioned_solver->solve(lambda_dirichlet_neumann);
+      });
+    }
 
-    // post-solve
-    fluid->time_integrator->advance_one_timestep_post_solve();
-    structure->time_integrator->advance_one_timestep_post_solve();
+    // post-solve (concurrently on separate processes)
+    if(is_fluid_process)
+      fluid->time_integrator->advance_one_timestep_post_solve();
+    if(is_structure_process)
+      structure->time_integrator->advance_one_timestep_post_solve();
 
-    if(application->fluid->get_parameters().adaptive_time_stepping)
+    if(adaptive_time_stepping)
       synchronize_time_step_size();
   }
+
+  if(is_fluid_process)
+    fluid->postprocessor->finalize();
 }
 
 template<int dim, typename Number>
@@ -349,57 +562,123 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "FSI:" << std::endl;
   partitioned_solver->print_iterations(pcout);
 
-  pcout << std::endl << "Fluid:" << std::endl;
-  fluid->time_integrator->print_iterations();
+  // In case of separate processes, the results of the fluid are printed by another process.
+  // Barriers are used to keep the output in order.
+  if(separate_processes())
+    MPI_Barrier(mpi_comm);
 
-  pcout << std::endl << "ALE:" << std::endl;
-  fluid->ale_grid_motion->print_iterations();
+  if(is_fluid_process)
+  {
+    pcout_fluid << std::endl << "Fluid:" << std::endl;
+    fluid->time_integrator->print_iterations();
 
-  pcout << std::endl << "Structure:" << std::endl;
-  structure->time_integrator->print_iterations();
+    pcout_fluid << std::endl << "ALE:" << std::endl;
+    fluid->ale_grid_motion->print_iterations();
+  }
 
-  // wall times
-  pcout << std::endl << "Wall times:" << std::endl;
+  if(separate_processes())
+    MPI_Barrier(mpi_comm);
 
+  if(is_structure_process)
+  {
+    pcout_structure << std::endl << "Structure:" << std::endl;
+    structure->time_integrator->print_iterations();
+  }
+
+  // wall times
   timer_tree.insert({"FSI"}, total_time);
 
-  timer_tree.insert({"FSI"}, fluid->time_integrator->get_timings(), "Fluid");
-  timer_tree.insert({"FSI"}, fluid->get_timings_ale());
-  timer_tree.insert({"FSI"}, structure->time_integrator->get_timings(), "Structure");
-  timer_tree.insert({"FSI"}, partitioned_solver->get_timings());
+  if(is_fluid_process)
+  {
+    timer_tree.insert({"FSI"}, fluid->time_integrator->get_timings(), "Fluid");
+    timer_tree.insert({"FSI"}, fluid->get_timings_ale());
+  }
+  if(is_structure_process)
+  {
+    timer_tree.insert({"FSI"}, structure->time_integrator->get_timings(), "Structure");
+    timer_tree.insert({"FSI"}, partitioned_solver->get_timings());
+  }
 
-  pcout << std::endl << "Timings for level 1:" << std::endl;
-  timer_tree.print_level(pcout, 1);
+  if(separate_processes())
+  {
+    // the timer trees differ between the processes of the fluid and the structure
+    for(bool const structure_group : {true, false})
+    {
+      MPI_Barrier(mpi_comm);
 
-  pcout << std::endl << "Timings for level 2:" << std::endl;
-  timer_tree.print_level(pcout, 2);
+      if(structure_group == is_structure_process)
+      {
+        dealii::ConditionalOStream const & pcout_group =
+          is_structure_process ? pcout_structure : pcout_fluid;
+        MPI_Comm const & comm_group = is_structure_process ? mpi_comm_structure : mpi_comm_fluid;
 
-  // Throughput in DoFs/s per time step per core
-  dealii::types::global_dof_index DoFs =
-    fluid->pde_operator->get_number_of_dofs() + structure->pde_operator->get_number_of_dofs();
+        pcout_group << std::endl
+                    << "Wall times (" << (is_structure_process ? "structure" : "fluid")
+                    << " processes):" << std::endl;
 
-  if(application->fluid->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
-  {
-    DoFs += fluid->pde_operator->get_number_of_dofs();
+        pcout_group << std::endl << "Timings for level 1:" << std::endl;
+        timer_tree.print_level(pcout_group, 1, comm_group);
+
+        pcout_group << std::endl << "Timings for level 2:" << std::endl;
+        timer_tree.print_level(pcout_group, 2, comm_group);
+      }
+    }
+
+    MPI_Barrier(mpi_comm);
   }
-  else if(application->fluid->get_parameters().mesh_movement_type ==
-          IncNS::MeshMovementType::Elasticity)
+  else
   {
-    DoFs += fluid->ale_elasticity_operator->get_number_of_dofs();
+    pcout << std::endl << "Wall times:" << std::endl;
+
+    pcout << std::endl << "Timings for level 1:" << std::endl;
+    timer_tree.print_level(pcout, 1);
+
+    pcout << std::endl << "Timings for level 2:" << std::endl;
+    timer_tree.print_level(pcout, 2);
   }
-  else
+
+  // Throughput in DoFs/s per time step per core
+  dealii::types::global_dof_index DoFs_fluid = 0, DoFs_structure = 0;
+  unsigned int                    N_time_steps = 0;
+
+  if(is_fluid_process)
   {
-    AssertThrow(false, dealii::ExcMessage("not implemented."));
+    DoFs_fluid = fluid->pde_operator->get_number_of_dofs();
+
+    if(application->fluid->get_parameters().mesh_movement_type ==
+       IncNS::MeshMovementType::Poisson)
+    {
+      DoFs_fluid += fluid->pde_operator->get_number_of_dofs();
+    }
+    else if(application->fluid->get_parameters().mesh_movement_type ==
+            IncNS::MeshMovementType::Elasticity)
+    {
+      DoFs_fluid += fluid->ale_elasticity_operator->get_number_of_dofs();
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("not implemented."));
+    }
+
+    N_time_steps = fluid->time_integrator->get_number_of_time_steps();
   }
 
+  if(is_structure_process)
+    DoFs_structure = structure->pde_operator->get_number_of_dofs();
+
+  DoFs_fluid   = broadcast_from_fluid(DoFs_fluid);
+  N_time_steps = broadcast_from_fluid(N_time_steps);
+  if(separate_processes())
+    DoFs_structure = dealii::Utilities::MPI::broadcast(mpi_comm, DoFs_structure, 0);
+
+  dealii::types::global_dof_index const DoFs = DoFs_fluid + DoFs_structure;
+
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
   dealii::Utilities::MPI::MinMaxAvg total_time_data =
     dealii::Utilities::MPI::min_max_avg(total_time, mpi_comm);
   double const total_time_avg = total_time_data.avg;
 
-  unsigned int N_time_steps = fluid->time_integrator->get_number_of_time_steps();
-
   print_throughput_unsteady(pcout, DoFs, total_time_avg, N_time_steps, N_mpi_processes);
 
   // computational costs in CPUh
@@ -28,6 +28,7 @@
 // FSI
 #include <exadg/fluid_structure_interaction/acceleration_schemes/parameters.h>
 #include <exadg/fluid_structure_interaction/acceleration_schemes/partitioned_solver.h>
+#include <exadg/fluid_structure_interaction/acceleration_schemes/separate_processes.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/fluid.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/structure.h>
 
@@ -51,6 +52,13 @@ public:
          std::shared_ptr<ApplicationBase<dim, Number>> application,
          bool const                                    is_test);
 
+  /*
+   * Frees the communicators of the structure and the fluid in case of separate processes.
+   * The objects created on these communicators are released before, so that the application
+   * must not be used after the driver has been destroyed.
+   */
+  ~Driver();
+
   void
   setup();
 
@@ -61,9 +69,32 @@ public:
   print_performance_results(double const total_time) const;
 
 private:
+  void
+  setup_communicators();
+
+  bool
+  separate_processes() const;
+
+  /*
+   * Broadcasts a value known on the processes of the fluid to all processes.
+   */
+  template<typename T>
+  T
+  broadcast_from_fluid(T const & value) const;
+
+  bool
+  finished() const;
+
   void
   setup_interface_coupling();
 
+  void
+  setup_coupling(InterfaceCoupling<dim, dim, Number> &                   coupling,
+                 std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_dst,
+                 dealii::DoFHandler<dim> const *                         dof_handler_src,
+                 dealii::Mapping<dim> const *                            mapping_src,
+                 std::vector<bool> const &                               marked_vertices_src) const;
+
   void
   set_start_time() const;
 
@@ -87,8 +118,18 @@ private:
   // MPI communicator
   MPI_Comm const mpi_comm;
 
+  // communicators of the structure and the fluid (equal to mpi_comm unless the structure is
+  // solved on separate processes, MPI_COMM_NULL on processes not involved)
+  MPI_Comm mpi_comm_structure;
+  MPI_Comm mpi_comm_fluid;
+
+  bool is_structure_process;
+  bool is_fluid_process;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
+  dealii::ConditionalOStream pcout_structure;
+  dealii::ConditionalOStream pcout_fluid;
 
   // do not print wall times if is_test
   bool const is_test;
@@ -160,8 +160,9 @@ ExaDGCoupling<dim, data_dim, VectorizedArrayType>::read_block_data(
   {
     if constexpr(data_dim > 1)
     {
-      auto &     array_solution = interface_data->get_array_solution(quad_index);
-      auto const array_size     = array_solution.size();
+      auto const array_size = interface_data->get_n_points(quad_index);
+
+      std::vector<dealii::Tensor<1, dim>> array_solution(array_size);
 
       AssertIndexRange(start_index, coupling_nodes_ids.size());
 #ifdef EXADG_WITH_PRECICE
@@ -172,6 +173,8 @@ ExaDGCoupling<dim, data_dim, VectorizedArrayType>::read_block_data(
 #else
       (void)read_data_id;
 #endif
+      interface_data->set_solution_values(quad_index, array_solution);
+
       start_index += array_size;
     }
     else
@@ -240,6 +240,8 @@ SolverFluid<dim, Number>::setup(std::shared_ptr<FluidFSI::ApplicationBase<dim, N
   time_integrator = IncNS::create_time_integrator<dim, Number>(
     pde_operator, application->get_parameters(), mpi_comm, is_test, postprocessor);
 
+  time_integrator->set_dof_numbering_checksum(
+    compute_dof_numbering_checksum(pde_operator->get_dof_handler_u()));
   time_integrator->setup(application->get_parameters().restarted_simulation);
 
   pde_operator->setup_solvers(time_integrator->get_scaling_factor_time_derivative_term(),
@@ -270,6 +272,7 @@ SolverFluid<dim, Number>::solve_ale(
 
   sub_timer.restart();
   pde_operator->update_after_grid_motion();
+  postprocessor->update_after_grid_motion();
   timer_tree->insert({"ALE", "Update operator"}, sub_timer.wall_time());
 
   sub_timer.restart();
@@ -29,6 +29,7 @@
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/fluid_structure_interaction/user_interface/declare_get_application.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/profiler.h>
 
 namespace ExaDG
 {
@@ -40,6 +41,9 @@ create_input_file(std::string const & input_file)
   GeneralParameters general;
   general.add_parameters(prm);
 
+  ProfilerParameters profiler;
+  profiler.add_parameters(prm);
+
   FSI::Parameters fsi_data;
   fsi_data.add_parameters(prm);
 
@@ -62,18 +66,31 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm, bool const is_tes
   dealii::Timer timer;
   timer.restart();
 
+  Profiler::instance().reinit(ProfilerParameters(input_file), mpi_comm);
+
   std::shared_ptr<FSI::ApplicationBase<dim, Number>> application =
     FSI::get_application<dim, Number>(input_file, mpi_comm);
 
   std::shared_ptr<FSI::Driver<dim, Number>> driver =
     std::make_shared<FSI::Driver<dim, Number>>(input_file, mpi_comm, application, is_test);
 
+  // the driver owns the application, which is released before the communicators of the
+  // structure and the fluid are freed
+  application.reset();
+
   driver->setup();
 
   driver->solve();
 
   if(not(is_test))
+  {
     driver->print_performance_results(timer.wall_time());
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    Profiler::instance().print_summary(pcout, mpi_comm);
+    Profiler::instance().write_results(mpi_comm);
+  }
 }
 } // namespace ExaDG
 
@@ -88,6 +88,18 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /*
+   * Assigns the application to a different communicator, e.g. to a subset of the processes
+   * in case the fluid and the structure are solved on separate processes. This function
+   * has to be called before setup().
+   */
+  void
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
   void
   setup()
   {
@@ -112,6 +124,7 @@ public:
     boundary_descriptor = std::make_shared<Structure::BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions(*boundary_descriptor, *grid);
+    boundary_descriptor->set_vectorized_functions();
 
     // material_descriptor
     material_descriptor = std::make_shared<Structure::MaterialDescriptor>();
@@ -156,7 +169,7 @@ public:
   create_postprocessor() = 0;
 
 protected:
-  MPI_Comm const & mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -230,6 +243,18 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /*
+   * Assigns the application to a different communicator, e.g. to a subset of the processes
+   * in case the fluid and the structure are solved on separate processes. This function
+   * has to be called before setup().
+   */
+  void
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
   void
   setup()
   {
@@ -257,6 +282,7 @@ public:
     boundary_descriptor = std::make_shared<IncNS::BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     IncNS::verify_boundary_conditions<dim, Number>(*boundary_descriptor, *grid);
+    IncNS::set_vectorized_functions(*boundary_descriptor);
 
     // field functions
     field_functions = std::make_shared<IncNS::FieldFunctions<dim>>();
@@ -278,6 +304,7 @@ public:
       ale_poisson_boundary_descriptor = std::make_shared<Poisson::BoundaryDescriptor<1, dim>>();
       set_boundary_descriptor_ale_poisson();
       verify_boundary_conditions(*ale_poisson_boundary_descriptor, *grid);
+      ale_poisson_boundary_descriptor->set_vectorized_functions();
 
       // field functions
       ale_poisson_field_functions = std::make_shared<Poisson::FieldFunctions<dim>>();
@@ -296,6 +323,7 @@ public:
       ale_elasticity_boundary_descriptor = std::make_shared<Structure::BoundaryDescriptor<dim>>();
       set_boundary_descriptor_ale_elasticity();
       verify_boundary_conditions(*ale_elasticity_boundary_descriptor, *grid);
+      ale_elasticity_boundary_descriptor->set_vectorized_functions();
 
       // material_descriptor
       ale_elasticity_material_descriptor = std::make_shared<Structure::MaterialDescriptor>();
@@ -381,7 +409,7 @@ public:
   }
 
 protected:
-  MPI_Comm const & mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
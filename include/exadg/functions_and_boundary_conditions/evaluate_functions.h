@@ -29,12 +29,45 @@
 #include <deal.II/base/vectorization.h>
 
 #include <exadg/functions_and_boundary_conditions/function_cached.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/functions_and_boundary_conditions/function_with_normal.h>
 
 #include <memory>
+#include <type_traits>
 
 namespace ExaDG
 {
+/*
+ * Loads the values of all SIMD lanes of one component of a FunctionCached object, which are
+ * stored contiguously in double precision. The cached data must have been generated with the
+ * vectorization length of dealii::VectorizedArray<Number>, given by @param n_lanes.
+ */
+template<typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  void
+  load_cached_values(dealii::VectorizedArray<Number> & dst,
+                     double const *                    src,
+                     unsigned int const                n_lanes)
+{
+  AssertDimension(n_lanes, dealii::VectorizedArray<Number>::size());
+  (void)n_lanes;
+
+  if constexpr(std::is_same<Number, double>::value)
+  {
+    dst.load(src);
+  }
+  else
+  {
+    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      dst[v] = src[v];
+  }
+}
+
+/*
+ * Functions of type dealii::Function are evaluated lane by lane. Kernels in performance-critical
+ * loops should instead hold the FunctionVectorized object returned by make_function_vectorized()
+ * during setup, for which all SIMD lanes are evaluated by a single virtual function call.
+ */
 template<int rank, int dim, typename Number>
 struct FunctionEvaluator
 {
@@ -55,15 +88,13 @@ struct FunctionEvaluator
 
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<FunctionCached<rank, dim>> function,
-          unsigned int const                         face,
-          unsigned int const                         q,
-          unsigned int const                         quad_index)
+    value(std::shared_ptr<FunctionVectorized<dim>> const &            function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
   {
     (void)function;
-    (void)face;
-    (void)q;
-    (void)quad_index;
+    (void)q_points;
+    (void)time;
 
     AssertThrow(false, dealii::ExcMessage("should not arrive here."));
 
@@ -72,17 +103,17 @@ struct FunctionEvaluator
 
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                          function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const &     q_points,
-          dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normals,
-          double const &                                                  time)
+    value(std::shared_ptr<FunctionCached<rank, dim>> function,
+          unsigned int const                         face,
+          unsigned int const                         q,
+          unsigned int const                         quad_index)
   {
     (void)function;
-    (void)q_points;
-    (void)normals;
-    (void)time;
+    (void)face;
+    (void)q;
+    (void)quad_index;
 
-    AssertThrow(false, dealii::ExcMessage("not implemented."));
+    AssertThrow(false, dealii::ExcMessage("should not arrive here."));
 
     return dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>();
   }
@@ -97,21 +128,16 @@ struct FunctionEvaluator<0, dim, Number>
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
           double const &                                              time)
   {
-    dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
-
-    Number array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-    {
-      dealii::Point<dim> q_point;
-      for(unsigned int d = 0; d < dim; ++d)
-        q_point[d] = q_points[d][v];
-
-      function->set_time(time);
-      array[v] = function->value(q_point);
-    }
-    value.load(&array[0]);
+    return FunctionVectorizedAdapter<dim>::evaluate(*function, q_points, time, 0);
+  }
 
-    return value;
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
+    value(std::shared_ptr<FunctionVectorized<dim>> const &            function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    return function->vectorized_value(q_points, time, 0);
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
@@ -121,14 +147,11 @@ struct FunctionEvaluator<0, dim, Number>
             unsigned int const                      q,
             unsigned int const                      quad_index)
   {
-    dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
+    VectorizedFaceValues<double> const & cache = function->get_vectorized_values(quad_index);
 
-    Number array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-    {
-      array[v] = function->tensor_value(face, q, v, quad_index);
-    }
-    value.load(&array[0]);
+    dealii::VectorizedArray<Number> value;
+
+    load_cached_values(value, cache.get_values(face, q), cache.n_lanes);
 
     return value;
   }
@@ -146,19 +169,21 @@ struct FunctionEvaluator<1, dim, Number>
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
 
     for(unsigned int d = 0; d < dim; ++d)
-    {
-      Number array[dealii::VectorizedArray<Number>::size()];
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      {
-        dealii::Point<dim> q_point;
-        for(unsigned int d = 0; d < dim; ++d)
-          q_point[d] = q_points[d][v];
+      value[d] = FunctionVectorizedAdapter<dim>::evaluate(*function, q_points, time, d);
 
-        function->set_time(time);
-        array[v] = function->value(q_point, d);
-      }
-      value[d].load(&array[0]);
-    }
+    return value;
+  }
+
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+    value(std::shared_ptr<FunctionVectorized<dim>> const &            function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+
+    for(unsigned int d = 0; d < dim; ++d)
+      value[d] = function->vectorized_value(q_points, time, d);
 
     return value;
   }
@@ -170,22 +195,14 @@ struct FunctionEvaluator<1, dim, Number>
             unsigned int const                      q,
             unsigned int const                      quad_index)
   {
+    VectorizedFaceValues<double> const & cache = function->get_vectorized_values(quad_index);
+
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
 
-    dealii::Tensor<1, dim, Number> tensor_array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-    {
-      tensor_array[v] = function->tensor_value(face, q, v, quad_index);
-    }
+    double const * values = cache.get_values(face, q);
 
     for(unsigned int d = 0; d < dim; ++d)
-    {
-      dealii::VectorizedArray<Number> array;
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-        array[v] = tensor_array[v][d];
-
-      value[d].load(&array[0]);
-    }
+      load_cached_values(value[d], values + d * cache.n_lanes, cache.n_lanes);
 
     return value;
   }
@@ -25,47 +25,16 @@
 namespace ExaDG
 {
 template<int rank, int dim, typename Number>
-FunctionCached<rank, dim, Number>::FunctionCached()
-  : map_map_vector_index(nullptr), map_array_solution(nullptr)
+FunctionCached<rank, dim, Number>::FunctionCached() : array_vectorized_values(nullptr)
 {
 }
 
-template<int rank, int dim, typename Number>
-typename FunctionCached<rank, dim, Number>::value_type
-FunctionCached<rank, dim, Number>::tensor_value(unsigned int const face,
-                                                unsigned int const q,
-                                                unsigned int const v,
-                                                unsigned int const quad_index) const
-{
-  Assert(map_map_vector_index != nullptr,
-         dealii::ExcMessage("Pointer global_map_vector_index is not initialized."));
-  Assert(map_map_vector_index->find(quad_index) != map_map_vector_index->end(),
-         dealii::ExcMessage("Specified quad_index does not exist in global_map_vector_index."));
-
-  Assert(map_array_solution != nullptr,
-         dealii::ExcMessage("Pointer map_array_solution is not initialized."));
-  Assert(map_array_solution->find(quad_index) != map_array_solution->end(),
-         dealii::ExcMessage("Specified quad_index does not exist in map_array_solution."));
-
-  MapVectorIndex const &      map_vector_index = map_map_vector_index->find(quad_index)->second;
-  ArraySolutionValues const & array_solution   = map_array_solution->find(quad_index)->second;
-
-  Id                              id    = std::make_tuple(face, q, v);
-  dealii::types::global_dof_index index = map_vector_index.find(id)->second;
-
-  Assert(index < array_solution.size(), dealii::ExcMessage("Index exceeds dimensions of vector."));
-
-  return array_solution[index];
-}
-
 template<int rank, int dim, typename Number>
 void
 FunctionCached<rank, dim, Number>::set_data_pointer(
-  std::map<unsigned int, MapVectorIndex> const &      map_map_vector_index_,
-  std::map<unsigned int, ArraySolutionValues> const & map_array_solution_)
+  ArrayVectorizedValues const & array_vectorized_values_)
 {
-  map_map_vector_index = &map_map_vector_index_;
-  map_array_solution   = &map_array_solution_;
+  array_vectorized_values = &array_vectorized_values_;
 }
 
 template class FunctionCached<0, 2, double>;
@@ -22,12 +22,64 @@
 #ifndef INCLUDE_FUNCTIONALITIES_FUNCTION_INTERPOLATION_H_
 #define INCLUDE_FUNCTIONALITIES_FUNCTION_INTERPOLATION_H_
 
+// C/C++
+#include <vector>
+
 // deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/numbers.h>
 #include <deal.II/base/tensor.h>
-#include <map>
 
 namespace ExaDG
 {
+/*
+ * Flat storage of cached values at the quadrature points of the boundary face batches of a
+ * dealii::MatrixFree object for one quadrature rule.
+ *
+ * The values of one (face batch, q) pair are stored contiguously in struct-of-arrays format,
+ * i.e., n_components blocks of n_lanes entries, where n_lanes is the vectorization length of the
+ * matrix-free object. Each block can therefore be loaded directly into a dealii::VectorizedArray.
+ */
+template<typename Number>
+struct VectorizedFaceValues
+{
+  VectorizedFaceValues()
+    : first_face(0), n_q_points(0), n_lanes(0), n_components(0)
+  {
+  }
+
+  /*
+   * Returns a pointer to the n_components x n_lanes values of the given face batch and
+   * quadrature point.
+   */
+  Number const *
+  get_values(unsigned int const face, unsigned int const q) const
+  {
+    AssertIndexRange(face - first_face, face_batch_start.size());
+    Assert(face_batch_start[face - first_face] != dealii::numbers::invalid_unsigned_int,
+           dealii::ExcMessage("No cached values available for this face batch."));
+    AssertIndexRange(q, n_q_points);
+
+    return values.data() + face_batch_start[face - first_face] + q * n_components * n_lanes;
+  }
+
+  // index of the first face batch (typically the number of inner face batches)
+  unsigned int first_face;
+
+  // start of the data of each face batch in the array of values, or
+  // dealii::numbers::invalid_unsigned_int for face batches without cached data
+  std::vector<unsigned int> face_batch_start;
+
+  unsigned int n_q_points;
+
+  unsigned int n_lanes;
+
+  unsigned int n_components;
+
+  dealii::AlignedVector<Number> values;
+};
+
 /*
  * Note:
  * The default argument "double" could be removed but this implies that all BoundaryDescriptors
@@ -40,28 +92,37 @@ class FunctionCached
 public:
   typedef dealii::Tensor<rank, dim, Number> value_type;
 
-private:
-  using Id = std::tuple<unsigned int /*face*/, unsigned int /*q*/, unsigned int /*v*/>;
+  static unsigned int const n_components = value_type::n_independent_components;
 
-  using MapVectorIndex      = std::map<Id, dealii::types::global_dof_index>;
-  using ArraySolutionValues = std::vector<value_type>;
+private:
+  // cached values indexed by quad_index
+  using ArrayVectorizedValues = std::vector<VectorizedFaceValues<Number>>;
 
 public:
   FunctionCached();
 
-  value_type
-  tensor_value(unsigned int const face,
-               unsigned int const q,
-               unsigned int const v,
-               unsigned int const quad_index) const;
+  /*
+   * Returns the cached values of all boundary face batches for the given quadrature rule. The
+   * values of a (face batch, q) pair are accessed via VectorizedFaceValues::get_values().
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    VectorizedFaceValues<Number> const &
+    get_vectorized_values(unsigned int const quad_index) const
+  {
+    Assert(array_vectorized_values != nullptr,
+           dealii::ExcMessage("Pointer array_vectorized_values is not initialized."));
+    AssertIndexRange(quad_index, array_vectorized_values->size());
+    Assert((*array_vectorized_values)[quad_index].n_q_points > 0,
+           dealii::ExcMessage("Specified quad_index does not exist in array_vectorized_values."));
+
+    return (*array_vectorized_values)[quad_index];
+  }
 
   void
-  set_data_pointer(std::map<unsigned int, MapVectorIndex> const &      map_map_vector_index_,
-                   std::map<unsigned int, ArraySolutionValues> const & map_array_solution_);
+  set_data_pointer(ArrayVectorizedValues const & array_vectorized_values_);
 
 private:
-  std::map<unsigned int, MapVectorIndex> const *      map_map_vector_index;
-  std::map<unsigned int, ArraySolutionValues> const * map_array_solution;
+  ArrayVectorizedValues const * array_vectorized_values;
 };
 
 } // namespace ExaDG
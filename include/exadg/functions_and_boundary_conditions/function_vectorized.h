@@ -0,0 +1,230 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_
+
+// C/C++
+#include <map>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/types.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Base class for analytical functions that can be evaluated for all SIMD lanes of a
+ * dealii::VectorizedArray at once. Since this class is derived from dealii::Function, objects of
+ * this type can be used wherever a dealii::Function is expected (boundary descriptors, field
+ * functions, interpolation, error calculation). Kernels that are handed a FunctionVectorized object
+ * (see make_function_vectorized()) call vectorized_value() once per quadrature point batch and
+ * component, instead of unpacking each lane into a dealii::Point and calling the virtual function
+ * value() once per lane.
+ *
+ * Derived classes only have to implement the evaluation in double precision. The time is passed
+ * as an argument, i.e., vectorized_value() does not rely on set_time().
+ */
+template<int dim>
+class FunctionVectorized : public dealii::Function<dim>
+{
+public:
+  FunctionVectorized(unsigned int const n_components = 1, double const time = 0.0)
+    : dealii::Function<dim>(n_components, time)
+  {
+  }
+
+  virtual dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   double const                                                time,
+                   unsigned int const component = 0) const = 0;
+
+  /*
+   * Evaluation in single precision, which is realized by evaluating the double-precision variant
+   * for chunks of dealii::VectorizedArray<double>::size() lanes.
+   */
+  dealii::VectorizedArray<float>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<float>> const & p,
+                   double const                                               time,
+                   unsigned int const                                         component = 0) const
+  {
+    unsigned int const n_lanes_float  = dealii::VectorizedArray<float>::size();
+    unsigned int const n_lanes_double = dealii::VectorizedArray<double>::size();
+
+    static_assert(n_lanes_float % n_lanes_double == 0,
+                  "Vectorization length of float has to be a multiple of the one of double.");
+
+    dealii::VectorizedArray<float> result;
+    for(unsigned int offset = 0; offset < n_lanes_float; offset += n_lanes_double)
+    {
+      dealii::Point<dim, dealii::VectorizedArray<double>> p_double;
+      for(unsigned int d = 0; d < dim; ++d)
+        for(unsigned int v = 0; v < n_lanes_double; ++v)
+          p_double[d][v] = p[d][offset + v];
+
+      dealii::VectorizedArray<double> const result_double =
+        this->vectorized_value(p_double, time, component);
+
+      for(unsigned int v = 0; v < n_lanes_double; ++v)
+        result[offset + v] = result_double[v];
+    }
+
+    return result;
+  }
+
+  /*
+   * Point-wise evaluation as required by dealii::Function, using the time set via set_time().
+   */
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    dealii::Point<dim, dealii::VectorizedArray<double>> p_vectorized;
+    for(unsigned int d = 0; d < dim; ++d)
+      p_vectorized[d] = p[d];
+
+    return this->vectorized_value(p_vectorized, this->get_time(), component)[0];
+  }
+};
+
+/*
+ * Adapter that evaluates an arbitrary dealii::Function lane by lane, providing the interface of
+ * FunctionVectorized. This is the fallback used by make_function_vectorized() for functions that
+ * are not derived from FunctionVectorized.
+ */
+template<int dim>
+class FunctionVectorizedAdapter : public FunctionVectorized<dim>
+{
+public:
+  FunctionVectorizedAdapter(std::shared_ptr<dealii::Function<dim>> function)
+    : FunctionVectorized<dim>(function->n_components, function->get_time()), function(function)
+  {
+  }
+
+  template<typename Number>
+  static dealii::VectorizedArray<Number>
+  evaluate(dealii::Function<dim> &                                     function,
+           dealii::Point<dim, dealii::VectorizedArray<Number>> const & p,
+           double const                                                time,
+           unsigned int const                                          component)
+  {
+    function.set_time(time);
+
+    dealii::VectorizedArray<Number> result;
+    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    {
+      dealii::Point<dim> q_point;
+      for(unsigned int d = 0; d < dim; ++d)
+        q_point[d] = p[d][v];
+
+      result[v] = function.value(q_point, component);
+    }
+
+    return result;
+  }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & p,
+                   double const                                                time,
+                   unsigned int const component = 0) const override
+  {
+    return evaluate(*function, p, time, component);
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const override
+  {
+    function->set_time(this->get_time());
+    return function->value(p, component);
+  }
+
+private:
+  std::shared_ptr<dealii::Function<dim>> function;
+};
+
+/*
+ * Wrapper for functions of type dealii::Functions::ConstantFunction (e.g. ZeroFunction). The
+ * values of all components are queried once at construction and broadcast to all lanes.
+ */
+template<int dim>
+class FunctionVectorizedConstant : public FunctionVectorized<dim>
+{
+public:
+  FunctionVectorizedConstant(dealii::Functions::ConstantFunction<dim> const & function)
+    : FunctionVectorized<dim>(function.n_components), values(function.n_components)
+  {
+    for(unsigned int c = 0; c < function.n_components; ++c)
+      values[c] = function.value(dealii::Point<dim>(), c);
+  }
+
+  dealii::VectorizedArray<double>
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & /*p*/,
+                   double const /*time*/,
+                   unsigned int const component = 0) const override
+  {
+    return dealii::make_vectorized_array<double>(values[component]);
+  }
+
+private:
+  std::vector<double> values;
+};
+
+/*
+ * Returns the vectorized representation of a function: functions derived from FunctionVectorized
+ * are returned as they are, constant functions are wrapped by FunctionVectorizedConstant, and all
+ * other functions by FunctionVectorizedAdapter. This function involves dynamic casts and is meant
+ * to be called once during setup, not inside the matrix-free loops.
+ */
+template<int dim>
+std::shared_ptr<FunctionVectorized<dim>>
+make_function_vectorized(std::shared_ptr<dealii::Function<dim>> function)
+{
+  if(function.get() == nullptr)
+    return nullptr;
+
+  if(auto function_vectorized = std::dynamic_pointer_cast<FunctionVectorized<dim>>(function))
+    return function_vectorized;
+
+  if(auto function_constant =
+       std::dynamic_pointer_cast<dealii::Functions::ConstantFunction<dim>>(function))
+    return std::make_shared<FunctionVectorizedConstant<dim>>(*function_constant);
+
+  return std::make_shared<FunctionVectorizedAdapter<dim>>(function);
+}
+
+template<int dim>
+std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+make_function_vectorized(
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> const & functions)
+{
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>> result;
+  for(auto const & it : functions)
+    result.insert({it.first, make_function_vectorized(it.second)});
+
+  return result;
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_FUNCTION_VECTORIZED_H_ */
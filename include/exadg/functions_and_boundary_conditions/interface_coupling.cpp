@@ -39,18 +39,31 @@ ContainerInterfaceData<dim, n_components, Number>::setup(
 {
   quad_indices = quad_indices_;
 
+  unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+  unsigned int max_quad_index = 0;
+  for(auto q_index : quad_indices)
+    max_quad_index = std::max(max_quad_index, q_index);
+  vectorized_solution.resize(quad_indices.empty() ? 0 : max_quad_index + 1);
+
   for(auto q_index : quad_indices)
   {
     // initialize maps
-    map_vector_index.emplace(q_index, MapVectorIndex());
     map_q_points.emplace(q_index, ArrayQuadraturePoints());
-    map_solution.emplace(q_index, ArraySolutionValues());
 
-    MapVectorIndex &        map_index          = map_vector_index.find(q_index)->second;
     ArrayQuadraturePoints & array_q_points_dst = map_q_points.find(q_index)->second;
-    ArraySolutionValues &   array_solution_dst = map_solution.find(q_index)->second;
 
-    // create map "ID = {face, q, v} <-> vector_index" and fill array of quadrature points
+    VectorizedFaceValues<double> & vectorized_dst = vectorized_solution[q_index];
+
+    vectorized_dst.first_face = matrix_free_->n_inner_face_batches();
+    vectorized_dst.face_batch_start.resize(matrix_free_->n_boundary_face_batches(),
+                                           dealii::numbers::invalid_unsigned_int);
+    vectorized_dst.n_q_points   = matrix_free_->get_n_q_points_face(q_index);
+    vectorized_dst.n_lanes      = n_lanes;
+    vectorized_dst.n_components = n_components;
+
+    // fill array of quadrature points in the order (face batch, q, v) and store the position
+    // of each face batch in the vectorized storage
     for(unsigned int face = matrix_free_->n_inner_face_batches();
         face < matrix_free_->n_inner_face_batches() + matrix_free_->n_boundary_face_batches();
         ++face)
@@ -64,33 +77,35 @@ ContainerInterfaceData<dim, n_components, Number>::setup(
                                                              q_index);
         integrator.reinit(face);
 
+        AssertDimension(integrator.n_q_points, vectorized_dst.n_q_points);
+
+        vectorized_dst.face_batch_start[face - vectorized_dst.first_face] =
+          n_components * array_q_points_dst.size();
+
         for(unsigned int q = 0; q < integrator.n_q_points; ++q)
         {
           dealii::Point<dim, dealii::VectorizedArray<Number>> q_points =
             integrator.quadrature_point(q);
 
-          for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+          for(unsigned int v = 0; v < n_lanes; ++v)
           {
             dealii::Point<dim> q_point;
             for(unsigned int d = 0; d < dim; ++d)
               q_point[d] = q_points[d][v];
 
-            Id                              id    = std::make_tuple(face, q, v);
-            dealii::types::global_dof_index index = array_q_points_dst.size();
-            map_index.emplace(id, index);
             array_q_points_dst.push_back(q_point);
           }
         }
       }
     }
 
-    array_solution_dst.resize(array_q_points_dst.size(), value_type());
+    vectorized_dst.values.resize(n_components * array_q_points_dst.size(), 0.0);
   }
 
   // finally, give boundary condition access to the data
   for(auto boundary : map_bc_)
   {
-    boundary.second->set_data_pointer(map_vector_index, map_solution);
+    boundary.second->set_data_pointer(vectorized_solution);
   }
 }
 
@@ -109,14 +124,18 @@ ContainerInterfaceData<dim, n_components, Number>::get_array_q_points(quad_index
 }
 
 template<int dim, int n_components, typename Number>
-typename ContainerInterfaceData<dim, n_components, Number>::ArraySolutionValues &
-ContainerInterfaceData<dim, n_components, Number>::get_array_solution(quad_index const & q_index)
+unsigned int
+ContainerInterfaceData<dim, n_components, Number>::get_n_points(quad_index const & q_index) const
 {
-  return map_solution[q_index];
+  return map_q_points.at(q_index).size();
 }
 
 template<int dim, int n_components, typename Number>
-InterfaceCoupling<dim, n_components, Number>::InterfaceCoupling() : dof_handler_src(nullptr)
+InterfaceCoupling<dim, n_components, Number>::InterfaceCoupling()
+  : dof_handler_src(nullptr),
+    remote(false),
+    mpi_comm(MPI_COMM_NULL),
+    src_process(dealii::numbers::invalid_unsigned_int)
 {
 }
 
@@ -162,10 +181,172 @@ InterfaceCoupling<dim, n_components, Number>::setup(
   }
 }
 
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::setup(
+  std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst_,
+  dealii::DoFHandler<dim> const *                                    dof_handler_src_,
+  dealii::Mapping<dim> const *                                       mapping_src_,
+  std::vector<bool> const &                                          marked_vertices_src_,
+  double const                                                       tolerance_,
+  MPI_Comm const &                                                   mpi_comm_)
+{
+  remote             = true;
+  mpi_comm           = mpi_comm_;
+  interface_data_dst = interface_data_dst_;
+  dof_handler_src    = dof_handler_src_;
+
+  bool const is_src = (dof_handler_src != nullptr);
+  bool const is_dst = (interface_data_dst.get() != nullptr);
+
+  if(is_src)
+  {
+    AssertThrow(mapping_src_ != nullptr,
+                dealii::ExcMessage("Received uninitialized variable. Aborting."));
+
+    if(marked_vertices_src_.size() > 0)
+    {
+      AssertThrow(marked_vertices_src_.size() ==
+                    (unsigned int)dof_handler_src->get_triangulation().n_vertices(),
+                  dealii::ExcMessage("Vector marked_vertices_src_ has invalid size."));
+    }
+  }
+
+  // determine the processes of both sides
+  unsigned int const my_process = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  std::vector<unsigned int> src_processes, dst_processes;
+  {
+    unsigned int const side = (is_src ? 1 : 0) + (is_dst ? 2 : 0);
+
+    std::vector<unsigned int> const sides = dealii::Utilities::MPI::all_gather(mpi_comm, side);
+
+    for(unsigned int p = 0; p < sides.size(); ++p)
+    {
+      if(sides[p] & 1)
+        src_processes.push_back(p);
+      if(sides[p] & 2)
+        dst_processes.push_back(p);
+    }
+  }
+
+  AssertThrow(src_processes.size() > 0 and dst_processes.size() > 0,
+              dealii::ExcMessage("Both sides of the interface coupling need processes."));
+
+  // the quadrature rules are only known on the dst-side
+  std::vector<quad_index> quad_indices;
+  if(is_dst)
+    quad_indices = interface_data_dst->get_quad_indices();
+  quad_indices = dealii::Utilities::MPI::broadcast(mpi_comm, quad_indices, dst_processes[0]);
+
+  // distribute the dst-processes evenly among the src-processes and send the points
+  src_process = src_processes[my_process % src_processes.size()];
+
+  std::map<unsigned int, std::map<quad_index, std::vector<dealii::Point<dim>>>> points_send;
+  if(is_dst)
+  {
+    for(auto q_index : quad_indices)
+      points_send[src_process][q_index] = interface_data_dst->get_array_q_points(q_index);
+  }
+
+  auto const points_recv = dealii::Utilities::MPI::some_to_some(mpi_comm, points_send);
+
+  // the src-processes search for the received points
+  requests.clear();
+  map_evaluator.clear();
+  if(is_src)
+  {
+    std::map<quad_index, std::vector<dealii::Point<dim>>> points;
+    for(auto const & [process, points_process] : points_recv)
+    {
+      std::map<quad_index, unsigned int> n_points;
+      for(auto const & [q_index, points_q] : points_process)
+      {
+        n_points[q_index] = points_q.size();
+        points[q_index].insert(points[q_index].end(), points_q.begin(), points_q.end());
+      }
+      requests.emplace_back(process, n_points);
+    }
+
+    for(auto q_index : quad_indices)
+    {
+      map_evaluator.emplace(q_index,
+                            dealii::Utilities::MPI::RemotePointEvaluation<dim>(
+                              tolerance_, false, 0, [marked_vertices_src_]() {
+                                return marked_vertices_src_;
+                              }));
+
+      map_evaluator[q_index].reinit(points[q_index],
+                                    dof_handler_src->get_triangulation(),
+                                    *mapping_src_);
+
+      AssertThrow(
+        map_evaluator[q_index].all_points_found() == true,
+        dealii::ExcMessage(
+          "Setup of InterfaceCoupling was not successful. Not all points have been found."));
+    }
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::update_data_remote(VectorType const & dof_vector_src)
+{
+  std::map<unsigned int, std::map<quad_index, std::vector<value_type>>> values_send;
+
+  if(dof_handler_src != nullptr)
+  {
+    dof_vector_src.update_ghost_values();
+
+    for(auto & [q_index, evaluator] : map_evaluator)
+    {
+      auto const result =
+        dealii::VectorTools::point_values<n_components>(evaluator,
+                                                        *dof_handler_src,
+                                                        dof_vector_src,
+                                                        dealii::VectorTools::EvaluationFlags::avg);
+
+      // split the result according to the requesting processes
+      unsigned int offset = 0;
+      for(auto const & [process, n_points] : requests)
+      {
+        unsigned int const n = n_points.at(q_index);
+
+        std::vector<value_type> & values = values_send[process][q_index];
+        values.resize(n);
+        for(unsigned int i = 0; i < n; ++i)
+          values[i] = result[offset + i];
+
+        offset += n;
+      }
+
+      Assert(offset == result.size(), dealii::ExcMessage("Vectors must have the same length."));
+    }
+  }
+
+  auto const values_recv = dealii::Utilities::MPI::some_to_some(mpi_comm, values_send);
+
+  if(interface_data_dst.get() != nullptr)
+  {
+    for(auto quadrature : interface_data_dst->get_quad_indices())
+    {
+      auto const & values = values_recv.at(src_process).at(quadrature);
+
+      interface_data_dst->set_solution_values(quadrature, values);
+    }
+  }
+}
+
 template<int dim, int n_components, typename Number>
 void
 InterfaceCoupling<dim, n_components, Number>::update_data(VectorType const & dof_vector_src)
 {
+  if(remote)
+  {
+    update_data_remote(dof_vector_src);
+    return;
+  }
+
   dof_vector_src.update_ghost_values();
 
   for(auto quadrature : interface_data_dst->get_quad_indices())
@@ -176,13 +357,7 @@ InterfaceCoupling<dim, n_components, Number>::update_data(VectorType const & dof
                                                       dof_vector_src,
                                                       dealii::VectorTools::EvaluationFlags::avg);
 
-    auto & array_solution = interface_data_dst->get_array_solution(quadrature);
-
-    Assert(result.size() == array_solution.size(),
-           dealii::ExcMessage("Vectors must have the same length."));
-
-    for(unsigned int i = 0; i < result.size(); ++i)
-      array_solution[i] = result[i];
+    interface_data_dst->set_solution_values(quadrature, result);
   }
 }
 
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_FUNCTIONALITIES_INTERFACE_COUPLING_H_
 #define INCLUDE_FUNCTIONALITIES_INTERFACE_COUPLING_H_
 
+// boost
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/vector.hpp>
+
 // deal.II
 #include <deal.II/numerics/vector_tools.h>
 
@@ -43,16 +47,8 @@ private:
 
   using quad_index = unsigned int;
 
-  using Id = std::tuple<unsigned int /*face*/, unsigned int /*q*/, unsigned int /*v*/>;
-
-  using MapVectorIndex = std::map<Id, dealii::types::global_dof_index>;
-
   using ArrayQuadraturePoints = std::vector<dealii::Point<dim>>;
 
-  typedef typename FunctionCached<rank, dim, double>::value_type value_type;
-
-  using ArraySolutionValues = std::vector<value_type>;
-
 public:
   ContainerInterfaceData();
 
@@ -68,15 +64,56 @@ public:
   ArrayQuadraturePoints &
   get_array_q_points(quad_index const & q_index);
 
-  ArraySolutionValues &
-  get_array_solution(quad_index const & q_index);
+  unsigned int
+  get_n_points(quad_index const & q_index) const;
+
+  /*
+   * Stores the point-wise solution @param values, given in the order of get_array_q_points(),
+   * directly in the vectorized storage accessed by FunctionCached. The entries of @param values
+   * have to be convertible to the value type of FunctionCached.
+   */
+  template<typename ArrayValues>
+  void
+  set_solution_values(quad_index const & q_index, ArrayValues const & values)
+  {
+    AssertIndexRange(q_index, vectorized_solution.size());
+
+    VectorizedFaceValues<double> & vectorized = vectorized_solution[q_index];
+
+    unsigned int const n_lanes = vectorized.n_lanes;
+
+    AssertDimension(values.size() * n_components, vectorized.values.size());
+
+    // Point i belongs to lane v = i % n_lanes of the (face batch, q) block starting at point
+    // i - v. Since the points of a face batch are numbered contiguously, this block is located at
+    // position n_components * (i - v) in the vectorized storage.
+    for(unsigned int i = 0; i < values.size(); ++i)
+    {
+      unsigned int const v     = i % n_lanes;
+      double *           block = vectorized.values.data() + n_components * (i - v);
+
+      if constexpr(rank == 0)
+      {
+        block[v] = values[i];
+      }
+      else
+      {
+        for(unsigned int c = 0; c < n_components; ++c)
+          block[c * n_lanes + v] = values[i][c];
+      }
+    }
+  }
 
 private:
   std::vector<quad_index> quad_indices;
 
-  mutable std::map<quad_index, MapVectorIndex>        map_vector_index;
+  // The quadrature points are stored point by point in the order (face batch, q, lane), which
+  // is the format needed to exchange data with other codes.
   mutable std::map<quad_index, ArrayQuadraturePoints> map_q_points;
-  mutable std::map<quad_index, ArraySolutionValues>   map_solution;
+
+  // The solution values in a vectorization-friendly format as used by FunctionCached, indexed
+  // by quad_index.
+  std::vector<VectorizedFaceValues<double>> vectorized_solution;
 };
 
 template<int dim, int n_components, typename Number>
@@ -93,6 +130,8 @@ private:
 
   using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
 
+  typedef typename FunctionCached<rank, dim, double>::value_type value_type;
+
 public:
   InterfaceCoupling();
 
@@ -113,10 +152,35 @@ public:
         std::vector<bool> const &                                          marked_vertices_src_,
         double const                                                       tolerance_);
 
+  /**
+   * setup() function for the case that the src-side and the dst-side live on different,
+   * possibly disjoint, subsets of the processes of @param mpi_comm_. The dst-side data is only
+   * accessed on processes where @param interface_data_dst_ is initialized, and the src-side data
+   * only on processes where @param dof_handler_src_ is not a nullptr. The quadrature points of
+   * each dst-process are sent to one process of the src-side. The src-processes search for
+   * these points collectively and send the evaluated solution back in update_data().
+   *
+   * This function and update_data() have to be called by all processes of @param mpi_comm_.
+   */
+  void
+  setup(std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst_,
+        dealii::DoFHandler<dim> const *                                    dof_handler_src_,
+        dealii::Mapping<dim> const *                                       mapping_src_,
+        std::vector<bool> const &                                          marked_vertices_src_,
+        double const                                                       tolerance_,
+        MPI_Comm const &                                                   mpi_comm_);
+
+  /**
+   * Evaluates @param dof_vector_src in the points of the dst-side. If the src-side and the
+   * dst-side live on different processes, the vector is only accessed on src-processes.
+   */
   void
   update_data(VectorType const & dof_vector_src);
 
 private:
+  void
+  update_data_remote(VectorType const & dof_vector_src);
+
   /*
    * dst-side
    */
@@ -131,6 +195,19 @@ private:
    * src-side
    */
   dealii::DoFHandler<dim> const * dof_handler_src;
+
+  /*
+   * Only relevant if the src-side and the dst-side live on different processes.
+   */
+  bool     remote;
+  MPI_Comm mpi_comm;
+
+  // dst-side: the process of the src-side that evaluates the points of this process
+  unsigned int src_process;
+
+  // src-side: the dst-processes that requested evaluations, together with the number of
+  // points requested, in the order in which the points are passed to map_evaluator
+  std::vector<std::pair<unsigned int, std::map<quad_index, unsigned int>>> requests;
 };
 
 } // namespace ExaDG
@@ -232,6 +232,8 @@ Driver<dim, Number>::setup()
                   dealii::ExcMessage("start_with_low_order has to be true for this solver."));
     }
 
+    fluid_time_integrator->set_dof_numbering_checksum(
+      compute_dof_numbering_checksum(fluid_operator->get_dof_handler_u()));
     fluid_time_integrator->setup(application->get_parameters().restarted_simulation);
 
     // setup solvers once time integrator has been initialized
@@ -268,6 +270,8 @@ Driver<dim, Number>::setup()
                   dealii::ExcMessage("start_with_low_order has to be true for this solver."));
     }
 
+    scalar_time_integrator[i]->set_dof_numbering_checksum(
+      compute_dof_numbering_checksum(scalar_operator[i]->get_dof_handler()));
     scalar_time_integrator[i]->setup(application->get_parameters_scalar(i).restarted_simulation);
 
     // adaptive time stepping
@@ -518,6 +522,7 @@ Driver<dim, Number>::ale_update() const
 
   sub_timer.restart();
   fluid_operator->update_after_grid_motion();
+  fluid_postprocessor->update_after_grid_motion();
   for(unsigned int i = 0; i < application->get_n_scalars(); ++i)
     scalar_operator[i]->update_after_grid_motion();
   timer_tree.insert({"Flow + transport", "ALE", "Update all operators"}, sub_timer.wall_time());
@@ -616,6 +621,8 @@ Driver<dim, Number>::solve() const
 
     ++N_time_steps;
   }
+
+  fluid_postprocessor->finalize();
 }
 
 template<int dim, typename Number>
@@ -32,6 +32,7 @@
 
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -47,6 +48,9 @@ create_input_file(std::string const & input_file)
   GeneralParameters general;
   general.add_parameters(prm);
 
+  ProfilerParameters profiler;
+  profiler.add_parameters(prm);
+
   // we have to assume a default dimension and default Number type
   // for the automatic generation of a default input file
   unsigned int const Dim = 2;
@@ -65,6 +69,8 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm, bool const is_tes
   dealii::Timer timer;
   timer.restart();
 
+  Profiler::instance().reinit(ProfilerParameters(input_file), mpi_comm);
+
   std::shared_ptr<FTI::ApplicationBase<dim, Number>> application =
     FTI::get_application<dim, Number>(input_file, mpi_comm);
 
@@ -76,7 +82,14 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm, bool const is_tes
   driver->solve();
 
   if(not(is_test))
+  {
     driver->print_performance_results(timer.wall_time());
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    Profiler::instance().print_summary(pcout, mpi_comm);
+    Profiler::instance().write_results(mpi_comm);
+  }
 }
 } // namespace ExaDG
 
@@ -96,6 +96,7 @@ public:
       scalar_boundary_descriptor[i] = std::make_shared<ConvDiff::BoundaryDescriptor<dim>>();
       set_boundary_descriptor_scalar(i);
       verify_boundary_conditions(*scalar_boundary_descriptor[i], *this->grid);
+      scalar_boundary_descriptor[i]->set_vectorized_functions();
 
       // field functions
       scalar_field_functions[i] = std::make_shared<ConvDiff::FieldFunctions<dim>>();
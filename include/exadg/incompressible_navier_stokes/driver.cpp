@@ -191,6 +191,8 @@ Driver<dim, Number>::setup()
 
     if(application->get_parameters().solver_type == SolverType::Unsteady)
     {
+      time_integrator->set_dof_numbering_checksum(
+        compute_dof_numbering_checksum(pde_operator->get_dof_handler_u()));
       time_integrator->setup(application->get_parameters().restarted_simulation);
 
       pde_operator->setup_solvers(time_integrator->get_scaling_factor_time_derivative_term(),
@@ -233,6 +235,7 @@ Driver<dim, Number>::ale_update() const
 
   sub_timer.restart();
   pde_operator->update_after_grid_motion();
+  postprocessor->update_after_grid_motion();
   timer_tree.insert({"Incompressible flow", "ALE", "Update operator"}, sub_timer.wall_time());
 
   sub_timer.restart();
@@ -291,6 +294,8 @@ Driver<dim, Number>::solve() const
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
+
+  postprocessor->finalize();
 }
 
 template<int dim, typename Number>
@@ -596,6 +601,35 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
           << "DoFs/sec:        " << throughput << std::endl
           << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
     // clang-format on
+
+    // the variable viscosity is loaded once per cell and face in each evaluation of an operator
+    // containing the viscous term, so that the memory saved by a compressed storage is also saved
+    // in terms of memory transfer
+    bool const operator_reads_viscosity = operator_type == OperatorType::CoupledNonlinearResidual ||
+                                          operator_type == OperatorType::CoupledLinearized ||
+                                          operator_type == OperatorType::HelmholtzOperator ||
+                                          operator_type == OperatorType::VelocityConvDiffOperator;
+
+    if(application->get_parameters().use_turbulence_model and operator_reads_viscosity)
+    {
+      VariableCoefficients<dim, Number> const & viscosity =
+        pde_operator->get_viscous_kernel().get_viscosity_coefficients();
+
+      double const memory =
+        dealii::Utilities::MPI::sum((double)viscosity.memory_consumption(), mpi_comm);
+      double const memory_full =
+        dealii::Utilities::MPI::sum((double)viscosity.memory_consumption_full_storage(), mpi_comm);
+
+      // clang-format off
+      pcout << std::endl
+            << "Variable viscosity (storage: "
+            << enum_to_string(application->get_parameters().turbulence_model_viscosity_storage) << "):" << std::endl
+            << "  Memory [MB]:                     " << memory / 1.e6 << std::endl
+            << "  Memory with full storage [MB]:   " << memory_full / 1.e6 << std::endl
+            << "  Data transfer saved [Bytes/DoF]: " << (memory_full - memory) / (double)dofs << std::endl
+            << "  Data transfer saved [GB/sec]:    " << (memory_full - memory) / wall_time / 1.e9 << std::endl;
+      // clang-format on
+    }
   }
 
   pcout << std::endl << " ... done." << std::endl << std::endl;
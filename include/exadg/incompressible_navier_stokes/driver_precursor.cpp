@@ -189,6 +189,11 @@ DriverPrecursor<dim, Number>::setup()
 
   // setup time integrator before calling setup_solvers (this is necessary since the setup of the
   // solvers depends on quantities such as the time_step_size or gamma0!!!)
+  time_integrator_pre->set_dof_numbering_checksum(
+    compute_dof_numbering_checksum(pde_operator_pre->get_dof_handler_u()));
+  time_integrator->set_dof_numbering_checksum(
+    compute_dof_numbering_checksum(pde_operator->get_dof_handler_u()));
+
   time_integrator_pre->setup(application->get_parameters_precursor().restarted_simulation);
   time_integrator->setup(application->get_parameters().restarted_simulation);
 
@@ -230,6 +235,9 @@ DriverPrecursor<dim, Number>::solve() const
     if(use_adaptive_time_stepping == true)
       synchronize_time_step_size();
   } while(!time_integrator_pre->finished() || !time_integrator->finished());
+
+  postprocessor_pre->finalize();
+  postprocessor->finalize();
 }
 
 template<int dim, typename Number>
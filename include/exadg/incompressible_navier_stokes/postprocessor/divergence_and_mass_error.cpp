@@ -47,10 +47,11 @@ DivergenceAndMassErrorCalculator<dim, Number>::DivergenceAndMassErrorCalculator(
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::setup(
-  dealii::MatrixFree<dim, Number> const & matrix_free_in,
-  unsigned int const                      dof_index_in,
-  unsigned int const                      quad_index_in,
-  MassConservationData const &            data_in)
+  dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+  unsigned int const                                    dof_index_in,
+  unsigned int const                                    quad_index_in,
+  MassConservationData const &                          data_in,
+  std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in)
 {
   matrix_free = &matrix_free_in;
   dof_index   = dof_index_in;
@@ -59,6 +60,22 @@ DivergenceAndMassErrorCalculator<dim, Number>::setup(
 
   if(data.calculate)
     create_directories(data.directory, mpi_comm);
+
+  if(integral_scheduler_in and data.calculate)
+  {
+    integral_scheduler = integral_scheduler_in;
+
+    std::vector<ReductionType> const reduction(2, ReductionType::Sum);
+
+    integral_indices.push_back(
+      integral_scheduler->add_cell_integral(reduction,
+                                            dealii::EvaluationFlags::values |
+                                              dealii::EvaluationFlags::gradients,
+                                            &This::integrate_divergence));
+
+    integral_indices.push_back(integral_scheduler->add_face_integral(
+      reduction, dealii::EvaluationFlags::values, &This::integrate_mass_flux));
+  }
 }
 
 template<int dim, typename Number>
@@ -69,10 +86,29 @@ DivergenceAndMassErrorCalculator<dim, Number>::evaluate(VectorType const & veloc
 {
   if(data.calculate)
   {
-    if(time_step_number >= 0) // unsteady problem
-      analyze_div_and_mass_error_unsteady(velocity, time, time_step_number);
-    else // steady problem (time_step_number = -1)
-      analyze_div_and_mass_error_steady(velocity);
+    // steady problems (time_step_number = -1) are always analyzed
+    if(time_step_number < 0 or time > data.start_time - 1.e-10)
+    {
+      if(integral_scheduler)
+      {
+        integral_scheduler->request(
+          integral_indices, [this, time, time_step_number](std::vector<double> const & values) {
+            write_results(values[0], values[1], values[2], values[3], time, time_step_number);
+          });
+      }
+      else
+      {
+        Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0,
+               mass_error_reference = 1.0;
+
+        // calculate divergence and mass error
+        do_evaluate(
+          *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
+
+        write_results(
+          div_error, div_error_reference, mass_error, mass_error_reference, time, time_step_number);
+      }
+    }
   }
 }
 
@@ -100,6 +136,36 @@ DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
   mass_error_reference = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
 }
 
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::integrate_divergence(CellIntegratorU & integrator,
+                                                                    scalar *          values)
+{
+  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+  {
+    vector velocity = integrator.get_value(q);
+    values[0] += integrator.JxW(q) * std::abs(integrator.get_divergence(q));
+    values[1] += integrator.JxW(q) * velocity.norm();
+  }
+}
+
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::integrate_mass_flux(FaceIntegratorU & integrator_m,
+                                                                   FaceIntegratorU & integrator_p,
+                                                                   scalar *          values)
+{
+  for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+  {
+    values[0] +=
+      integrator_m.JxW(q) * std::abs((integrator_m.get_value(q) - integrator_p.get_value(q)) *
+                                     integrator_m.get_normal_vector(q));
+    values[1] += integrator_m.JxW(q) *
+                 std::abs(0.5 * (integrator_m.get_value(q) + integrator_p.get_value(q)) *
+                          integrator_m.get_normal_vector(q));
+  }
+}
+
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
@@ -119,25 +185,20 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
     integrator.read_dof_values(source);
     integrator.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
-    scalar div_vec = dealii::make_vectorized_array<Number>(0.);
-    scalar ref_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar values[2] = {dealii::make_vectorized_array<Number>(0.),
+                        dealii::make_vectorized_array<Number>(0.)};
 
-    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-    {
-      vector velocity = integrator.get_value(q);
-      ref_vec += integrator.JxW(q) * velocity.norm();
-      div_vec += integrator.JxW(q) * std::abs(integrator.get_divergence(q));
-    }
+    integrate_divergence(integrator, values);
 
     // sum over entries of dealii::VectorizedArray, but only over those that are "active"
     for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
     {
-      div += div_vec[v];
-      ref += ref_vec[v];
+      div += values[0][v];
+      ref += values[1][v];
     }
   }
 
-  dst.at(0) += div * data.reference_length_scale;
+  dst.at(0) += div;
   dst.at(1) += ref;
 }
 
@@ -164,24 +225,16 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_face(
     integrator_p.read_dof_values(source);
     integrator_p.evaluate(dealii::EvaluationFlags::values);
 
-    scalar diff_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
-    scalar mean_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar values[2] = {dealii::make_vectorized_array<Number>(0.),
+                        dealii::make_vectorized_array<Number>(0.)};
 
-    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
-    {
-      diff_mass_flux_vec +=
-        integrator_m.JxW(q) * std::abs((integrator_m.get_value(q) - integrator_p.get_value(q)) *
-                                       integrator_m.get_normal_vector(q));
-      mean_mass_flux_vec += integrator_m.JxW(q) *
-                            std::abs(0.5 * (integrator_m.get_value(q) + integrator_p.get_value(q)) *
-                                     integrator_m.get_normal_vector(q));
-    }
+    integrate_mass_flux(integrator_m, integrator_p, values);
 
     // sum over entries of dealii::VectorizedArray, but only over those that are "active"
     for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
     {
-      diff_mass_flux += diff_mass_flux_vec[v];
-      mean_mass_flux += mean_mass_flux_vec[v];
+      diff_mass_flux += values[0][v];
+      mean_mass_flux += values[1][v];
     }
   }
 
@@ -199,81 +252,91 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_boundary_face(
 {
 }
 
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::write_results(Number const div_error,
+                                                             Number const div_error_reference,
+                                                             Number const mass_error,
+                                                             Number const mass_error_reference,
+                                                             double const time,
+                                                             int const    time_step_number)
+{
+  Number div_error_normalized  = div_error * data.reference_length_scale / div_error_reference;
+  Number mass_error_normalized = 1.0;
+  if(mass_error_reference > 1.e-12)
+    mass_error_normalized = mass_error / mass_error_reference;
+  else
+    mass_error_normalized = mass_error;
+
+  if(time_step_number >= 0) // unsteady problem
+    analyze_div_and_mass_error_unsteady(div_error_normalized,
+                                        mass_error_normalized,
+                                        time,
+                                        time_step_number);
+  else // steady problem (time_step_number = -1)
+    analyze_div_and_mass_error_steady(div_error_normalized, mass_error_normalized);
+}
+
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unsteady(
-  VectorType const & velocity,
+  Number const       div_error_normalized,
+  Number const       mass_error_normalized,
   double const       time,
   unsigned int const time_step_number)
 {
-  if(time > data.start_time - 1.e-10)
+  // write output file
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
-    Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-    // calculate divergence and mass error
-    do_evaluate(
-      *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
+    std::string filename = data.directory + data.filename + ".div_mass_error_timeseries";
 
-    Number div_error_normalized  = div_error / div_error_reference;
-    Number mass_error_normalized = 1.0;
-    if(mass_error_reference > 1.e-12)
-      mass_error_normalized = mass_error / mass_error_reference;
+    std::ofstream f;
+    if(clear_files_mass_error == true)
+    {
+      f.open(filename.c_str(), std::ios::trunc);
+      f << "Error incompressibility constraint:" << std::endl
+        << std::endl
+        << "  (1,|divu|)_Omega/(1,1)_Omega" << std::endl
+        << std::endl
+        << "Error mass flux over interior element faces:" << std::endl
+        << std::endl
+        << "  (1,|(um - up)*n|)_dOmegaI / (1,|0.5(um + up)*n|)_dOmegaI" << std::endl
+        << std::endl
+        << "       t        |  divergence  |    mass       " << std::endl;
+
+      clear_files_mass_error = false;
+    }
     else
-      mass_error_normalized = mass_error;
+    {
+      f.open(filename.c_str(), std::ios::app);
+    }
+
+    f << std::scientific << std::setprecision(7) << std::setw(15) << time << std::setw(15)
+      << div_error_normalized << std::setw(15) << mass_error_normalized << std::endl;
+  }
+
+  if(time_step_number % data.sample_every_time_steps == 0)
+  {
+    // calculate average error
+    ++number_of_samples;
+    divergence_sample += div_error_normalized;
+    mass_sample += mass_error_normalized;
 
     // write output file
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
     {
-      std::string filename = data.directory + data.filename + ".div_mass_error_timeseries";
+      std::string filename = data.directory + data.filename + ".div_mass_error_average";
 
       std::ofstream f;
-      if(clear_files_mass_error == true)
-      {
-        f.open(filename.c_str(), std::ios::trunc);
-        f << "Error incompressibility constraint:" << std::endl
-          << std::endl
-          << "  (1,|divu|)_Omega/(1,1)_Omega" << std::endl
-          << std::endl
-          << "Error mass flux over interior element faces:" << std::endl
-          << std::endl
-          << "  (1,|(um - up)*n|)_dOmegaI / (1,|0.5(um + up)*n|)_dOmegaI" << std::endl
-          << std::endl
-          << "       t        |  divergence  |    mass       " << std::endl;
-
-        clear_files_mass_error = false;
-      }
-      else
-      {
-        f.open(filename.c_str(), std::ios::app);
-      }
 
-      f << std::scientific << std::setprecision(7) << std::setw(15) << time << std::setw(15)
-        << div_error_normalized << std::setw(15) << mass_error_normalized << std::endl;
-    }
-
-    if(time_step_number % data.sample_every_time_steps == 0)
-    {
-      // calculate average error
-      ++number_of_samples;
-      divergence_sample += div_error_normalized;
-      mass_sample += mass_error_normalized;
-
-      // write output file
-      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-      {
-        std::string filename = data.directory + data.filename + ".div_mass_error_average";
-
-        std::ofstream f;
-
-        f.open(filename.c_str(), std::ios::trunc);
-        f << "Divergence and mass error (averaged over time)" << std::endl;
-        f << "Number of samples:   " << number_of_samples << std::endl;
-        f << "Mean error incompressibility constraint:   " << divergence_sample / number_of_samples
-          << std::endl;
-        f << "Mean error mass flux over interior element faces:  "
-          << mass_sample / number_of_samples << std::endl;
-        f.close();
-      }
+      f.open(filename.c_str(), std::ios::trunc);
+      f << "Divergence and mass error (averaged over time)" << std::endl;
+      f << "Number of samples:   " << number_of_samples << std::endl;
+      f << "Mean error incompressibility constraint:   " << divergence_sample / number_of_samples
+        << std::endl;
+      f << "Mean error mass flux over interior element faces:  "
+        << mass_sample / number_of_samples << std::endl;
+      f.close();
     }
   }
 }
@@ -281,21 +344,9 @@ DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unstea
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_steady(
-  VectorType const & velocity)
+  Number const div_error_normalized,
+  Number const mass_error_normalized)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
-  Number div_error_normalized  = div_error / div_error_reference;
-  Number mass_error_normalized = 1.0;
-  if(mass_error_reference > 1.e-12)
-    mass_error_normalized = mass_error / mass_error_reference;
-  else
-    mass_error_normalized = mass_error;
-
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/integral_scheduler.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -82,11 +83,17 @@ public:
 
   DivergenceAndMassErrorCalculator(MPI_Comm const & comm);
 
+  /*
+   * If an integral scheduler is provided, the errors are evaluated together with the other
+   * integrals of the scheduler, and the results are written once the reduction of the scheduler has
+   * been completed.
+   */
   void
-  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-        unsigned int const                      dof_index_in,
-        unsigned int const                      quad_index_in,
-        MassConservationData const &            data_in);
+  setup(dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+        unsigned int const                                    dof_index_in,
+        unsigned int const                                    quad_index_in,
+        MassConservationData const &                          data_in,
+        std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in = nullptr);
 
   void
   evaluate(VectorType const & velocity, double const & time, int const & time_step_number);
@@ -112,6 +119,21 @@ private:
               Number &                                mass_error,
               Number &                                mass_error_reference);
 
+  /*
+   *  Contributions of one batch of cells to the divergence error (without the reference length
+   *  scale) and its reference value.
+   */
+  static void
+  integrate_divergence(CellIntegratorU & integrator, scalar * values);
+
+  /*
+   *  Contributions of one batch of interior faces to the mass error and its reference value.
+   */
+  static void
+  integrate_mass_flux(FaceIntegratorU & integrator_m,
+                      FaceIntegratorU & integrator_p,
+                      scalar *          values);
+
   void
   local_compute_div(dealii::MatrixFree<dim, Number> const &       data,
                     std::vector<Number> &                         dst,
@@ -132,12 +154,22 @@ private:
                                   const std::pair<unsigned int, unsigned int> &);
 
   void
-  analyze_div_and_mass_error_unsteady(VectorType const & velocity,
+  analyze_div_and_mass_error_unsteady(Number const       div_error_normalized,
+                                      Number const       mass_error_normalized,
                                       double const       time,
                                       unsigned int const time_step_number);
 
   void
-  analyze_div_and_mass_error_steady(VectorType const & velocity);
+  analyze_div_and_mass_error_steady(Number const div_error_normalized,
+                                    Number const mass_error_normalized);
+
+  void
+  write_results(Number const div_error,
+                Number const div_error_reference,
+                Number const mass_error,
+                Number const mass_error_reference,
+                double const time,
+                int const    time_step_number);
 
   MPI_Comm const mpi_comm;
 
@@ -149,6 +181,9 @@ private:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   MassConservationData                    data;
+
+  std::shared_ptr<IntegralScheduler<dim, Number>> integral_scheduler;
+  std::vector<unsigned int>                       integral_indices;
 };
 
 
@@ -38,13 +38,15 @@ KineticEnergyCalculatorDetailed<dim, Number>::KineticEnergyCalculatorDetailed(MP
 template<int dim, typename Number>
 void
 KineticEnergyCalculatorDetailed<dim, Number>::setup(
-  NavierStokesOperator const &            navier_stokes_operator_in,
-  dealii::MatrixFree<dim, Number> const & matrix_free_in,
-  unsigned int const                      dof_index_in,
-  unsigned int const                      quad_index_in,
-  KineticEnergyData const &               kinetic_energy_data_in)
+  NavierStokesOperator const &                          navier_stokes_operator_in,
+  dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+  unsigned int const                                    dof_index_in,
+  unsigned int const                                    quad_index_in,
+  KineticEnergyData const &                             kinetic_energy_data_in,
+  std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in)
 {
-  Base::setup(matrix_free_in, dof_index_in, quad_index_in, kinetic_energy_data_in);
+  Base::setup(
+    matrix_free_in, dof_index_in, quad_index_in, kinetic_energy_data_in, integral_scheduler_in);
 
   navier_stokes_operator = &navier_stokes_operator_in;
 }
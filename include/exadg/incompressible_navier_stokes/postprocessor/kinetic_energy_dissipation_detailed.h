@@ -42,11 +42,12 @@ public:
   KineticEnergyCalculatorDetailed(MPI_Comm const & comm);
 
   void
-  setup(NavierStokesOperator const &            navier_stokes_operator_in,
-        dealii::MatrixFree<dim, Number> const & matrix_free_in,
-        unsigned int const                      dof_index_in,
-        unsigned int const                      quad_index_in,
-        KineticEnergyData const &               kinetic_energy_data_in);
+  setup(NavierStokesOperator const &                          navier_stokes_operator_in,
+        dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+        unsigned int const                                    dof_index_in,
+        unsigned int const                                    quad_index_in,
+        KineticEnergyData const &                             kinetic_energy_data_in,
+        std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in = nullptr);
 
   void
   evaluate(VectorType const & velocity, double const & time, int const & time_step_number);
@@ -32,7 +32,7 @@ namespace IncNS
 {
 template<int dim, typename Number>
 LinePlotCalculator<dim, Number>::LinePlotCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true)
+  : mpi_comm(comm), clear_files(true), evaluate_velocity(false), evaluate_pressure(false)
 {
 }
 
@@ -40,16 +40,39 @@ template<int dim, typename Number>
 void
 LinePlotCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
                                        dealii::DoFHandler<dim> const & dof_handler_pressure_in,
-                                       dealii::Mapping<dim> const &    mapping_in,
+                                       std::shared_ptr<PointEvaluator<dim>>   point_evaluator_in,
                                        LinePlotDataInstantaneous<dim> const & line_plot_data_in)
 {
   dof_handler_velocity = &dof_handler_velocity_in;
   dof_handler_pressure = &dof_handler_pressure_in;
-  mapping              = &mapping_in;
+  point_evaluator      = point_evaluator_in;
   data                 = line_plot_data_in;
 
   if(data.calculate)
+  {
     create_directories(data.line_data.directory, mpi_comm);
+
+    // register the points of all lines with the point evaluator
+    for(auto const & line : data.line_data.lines)
+    {
+      unsigned int const              n_points = line->n_points;
+      std::vector<dealii::Point<dim>> points(n_points);
+
+      // we consider straight lines with an equidistant distribution of points along the line
+      for(unsigned int i = 0; i < n_points; ++i)
+        points[i] = line->begin + double(i) / double(n_points - 1) * (line->end - line->begin);
+
+      line_offsets.push_back(point_evaluator->add_points(points));
+
+      for(auto const & quantity : line->quantities)
+      {
+        if(quantity->type == QuantityType::Velocity)
+          evaluate_velocity = true;
+        else if(quantity->type == QuantityType::Pressure)
+          evaluate_pressure = true;
+      }
+    }
+  }
 }
 
 template<int dim, typename Number>
@@ -62,43 +85,38 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
     // precision
     unsigned int const precision = data.line_data.precision;
 
+    // evaluate all points of all lines at once, values are only available on the root process
+    std::vector<dealii::Tensor<1, dim, Number>> velocity_values;
+    if(evaluate_velocity)
+      velocity_values =
+        point_evaluator->template evaluate<dim, Number>(*dof_handler_velocity, velocity);
+
+    std::vector<Number> pressure_values;
+    if(evaluate_pressure)
+      pressure_values =
+        point_evaluator->template evaluate<1, Number>(*dof_handler_pressure, pressure);
+
+    std::vector<dealii::Point<dim>> const & points = point_evaluator->get_points();
+
     // loop over all lines
-    for(typename std::vector<std::shared_ptr<Line<dim>>>::const_iterator line =
-          data.line_data.lines.begin();
-        line != data.line_data.lines.end();
-        ++line)
+    for(unsigned int l = 0; l < data.line_data.lines.size(); ++l)
     {
-      // store all points along current line in a vector
-      unsigned int                    n_points = (*line)->n_points;
-      std::vector<dealii::Point<dim>> points(n_points);
+      std::shared_ptr<Line<dim>> const & line = data.line_data.lines[l];
 
-      // we consider straight lines with an equidistant distribution of points along the line
-      for(unsigned int i = 0; i < n_points; ++i)
-        points[i] =
-          (*line)->begin + double(i) / double(n_points - 1) * ((*line)->end - (*line)->begin);
+      unsigned int const n_points = line->n_points;
+      unsigned int const offset   = line_offsets[l];
 
       // filename prefix for current line
-      std::string filename_prefix = data.line_data.directory + (*line)->name;
+      std::string filename_prefix = data.line_data.directory + line->name;
 
       // write output for all specified quantities
       for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            (*line)->quantities.begin();
-          quantity != (*line)->quantities.end();
+            line->quantities.begin();
+          quantity != line->quantities.end();
           ++quantity)
       {
         if((*quantity)->type == QuantityType::Velocity)
         {
-          std::vector<dealii::Tensor<1, dim, Number>> solution_vector(n_points);
-
-          // calculate velocity for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            dealii::Tensor<1, dim, Number> u;
-            evaluate_vectorial_quantity_in_point(
-              u, *dof_handler_velocity, *mapping, velocity, points[i], mpi_comm);
-            solution_vector[i] = u;
-          }
-
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
           {
@@ -130,9 +148,9 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
 
               // write data
               for(unsigned int d = 0; d < dim; ++d)
-                f << std::setw(precision + 8) << std::left << points[i][d];
+                f << std::setw(precision + 8) << std::left << points[offset + i][d];
               for(unsigned int d = 0; d < dim; ++d)
-                f << std::setw(precision + 8) << std::left << solution_vector[i][d];
+                f << std::setw(precision + 8) << std::left << velocity_values[offset + i][d];
               f << std::endl;
             }
             f.close();
@@ -140,17 +158,6 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
         }
         else if((*quantity)->type == QuantityType::Pressure)
         {
-          std::vector<Number> solution_vector(n_points);
-
-          // calculate pressure for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            Number p;
-            evaluate_scalar_quantity_in_point(
-              p, *dof_handler_pressure, *mapping, pressure, points[i], mpi_comm);
-            solution_vector[i] = p;
-          }
-
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
           {
@@ -180,8 +187,8 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
 
               // write data
               for(unsigned int d = 0; d < dim; ++d)
-                f << std::setw(precision + 8) << std::left << points[i][d];
-              f << std::setw(precision + 8) << std::left << solution_vector[i];
+                f << std::setw(precision + 8) << std::left << points[offset + i][d];
+              f << std::setw(precision + 8) << std::left << pressure_values[offset + i];
               f << std::endl;
             }
             f.close();
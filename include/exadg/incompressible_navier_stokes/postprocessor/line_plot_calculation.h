@@ -23,7 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_LINE_PLOT_CALCULATION_H_
 
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
-#include <exadg/vector_tools/point_value.h>
+#include <exadg/postprocessor/point_evaluator.h>
 
 namespace ExaDG
 {
@@ -49,7 +49,7 @@ public:
   void
   setup(dealii::DoFHandler<dim> const &        dof_handler_velocity_in,
         dealii::DoFHandler<dim> const &        dof_handler_pressure_in,
-        dealii::Mapping<dim> const &           mapping_in,
+        std::shared_ptr<PointEvaluator<dim>>   point_evaluator_in,
         LinePlotDataInstantaneous<dim> const & line_plot_data_in);
 
   void
@@ -62,9 +62,17 @@ private:
 
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
-  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  // shared with other postprocessors evaluating quantities in points
+  std::shared_ptr<PointEvaluator<dim>> point_evaluator;
 
   LinePlotDataInstantaneous<dim> data;
+
+  // index of the first point of each line in the points of the point evaluator
+  std::vector<unsigned int> line_offsets;
+
+  bool evaluate_velocity;
+  bool evaluate_pressure;
 };
 
 } // namespace IncNS
@@ -44,11 +44,6 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
 {
 }
 
-template<int dim, typename Number>
-PostProcessor<dim, Number>::~PostProcessor()
-{
-}
-
 template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::setup(Operator const & pde_operator)
@@ -67,27 +62,40 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                            *pde_operator.get_mapping(),
                            pp_data.error_data_p);
 
+  integral_scheduler = std::make_shared<IntegralScheduler<dim, Number>>(mpi_comm);
+  integral_scheduler->setup(pde_operator.get_matrix_free(),
+                            pde_operator.get_dof_index_velocity(),
+                            pde_operator.get_dof_index_pressure(),
+                            pde_operator.get_quad_index_velocity_linear());
+
   lift_and_drag_calculator.setup(pde_operator.get_dof_handler_u(),
                                  pde_operator.get_matrix_free(),
                                  pde_operator.get_dof_index_velocity(),
                                  pde_operator.get_dof_index_pressure(),
                                  pde_operator.get_quad_index_velocity_linear(),
-                                 pp_data.lift_and_drag_data);
+                                 pp_data.lift_and_drag_data,
+                                 integral_scheduler);
+
+  point_evaluator = std::make_shared<PointEvaluator<dim>>(mpi_comm);
+  point_evaluator->reinit(*pde_operator.get_mapping(),
+                          pde_operator.get_dof_handler_u().get_triangulation());
 
   pressure_difference_calculator.setup(pde_operator.get_dof_handler_p(),
-                                       *pde_operator.get_mapping(),
+                                       point_evaluator,
                                        pp_data.pressure_difference_data);
 
   div_and_mass_error_calculator.setup(pde_operator.get_matrix_free(),
                                       pde_operator.get_dof_index_velocity(),
                                       pde_operator.get_quad_index_velocity_linear(),
-                                      pp_data.mass_data);
+                                      pp_data.mass_data,
+                                      integral_scheduler);
 
   kinetic_energy_calculator.setup(pde_operator,
                                   pde_operator.get_matrix_free(),
                                   pde_operator.get_dof_index_velocity(),
                                   pde_operator.get_quad_index_velocity_linear(),
-                                  pp_data.kinetic_energy_data);
+                                  pp_data.kinetic_energy_data,
+                                  integral_scheduler);
 
   kinetic_energy_spectrum_calculator.setup(pde_operator.get_matrix_free(),
                                            pde_operator.get_dof_handler_u(),
@@ -95,10 +103,18 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
 
   line_plot_calculator.setup(pde_operator.get_dof_handler_u(),
                              pde_operator.get_dof_handler_p(),
-                             *pde_operator.get_mapping(),
+                             point_evaluator,
                              pp_data.line_plot_data);
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::update_after_grid_motion()
+{
+  // points have to be located again in the deformed mesh
+  point_evaluator->invalidate();
+}
+
 template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
@@ -106,6 +122,12 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
                                               double const       time,
                                               int const          time_step_number)
 {
+  /*
+   *  complete the reduction of the integrals requested in the previous output step and write the
+   *  results
+   */
+  integral_scheduler->finish();
+
   /*
    *  write output
    */
@@ -137,6 +159,12 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
    */
   kinetic_energy_calculator.evaluate(velocity, time, time_step_number);
 
+  /*
+   *  evaluate the integrals requested above in one loop and start the reduction, which is completed
+   *  in the next output step or in finalize()
+   */
+  integral_scheduler->start(velocity, pressure);
+
   /*
    *  calculation of kinetic energy spectrum
    */
@@ -148,6 +176,15 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
   line_plot_calculator.evaluate(velocity, pressure);
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::finalize()
+{
+  // complete the reduction of the integrals requested in the last output step and write the
+  // results
+  integral_scheduler->finish();
+}
+
 template class PostProcessor<2, float>;
 template class PostProcessor<2, double>;
 
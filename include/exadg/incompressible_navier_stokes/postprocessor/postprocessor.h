@@ -28,8 +28,10 @@
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/postprocessor/error_calculation.h>
+#include <exadg/postprocessor/integral_scheduler.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
+#include <exadg/postprocessor/point_evaluator.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 
 namespace ExaDG
@@ -66,17 +68,21 @@ public:
 
   PostProcessor(PostProcessorData<dim> const & postprocessor_data, MPI_Comm const & mpi_comm);
 
-  virtual ~PostProcessor();
-
   void
   setup(Operator const & pde_operator) override;
 
+  void
+  update_after_grid_motion() override;
+
   void
   do_postprocessing(VectorType const & velocity,
                     VectorType const & pressure,
                     double const       time             = 0.0,
                     int const          time_step_number = -1) override;
 
+  void
+  finalize() override;
+
 protected:
   MPI_Comm const mpi_comm;
 
@@ -90,9 +96,16 @@ private:
   ErrorCalculator<dim, Number> error_calculator_u;
   ErrorCalculator<dim, Number> error_calculator_p;
 
+  // evaluate integrals of several postprocessors in one loop and with one global reduction
+  std::shared_ptr<IntegralScheduler<dim, Number>> integral_scheduler;
+
   // calculate lift and drag forces for flow around bodies
   LiftAndDragCalculator<dim, Number> lift_and_drag_calculator;
 
+  // evaluate quantities in points, shared by all postprocessors that evaluate the solution in
+  // points (the points are located only once)
+  std::shared_ptr<PointEvaluator<dim>> point_evaluator;
+
   // calculate pressure difference between two points, e.g., the leading and trailing edge of a body
   PressureDifferenceCalculator<dim, Number> pressure_difference_calculator;
 
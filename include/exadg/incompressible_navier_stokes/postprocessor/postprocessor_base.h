@@ -52,6 +52,14 @@ public:
    */
   virtual void
   setup(Operator const & pde_operator) = 0;
+
+  /*
+   * Update data structures that depend on the geometry after the mesh has been moved.
+   */
+  virtual void
+  update_after_grid_motion()
+  {
+  }
 };
 
 
@@ -47,6 +47,13 @@ public:
                     VectorType const & pressure,
                     double const       time             = 0.0,
                     int const          time_step_number = -1) = 0;
+
+  /*
+   * Completes postprocessing operations of the last call to do_postprocessing() that are still
+   * pending. This function is collective and has to be called after the last time step.
+   */
+  virtual void
+  finalize() = 0;
 };
 
 } // namespace IncNS
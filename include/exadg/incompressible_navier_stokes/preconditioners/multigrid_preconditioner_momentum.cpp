@@ -27,7 +27,7 @@ namespace IncNS
 {
 template<int dim, typename Number>
 MultigridPreconditioner<dim, Number>::MultigridPreconditioner(MPI_Comm const & comm)
-  : Base(comm),
+  : Base(comm, "Multigrid momentum"),
     pde_operator(nullptr),
     mg_operator_type(MultigridOperatorType::ReactionDiffusion),
     mesh_is_moving(false)
@@ -29,7 +29,7 @@ namespace IncNS
 template<int dim, typename Number>
 MultigridPreconditionerProjection<dim, Number>::MultigridPreconditionerProjection(
   MPI_Comm const & mpi_comm)
-  : Base(mpi_comm), pde_operator(nullptr), mesh_is_moving(false)
+  : Base(mpi_comm, "Multigrid projection"), pde_operator(nullptr), mesh_is_moving(false)
 {
 }
 
@@ -27,6 +27,7 @@
 
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -42,6 +43,9 @@ create_input_file(std::string const & input_file)
   GeneralParameters general;
   general.add_parameters(prm);
 
+  ProfilerParameters profiler;
+  profiler.add_parameters(prm);
+
   SpatialResolutionParameters spatial;
   spatial.add_parameters(prm);
 
@@ -71,6 +75,8 @@ run(std::string const & input_file,
   dealii::Timer timer;
   timer.restart();
 
+  Profiler::instance().reinit(ProfilerParameters(input_file), mpi_comm);
+
   std::shared_ptr<IncNS::ApplicationBase<dim, Number>> application =
     IncNS::get_application<dim, Number>(input_file, mpi_comm);
 
@@ -84,7 +90,14 @@ run(std::string const & input_file,
   driver->solve();
 
   if(not(is_test))
+  {
     driver->print_performance_results(timer.wall_time());
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    Profiler::instance().print_summary(pcout, mpi_comm);
+    Profiler::instance().write_results(mpi_comm);
+  }
 }
 
 } // namespace ExaDG
@@ -678,6 +678,7 @@ OperatorCoupled<dim, Number>::setup_pressure_convection_diffusion_operator()
     boundary_descriptor->neumann_bc.insert(
       std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>(*it, dummy));
   }
+  boundary_descriptor->set_vectorized_functions();
 
   // convective operator:
   // use numerical velocity field with dof index of velocity field and local Lax-Friedrichs flux to
@@ -812,7 +812,8 @@ OperatorDualSplitting<dim, Number>::local_interpolate_velocity_dirichlet_bc_boun
 
         if(boundary_type == BoundaryTypeU::Dirichlet)
         {
-          auto bc = this->boundary_descriptor->velocity->dirichlet_bc.find(boundary_id)->second;
+          auto bc =
+            this->boundary_descriptor->velocity->dirichlet_bc_vectorized.find(boundary_id)->second;
           auto q_points = integrator.quadrature_point(q);
 
           g = FunctionEvaluator<1, dim, Number>::value(bc, q_points, this->evaluation_time);
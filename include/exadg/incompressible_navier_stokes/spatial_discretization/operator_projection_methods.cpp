@@ -137,6 +137,9 @@ OperatorProjectionMethods<dim, Number>::initialize_laplace_operator()
   laplace_operator_data.use_cell_based_loops = this->param.use_cell_based_face_loops;
   laplace_operator_data.implement_block_diagonal_preconditioner_matrix_free =
     this->param.implement_block_diagonal_preconditioner_matrix_free;
+  laplace_operator_data.compact_block_diagonal_storage  = this->param.compact_block_diagonal_storage;
+  laplace_operator_data.block_diagonal_single_precision = this->param.block_diagonal_single_precision;
+  laplace_operator_data.preconditioner_block_diagonal   = this->param.preconditioner_block_diagonal;
 
   laplace_operator_data.kernel_data.IP_factor = this->param.IP_factor_pressure;
 
@@ -54,6 +54,9 @@ public:
   reinit(RHSKernelData<dim> const & data_in) const
   {
     data = data_in;
+
+    f                   = make_function_vectorized(data.f);
+    gravitational_force = make_function_vectorized(data.gravitational_force);
   }
 
   static MappingFlags
@@ -81,11 +84,11 @@ public:
   {
     dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-    vector f = FunctionEvaluator<1, dim, Number>::value(data.f, q_points, time);
+    vector f = FunctionEvaluator<1, dim, Number>::value(this->f, q_points, time);
 
     if(data.boussinesq_term)
     {
-      vector g = FunctionEvaluator<1, dim, Number>::value(data.gravitational_force, q_points, time);
+      vector g = FunctionEvaluator<1, dim, Number>::value(gravitational_force, q_points, time);
       scalar T = integrator_temperature.get_value(q);
       scalar T_ref = data.reference_temperature;
       // solve only for the dynamic pressure variations
@@ -100,6 +103,9 @@ public:
 
 private:
   mutable RHSKernelData<dim> data;
+
+  // vectorized representation of the functions in data, resolved once in reinit()
+  mutable std::shared_ptr<FunctionVectorized<dim>> f, gravitational_force;
 };
 
 } // namespace Operators
@@ -30,6 +30,8 @@ struct ViscousKernelData
       penalty_term_div_formulation(PenaltyTermDivergenceFormulation::Symmetrized),
       IP_formulation(InteriorPenaltyFormulation::SIPG),
       viscosity_is_variable(false),
+      viscosity_storage(VariableCoefficientsStorage::Full),
+      viscosity_storage_degree(1),
       variable_normal_vector(false)
   {
   }
@@ -40,6 +42,8 @@ struct ViscousKernelData
   PenaltyTermDivergenceFormulation penalty_term_div_formulation;
   InteriorPenaltyFormulation       IP_formulation;
   bool                             viscosity_is_variable;
+  VariableCoefficientsStorage      viscosity_storage;
+  unsigned int                     viscosity_storage_degree;
   bool                             variable_normal_vector;
 };
 
@@ -76,7 +80,11 @@ public:
     if(data.viscosity_is_variable)
     {
       // allocate vectors for variable coefficients and initialize with constant viscosity
-      viscosity_coefficients.initialize(matrix_free, degree, data.viscosity);
+      viscosity_coefficients.initialize(matrix_free,
+                                        degree,
+                                        data.viscosity,
+                                        data.viscosity_storage,
+                                        data.viscosity_storage_degree);
     }
   }
 
@@ -93,28 +101,37 @@ public:
     return this->data;
   }
 
+  /*
+   *  The functions below set the viscosity in all quadrature points of a cell/face batch.
+   */
   void
-  set_coefficient_cell(unsigned int const cell, unsigned int const q, scalar const & value)
+  set_coefficients_cell(unsigned int const cell, scalar const * values)
   {
-    viscosity_coefficients.set_coefficient_cell(cell, q, value);
+    viscosity_coefficients.set_coefficients_cell(cell, values);
   }
 
   scalar
-  get_coefficient_face(unsigned int const face, unsigned int const q)
+  get_coefficient_face(unsigned int const face, unsigned int const q) const
   {
     return viscosity_coefficients.get_coefficient_face(face, q);
   }
 
   void
-  set_coefficient_face(unsigned int const face, unsigned int const q, scalar const & value)
+  set_coefficients_face(unsigned int const face, scalar const * values)
   {
-    viscosity_coefficients.set_coefficient_face(face, q, value);
+    viscosity_coefficients.set_coefficients_face(face, values);
   }
 
   void
-  set_coefficient_face_neighbor(unsigned int const face, unsigned int const q, scalar const & value)
+  set_coefficients_face_neighbor(unsigned int const face, scalar const * values)
+  {
+    viscosity_coefficients.set_coefficients_face_neighbor(face, values);
+  }
+
+  VariableCoefficients<dim, Number> const &
+  get_viscosity_coefficients() const
   {
-    viscosity_coefficients.set_coefficient_face_neighbor(face, q, value);
+    return viscosity_coefficients;
   }
 
   IntegratorFlags
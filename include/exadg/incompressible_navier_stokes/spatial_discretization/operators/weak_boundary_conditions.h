@@ -87,7 +87,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryTypeU::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+        auto bc       = boundary_descriptor->dirichlet_bc_vectorized.find(boundary_id)->second;
         auto q_points = integrator.quadrature_point(q);
 
         g = FunctionEvaluator<1, dim, Number>::value(bc, q_points, time);
@@ -167,7 +167,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
     if(boundary_type == BoundaryTypeU::Dirichlet)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+      auto bc       = boundary_descriptor->dirichlet_bc_vectorized.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       g = FunctionEvaluator<1, dim, Number>::value(bc, q_points, time);
@@ -329,7 +329,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full || operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+      auto bc       = boundary_descriptor->dirichlet_bc_vectorized.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       dealii::VectorizedArray<Number> g =
@@ -454,16 +454,17 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full || operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> h;
       if(variable_normal_vector == false)
       {
-        h = FunctionEvaluator<1, dim, Number>::value(bc, q_points, time);
+        auto bc = boundary_descriptor->neumann_bc_vectorized.find(boundary_id)->second;
+        h       = FunctionEvaluator<1, dim, Number>::value(bc, q_points, time);
       }
       else
       {
+        auto bc        = boundary_descriptor->neumann_bc.find(boundary_id)->second;
         auto normals_m = integrator.get_normal_vector(q);
         h              = FunctionEvaluator<1, dim, Number>::value(bc, q_points, normals_m, time);
       }
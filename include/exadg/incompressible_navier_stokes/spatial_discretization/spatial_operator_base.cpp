@@ -243,6 +243,8 @@ SpatialOperatorBase<dim, Number>::initialize_boundary_descriptor_laplace()
       std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>(*it,
                                                                                     zero_function));
   }
+
+  boundary_descriptor_laplace->set_vectorized_functions();
 }
 
 template<int dim, typename Number>
@@ -313,6 +315,9 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   viscous_kernel_data.penalty_term_div_formulation = param.penalty_term_div_formulation;
   viscous_kernel_data.IP_formulation               = param.IP_formulation_viscous;
   viscous_kernel_data.viscosity_is_variable        = param.use_turbulence_model;
+  viscous_kernel_data.viscosity_storage            = param.turbulence_model_viscosity_storage;
+  viscous_kernel_data.viscosity_storage_degree =
+    param.turbulence_model_viscosity_storage_degree;
   viscous_kernel_data.variable_normal_vector       = param.neumann_with_variable_normal_vector;
   viscous_kernel = std::make_shared<Operators::ViscousKernel<dim, Number>>();
   viscous_kernel->reinit(*matrix_free, viscous_kernel_data, get_dof_index_velocity());
@@ -419,11 +424,13 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   data.use_cell_based_loops = param.use_cell_based_face_loops;
   data.implement_block_diagonal_preconditioner_matrix_free =
     param.implement_block_diagonal_preconditioner_matrix_free;
+  data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+  data.block_diagonal_single_precision = param.block_diagonal_single_precision;
   if(data.convective_problem)
     data.solver_block_diagonal = Elementwise::Solver::GMRES;
   else
     data.solver_block_diagonal = Elementwise::Solver::CG;
-  data.preconditioner_block_diagonal = Elementwise::Preconditioner::InverseMassMatrix;
+  data.preconditioner_block_diagonal = param.preconditioner_block_diagonal;
   data.solver_data_block_diagonal    = param.solver_data_block_diagonal;
 
   momentum_operator.initialize(
@@ -497,6 +504,8 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
       data.use_cell_based_loops   = param.use_cell_based_face_loops;
       data.implement_block_diagonal_preconditioner_matrix_free =
         param.implement_block_diagonal_preconditioner_matrix_free;
+      data.compact_block_diagonal_storage  = param.compact_block_diagonal_storage;
+      data.block_diagonal_single_precision = param.block_diagonal_single_precision;
       data.solver_block_diagonal         = Elementwise::Solver::CG;
       data.preconditioner_block_diagonal = param.preconditioner_block_diagonal_projection;
       data.solver_data_block_diagonal    = param.solver_data_block_diagonal_projection;
@@ -749,11 +758,18 @@ SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const
 
   bool const viscosity_is_variable = param.use_turbulence_model;
   if(viscosity_is_variable)
-    viscous_kernel->get_coefficient_face(face, q);
+    viscosity = viscous_kernel->get_coefficient_face(face, q);
 
   return viscosity;
 }
 
+template<int dim, typename Number>
+Operators::ViscousKernel<dim, Number> const &
+SpatialOperatorBase<dim, Number>::get_viscous_kernel() const
+{
+  return *viscous_kernel;
+}
+
 template<int dim, typename Number>
 std::shared_ptr<ContainerInterfaceData<dim, dim, Number>>
 SpatialOperatorBase<dim, Number>::get_container_interface_data()
@@ -1104,6 +1120,7 @@ SpatialOperatorBase<dim, Number>::compute_streamfunction(VectorType &       dst,
 
   // fill boundary descriptor: Assumption: only Dirichlet BC's
   boundary_descriptor_streamfunction->dirichlet_bc = boundary_descriptor->velocity->dirichlet_bc;
+  boundary_descriptor_streamfunction->set_vectorized_functions();
 
   AssertThrow(boundary_descriptor->velocity->neumann_bc.empty() == true,
               dealii::ExcMessage("Assumption is not fulfilled. Streamfunction calculator is "
@@ -190,6 +190,9 @@ public:
   dealii::VectorizedArray<Number>
   get_viscosity_boundary_face(unsigned int const face, unsigned int const q) const;
 
+  Operators::ViscousKernel<dim, Number> const &
+  get_viscous_kernel() const;
+
   // Multiphysics coupling via "Cached" boundary conditions
   std::shared_ptr<ContainerInterfaceData<dim, dim, Number>>
   get_container_interface_data();
@@ -69,6 +69,8 @@ TurbulenceModel<dim, Number>::cell_loop_set_coefficients(
 {
   CellIntegratorU integrator(matrix_free, turb_model_data.dof_index, turb_model_data.quad_index);
 
+  dealii::AlignedVector<scalar> viscosity(integrator.n_q_points);
+
   // loop over all cells
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
@@ -84,16 +86,19 @@ TurbulenceModel<dim, Number>::cell_loop_set_coefficients(
     // loop over all quadrature points
     for(unsigned int q = 0; q < integrator.n_q_points; ++q)
     {
-      scalar viscosity = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
+      viscosity[q] = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
 
       // calculate velocity gradient
       tensor velocity_gradient = integrator.get_gradient(q);
 
-      add_turbulent_viscosity(viscosity, filter_width, velocity_gradient, turb_model_data.constant);
-
-      // set the coefficients
-      viscous_kernel->set_coefficient_cell(cell, q, viscosity);
+      add_turbulent_viscosity(viscosity[q],
+                              filter_width,
+                              velocity_gradient,
+                              turb_model_data.constant);
     }
+
+    // set the coefficients
+    viscous_kernel->set_coefficients_cell(cell, viscosity.data());
   }
 }
 
@@ -114,6 +119,9 @@ TurbulenceModel<dim, Number>::face_loop_set_coefficients(
                                turb_model_data.dof_index,
                                turb_model_data.quad_index);
 
+  dealii::AlignedVector<scalar> viscosity(integrator_m.n_q_points);
+  dealii::AlignedVector<scalar> viscosity_neighbor(integrator_m.n_q_points);
+
   // loop over all interior faces
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
@@ -134,24 +142,27 @@ TurbulenceModel<dim, Number>::face_loop_set_coefficients(
     // loop over all quadrature points
     for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
     {
-      scalar viscosity = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
-      scalar viscosity_neighbor =
+      viscosity[q] = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
+      viscosity_neighbor[q] =
         dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
 
       // calculate velocity gradient for both elements adjacent to the current face
       tensor velocity_gradient          = integrator_m.get_gradient(q);
       tensor velocity_gradient_neighbor = integrator_p.get_gradient(q);
 
-      add_turbulent_viscosity(viscosity, filter_width, velocity_gradient, turb_model_data.constant);
-      add_turbulent_viscosity(viscosity_neighbor,
+      add_turbulent_viscosity(viscosity[q],
+                              filter_width,
+                              velocity_gradient,
+                              turb_model_data.constant);
+      add_turbulent_viscosity(viscosity_neighbor[q],
                               filter_width_neighbor,
                               velocity_gradient_neighbor,
                               turb_model_data.constant);
-
-      // set the coefficients
-      viscous_kernel->set_coefficient_face(face, q, viscosity);
-      viscous_kernel->set_coefficient_face_neighbor(face, q, viscosity_neighbor);
     }
+
+    // set the coefficients
+    viscous_kernel->set_coefficients_face(face, viscosity.data());
+    viscous_kernel->set_coefficients_face_neighbor(face, viscosity_neighbor.data());
   }
 }
 
@@ -168,6 +179,8 @@ TurbulenceModel<dim, Number>::boundary_face_loop_set_coefficients(
                              turb_model_data.dof_index,
                              turb_model_data.quad_index);
 
+  dealii::AlignedVector<scalar> viscosity(integrator.n_q_points);
+
   // loop over all boundary faces
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
@@ -183,16 +196,19 @@ TurbulenceModel<dim, Number>::boundary_face_loop_set_coefficients(
     // loop over all quadrature points
     for(unsigned int q = 0; q < integrator.n_q_points; ++q)
     {
-      scalar viscosity = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
+      viscosity[q] = dealii::make_vectorized_array<Number>(turb_model_data.kinematic_viscosity);
 
       // calculate velocity gradient
       tensor velocity_gradient = integrator.get_gradient(q);
 
-      add_turbulent_viscosity(viscosity, filter_width, velocity_gradient, turb_model_data.constant);
-
-      // set the coefficients
-      viscous_kernel->set_coefficient_face(face, q, viscosity);
+      add_turbulent_viscosity(viscosity[q],
+                              filter_width,
+                              velocity_gradient,
+                              turb_model_data.constant);
     }
+
+    // set the coefficients
+    viscous_kernel->set_coefficients_face(face, viscosity.data());
   }
 }
 
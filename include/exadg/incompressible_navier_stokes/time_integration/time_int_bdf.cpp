@@ -54,7 +54,8 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     use_extrapolation(true),
     store_solution(false),
     postprocessor(postprocessor_in),
-    vec_grid_coordinates(param_in.order_time_integrator)
+    vec_grid_coordinates(param_in.order_time_integrator),
+    telemetry_column_cfl(0)
 {
 }
 
@@ -122,6 +123,28 @@ TimeIntBDF<dim, Number>::setup_derived()
       initialize_vec_convective_term();
     }
   }
+
+  this->telemetry =
+    std::make_shared<TelemetrySink>(param.telemetry_data, param.restarted_simulation, this->mpi_comm);
+
+  if(param.convective_problem())
+    telemetry_column_cfl = this->telemetry->register_column("cfl");
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::record_telemetry()
+{
+  if(param.convective_problem())
+  {
+    VectorType u_relative = get_velocity_np();
+    if(param.ale_formulation == true)
+      u_relative -= grid_velocity;
+
+    double const time_step_cfl = operator_base->calculate_time_step_cfl(u_relative);
+
+    this->telemetry->set(telemetry_column_cfl, this->get_time_step_size() / time_step_cfl);
+  }
 }
 
 template<int dim, typename Number>
@@ -194,7 +217,7 @@ TimeIntBDF<dim, Number>::initialize_vec_convective_term()
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDF<dim, Number>::read_restart_vectors(RestartInputArchive<VectorType> & ia)
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
@@ -232,7 +255,7 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive & oa) const
+TimeIntBDF<dim, Number>::write_restart_vectors(RestartOutputArchive<VectorType> & oa) const
 {
   for(unsigned int i = 0; i < this->order; i++)
   {
@@ -100,14 +100,17 @@ protected:
   setup_derived() override;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) override;
+  read_restart_vectors(RestartInputArchive<VectorType> & ia) override;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const override;
+  write_restart_vectors(RestartOutputArchive<VectorType> & oa) const override;
 
   void
   prepare_vectors_for_next_timestep() override;
 
+  void
+  record_telemetry() override;
+
   Parameters const & param;
 
   // number of refinement steps, where the time step size is reduced in
@@ -160,6 +163,9 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // telemetry column of the CFL number
+  unsigned int telemetry_column_cfl;
 };
 
 } // namespace IncNS
@@ -42,6 +42,8 @@ TimeIntBDFCoupled<dim, Number>::TimeIntBDFCoupled(
     solution(this->order),
     iterations({0, {0, 0}}),
     iterations_penalty({0, 0}),
+    telemetry_coupled_newton(0),
+    initial_guess(param_in.solution_projection_dimension_coupled, false),
     scaling_factor_continuity(1.0),
     characteristic_element_length(1.0)
 {
@@ -96,6 +98,11 @@ TimeIntBDFCoupled<dim, Number>::setup_derived()
   // scaling factor continuity equation:
   // Calculate characteristic element length h
   characteristic_element_length = pde_operator->calculate_characteristic_element_length();
+
+  telemetry_coupled = this->telemetry->register_solve("coupled");
+  if(this->param.nonlinear_problem_has_to_be_solved())
+    telemetry_coupled_newton = this->telemetry->register_column("coupled_newton_iterations");
+  telemetry_penalty = this->telemetry->register_solve("penalty");
 }
 
 template<int dim, typename Number>
@@ -267,6 +274,10 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     // apply mass operator to sum_alphai_ui and add to rhs vector
     pde_operator->apply_mass_operator_add(rhs_vector.block(0), sum_alphai_ui);
 
+    initial_guess.set_matrix(this->get_scaling_factor_time_derivative_term(),
+                             this->param.ale_formulation or this->param.use_turbulence_model);
+    initial_guess.compute_initial_guess(solution_np, rhs_vector);
+
     unsigned int const n_iter =
       pde_operator->solve_linear_stokes_problem(solution_np,
                                                 rhs_vector,
@@ -277,6 +288,10 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     iterations.first += 1;
     std::get<1>(iterations.second) += n_iter;
 
+    initial_guess.add_solution(solution_np, rhs_vector);
+
+    this->telemetry->add_solve(telemetry_coupled, n_iter, timer.wall_time(), update_preconditioner);
+
     // write output
     if(this->print_solver_info() and not(this->is_test))
     {
@@ -312,6 +327,12 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     std::get<0>(iterations.second) += std::get<0>(iter);
     std::get<1>(iterations.second) += std::get<1>(iter);
 
+    this->telemetry->add(telemetry_coupled_newton, std::get<0>(iter));
+    this->telemetry->add_solve(telemetry_coupled,
+                               std::get<1>(iter),
+                               timer.wall_time(),
+                               update_preconditioner);
+
     // write output
     if(this->print_solver_info() and not(this->is_test))
     {
@@ -419,6 +440,8 @@ TimeIntBDFCoupled<dim, Number>::penalty_step()
   iterations_penalty.first += 1;
   iterations_penalty.second += n_iter;
 
+  this->telemetry->add_solve(telemetry_penalty, n_iter, timer.wall_time(), update_preconditioner);
+
   // write output
   if(this->print_solver_info() and not(this->is_test))
   {
@@ -660,6 +683,13 @@ TimeIntBDFCoupled<dim, Number>::print_iterations() const
                              std::max(1., (double)iterations_penalty.first));
   }
 
+  // accuracy of initial guesses obtained by successive solution projection
+  if(initial_guess.is_active())
+  {
+    names.push_back("Coupled system (digits gained by initial guess)");
+    iterations_avg.push_back(initial_guess.get_average_digits_gained());
+  }
+
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_projection.h>
 
 namespace ExaDG
 {
@@ -129,6 +130,14 @@ private:
                                                                                  iterations;
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations_penalty;
 
+  // telemetry columns of the sub-steps
+  TelemetrySink::SolveColumns telemetry_coupled, telemetry_penalty;
+  unsigned int                telemetry_coupled_newton;
+
+  // initial guess of linear solver by successive solution projection (the saddle point problem
+  // is indefinite so that the residual is minimized)
+  SolutionProjection<BlockVectorType> initial_guess;
+
   // scaling factor continuity equation
   double scaling_factor_continuity;
   double characteristic_element_length;
@@ -46,6 +46,11 @@ TimeIntBDFDualSplitting<dim, Number>::TimeIntBDFDualSplitting(
     iterations_projection({0, 0}),
     iterations_viscous({0, 0}),
     iterations_penalty({0, 0}),
+    telemetry_convective(0),
+    initial_guess_pressure(this->param.solution_projection_dimension_pressure_poisson,
+                           this->param.solver_pressure_poisson == SolverPressurePoisson::CG),
+    initial_guess_viscous(this->param.solution_projection_dimension_viscous,
+                          this->param.solver_viscous == SolverViscous::CG),
     extra_pressure_nbc(this->param.order_extrapolation_pressure_nbc,
                        this->param.start_with_low_order)
 {
@@ -85,11 +90,17 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
   {
     initialize_velocity_dbc();
   }
+
+  telemetry_convective = this->telemetry->register_column("convective_wall_time");
+  telemetry_pressure   = this->telemetry->register_solve("pressure");
+  telemetry_projection = this->telemetry->register_solve("projection");
+  telemetry_viscous    = this->telemetry->register_solve("viscous");
+  telemetry_penalty    = this->telemetry->register_solve("penalty");
 }
 
 template<int dim, typename Number>
 void
-TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
+TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(RestartInputArchive<VectorType> & ia)
 {
   Base::read_restart_vectors(ia);
 
@@ -102,7 +113,7 @@ TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binar
 template<int dim, typename Number>
 void
 TimeIntBDFDualSplitting<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+  RestartOutputArchive<VectorType> & oa) const
 {
   Base::write_restart_vectors(oa);
 
@@ -380,6 +391,7 @@ TimeIntBDFDualSplitting<dim, Number>::convective_step()
   }
 
   this->timer_tree->insert({"Timeloop", "Convective step"}, timer.wall_time());
+  this->telemetry->add(telemetry_convective, timer.wall_time());
 }
 
 template<int dim, typename Number>
@@ -401,6 +413,7 @@ TimeIntBDFDualSplitting<dim, Number>::evaluate_convective_term()
   }
 
   this->timer_tree->insert({"Timeloop", "Convective step"}, timer.wall_time());
+  this->telemetry->add(telemetry_convective, timer.wall_time());
 }
 
 template<int dim, typename Number>
@@ -428,6 +441,11 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
     pressure_np = pressure_last_iter;
   }
 
+  // improve the initial guess by projection onto the space of previous solutions; the Laplace
+  // operator only changes for moving meshes
+  initial_guess_pressure.set_matrix(1.0, this->param.ale_formulation);
+  initial_guess_pressure.compute_initial_guess(pressure_np, rhs);
+
   // solve linear system of equations
   bool const update_preconditioner =
     this->param.update_preconditioner_pressure_poisson &&
@@ -439,6 +457,8 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
 
+  initial_guess_pressure.add_solution(pressure_np, rhs);
+
   // special case: pressure level is undefined
   // Adjust the pressure level in order to allow a calculation of the pressure error.
   // This is necessary because otherwise the pressure solution moves away from the exact solution.
@@ -455,6 +475,7 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
+  this->telemetry->add_solve(telemetry_pressure, n_iter, timer.wall_time(), update_preconditioner);
 }
 
 template<int dim, typename Number>
@@ -617,6 +638,11 @@ TimeIntBDFDualSplitting<dim, Number>::projection_step()
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
 
+    this->telemetry->add_solve(telemetry_projection,
+                               n_iter,
+                               timer.wall_time(),
+                               update_preconditioner);
+
     if(this->store_solution)
       velocity_projection_last_iter = velocity_np;
 
@@ -704,6 +730,11 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
       velocity_np = velocity_viscous_last_iter;
     }
 
+    initial_guess_viscous.set_matrix(this->get_scaling_factor_time_derivative_term(),
+                                     this->param.ale_formulation or
+                                       this->param.use_turbulence_model);
+    initial_guess_viscous.compute_initial_guess(velocity_np, rhs);
+
     // solve linear system of equations
     bool const update_preconditioner =
       this->param.update_preconditioner_viscous &&
@@ -715,6 +746,10 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
     iterations_viscous.first += 1;
     iterations_viscous.second += n_iter;
 
+    initial_guess_viscous.add_solution(velocity_np, rhs);
+
+    this->telemetry->add_solve(telemetry_viscous, n_iter, timer.wall_time(), update_preconditioner);
+
     if(this->store_solution)
       velocity_viscous_last_iter = velocity_np;
 
@@ -805,6 +840,7 @@ TimeIntBDFDualSplitting<dim, Number>::penalty_step()
     }
 
     this->timer_tree->insert({"Timeloop", "Penalty step"}, timer.wall_time());
+    this->telemetry->add_solve(telemetry_penalty, n_iter, timer.wall_time(), update_preconditioner);
   }
 }
 
@@ -941,6 +977,20 @@ TimeIntBDFDualSplitting<dim, Number>::print_iterations() const
                              std::max(1., (double)iterations_penalty.first));
   }
 
+  // accuracy of initial guesses obtained by successive solution projection
+  std::vector<std::pair<std::string, SolutionProjection<VectorType> const *>> const
+    initial_guesses = {{"Pressure step", &initial_guess_pressure},
+                       {"Viscous step", &initial_guess_viscous}};
+
+  for(auto const & initial_guess : initial_guesses)
+  {
+    if(initial_guess.second->is_active())
+    {
+      names.push_back(initial_guess.first + " (digits gained by initial guess)");
+      iterations_avg.push_back(initial_guess.second->get_average_digits_gained());
+    }
+  }
+
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_TIME_INT_BDF_DUAL_SPLITTING_H_
 
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_projection.h>
 
 namespace ExaDG
 {
@@ -79,10 +80,10 @@ private:
   setup_derived() final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(RestartInputArchive<VectorType> & ia) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(RestartOutputArchive<VectorType> & oa) const final;
 
   void
   do_timestep_solve() final;
@@ -173,6 +174,15 @@ private:
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations_viscous;
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations_penalty;
 
+  // telemetry columns of the sub-steps
+  unsigned int                telemetry_convective;
+  TelemetrySink::SolveColumns telemetry_pressure, telemetry_projection, telemetry_viscous,
+    telemetry_penalty;
+
+  // initial guesses of linear solvers by successive solution projection
+  SolutionProjection<VectorType> initial_guess_pressure;
+  SolutionProjection<VectorType> initial_guess_viscous;
+
   // time integrator constants: extrapolation scheme
   ExtrapolationConstants extra_pressure_nbc;
 };
@@ -46,7 +46,12 @@ TimeIntBDFPressureCorrection<dim, Number>::TimeIntBDFPressureCorrection(
     pressure_dbc(param_in.order_pressure_extrapolation),
     iterations_momentum({0, {0, 0}}),
     iterations_pressure({0, 0}),
-    iterations_projection({0, 0})
+    iterations_projection({0, 0}),
+    telemetry_momentum_newton(0),
+    initial_guess_momentum(param_in.solution_projection_dimension_momentum,
+                           param_in.solver_momentum == SolverMomentum::CG),
+    initial_guess_pressure(param_in.solution_projection_dimension_pressure_poisson,
+                           param_in.solver_pressure_poisson == SolverPressurePoisson::CG)
 {
 }
 
@@ -96,12 +101,18 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
   {
     initialize_pressure_on_boundary();
   }
+
+  telemetry_momentum = this->telemetry->register_solve("momentum");
+  if(this->param.nonlinear_problem_has_to_be_solved())
+    telemetry_momentum_newton = this->telemetry->register_column("momentum_newton_iterations");
+  telemetry_pressure   = this->telemetry->register_solve("pressure");
+  telemetry_projection = this->telemetry->register_solve("projection");
 }
 
 template<int dim, typename Number>
 void
 TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
-  boost::archive::binary_iarchive & ia)
+  RestartInputArchive<VectorType> & ia)
 {
   Base::read_restart_vectors(ia);
 
@@ -114,7 +125,7 @@ TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
 template<int dim, typename Number>
 void
 TimeIntBDFPressureCorrection<dim, Number>::write_restart_vectors(
-  boost::archive::binary_oarchive & oa) const
+  RestartOutputArchive<VectorType> & oa) const
 {
   Base::write_restart_vectors(oa);
 
@@ -395,6 +406,11 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
   {
     if(this->param.viscous_problem())
     {
+      initial_guess_momentum.set_matrix(this->get_scaling_factor_time_derivative_term(),
+                                        this->param.ale_formulation or
+                                          this->param.use_turbulence_model);
+      initial_guess_momentum.compute_initial_guess(velocity_np, rhs);
+
       // solve linear system of equations
       unsigned int n_iter = pde_operator->solve_linear_momentum_equation(
         velocity_np, rhs, update_preconditioner, this->get_scaling_factor_time_derivative_term());
@@ -402,6 +418,13 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
       iterations_momentum.first += 1;
       std::get<1>(iterations_momentum.second) += n_iter;
 
+      initial_guess_momentum.add_solution(velocity_np, rhs);
+
+      this->telemetry->add_solve(telemetry_momentum,
+                                 n_iter,
+                                 timer.wall_time(),
+                                 update_preconditioner);
+
       if(this->print_solver_info() and not(this->is_test))
       {
         this->pcout << std::endl << "Solve momentum step:";
@@ -437,6 +460,12 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
     std::get<0>(iterations_momentum.second) += std::get<0>(iter);
     std::get<1>(iterations_momentum.second) += std::get<1>(iter);
 
+    this->telemetry->add(telemetry_momentum_newton, std::get<0>(iter));
+    this->telemetry->add_solve(telemetry_momentum,
+                               std::get<1>(iter),
+                               timer.wall_time(),
+                               update_preconditioner);
+
     if(this->print_solver_info() and not(this->is_test))
     {
       this->pcout << std::endl << "Solve momentum step:";
@@ -576,6 +605,11 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
     pressure_increment = pressure_increment_last_iter;
   }
 
+  // improve the initial guess by projection onto the space of previous solutions; the Laplace
+  // operator only changes for moving meshes
+  initial_guess_pressure.set_matrix(1.0, this->param.ale_formulation);
+  initial_guess_pressure.compute_initial_guess(pressure_increment, rhs);
+
   // solve linear system of equations
   bool const update_preconditioner =
     this->param.update_preconditioner_pressure_poisson &&
@@ -589,6 +623,8 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   iterations_pressure.first += 1;
   iterations_pressure.second += n_iter;
 
+  initial_guess_pressure.add_solution(pressure_increment, rhs);
+
   if(this->store_solution)
     pressure_increment_last_iter = pressure_increment;
 
@@ -608,6 +644,7 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
+  this->telemetry->add_solve(telemetry_pressure, n_iter, timer.wall_time(), update_preconditioner);
 }
 
 template<int dim, typename Number>
@@ -808,6 +845,11 @@ TimeIntBDFPressureCorrection<dim, Number>::projection_step(VectorType const & pr
     iterations_projection.first += 1;
     iterations_projection.second += n_iter;
 
+    this->telemetry->add_solve(telemetry_projection,
+                               n_iter,
+                               timer.wall_time(),
+                               update_preconditioner);
+
     if(this->store_solution)
       velocity_projection_last_iter = velocity_np;
 
@@ -1040,6 +1082,20 @@ TimeIntBDFPressureCorrection<dim, Number>::print_iterations() const
       (double)iterations_projection.second / std::max(1., (double)iterations_projection.first);
   }
 
+  // accuracy of initial guesses obtained by successive solution projection
+  std::vector<std::pair<std::string, SolutionProjection<VectorType> const *>> const
+    initial_guesses = {{"Momentum step", &initial_guess_momentum},
+                       {"Pressure step", &initial_guess_pressure}};
+
+  for(auto const & initial_guess : initial_guesses)
+  {
+    if(initial_guess.second->is_active())
+    {
+      names.push_back(initial_guess.first + " (digits gained by initial guess)");
+      iterations_avg.push_back(initial_guess.second->get_average_digits_gained());
+    }
+  }
+
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
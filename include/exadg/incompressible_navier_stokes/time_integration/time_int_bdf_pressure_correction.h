@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_TIME_INT_BDF_PRESSURE_CORRECTION_H_
 
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_projection.h>
 
 namespace ExaDG
 {
@@ -88,10 +89,10 @@ private:
   initialize_former_solutions() final;
 
   void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) final;
+  read_restart_vectors(RestartInputArchive<VectorType> & ia) final;
 
   void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const final;
+  write_restart_vectors(RestartOutputArchive<VectorType> & oa) const final;
 
   void
   initialize_pressure_on_boundary();
@@ -178,6 +179,14 @@ private:
     iterations_pressure;
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */>
     iterations_projection;
+
+  // telemetry columns of the sub-steps
+  TelemetrySink::SolveColumns telemetry_momentum, telemetry_pressure, telemetry_projection;
+  unsigned int                telemetry_momentum_newton;
+
+  // initial guesses of linear solvers by successive solution projection
+  SolutionProjection<VectorType> initial_guess_momentum;
+  SolutionProjection<VectorType> initial_guess_pressure;
 };
 
 } // namespace IncNS
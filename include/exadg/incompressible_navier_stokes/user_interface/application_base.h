@@ -108,6 +108,7 @@ public:
     boundary_descriptor = std::make_shared<BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions<dim, Number>(*boundary_descriptor, *grid);
+    set_vectorized_functions(*boundary_descriptor);
 
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
@@ -164,6 +165,7 @@ public:
     poisson_boundary_descriptor = std::make_shared<Poisson::BoundaryDescriptor<1, dim>>();
     set_boundary_descriptor_poisson();
     verify_boundary_conditions(*poisson_boundary_descriptor, *grid);
+    poisson_boundary_descriptor->set_vectorized_functions();
 
     poisson_field_functions = std::make_shared<Poisson::FieldFunctions<dim>>();
     set_field_functions_poisson();
@@ -333,6 +335,7 @@ public:
     boundary_descriptor_pre = std::make_shared<BoundaryDescriptor<dim>>();
     set_boundary_descriptor_precursor();
     verify_boundary_conditions<dim, Number>(*boundary_descriptor_pre, *grid_pre);
+    set_vectorized_functions(*boundary_descriptor_pre);
 
     // field functions
     field_functions_pre = std::make_shared<FieldFunctions<dim>>();
@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/function_cached.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
 namespace ExaDG
@@ -79,7 +80,8 @@ enum class BoundaryTypeP
 template<int dim>
 struct BoundaryDescriptorU
 {
-  // Dirichlet: prescribe all components of the velocity
+  // Dirichlet: prescribe all components of the velocity. Time-dependent inflow profiles should be
+  // derived from FunctionVectorized, which allows to evaluate them for all SIMD lanes at once.
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
 
   // another type of Dirichlet boundary condition where the Dirichlet value comes
@@ -100,6 +102,21 @@ struct BoundaryDescriptorU
 
   // add more types of boundary conditions
 
+  // Vectorized representation of dirichlet_bc and neumann_bc evaluated by the matrix-free
+  // kernels, see set_vectorized_functions().
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    dirichlet_bc_vectorized;
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    neumann_bc_vectorized;
+
+  // has to be called once all boundary conditions have been prescribed
+  void
+  set_vectorized_functions()
+  {
+    dirichlet_bc_vectorized = make_function_vectorized(dirichlet_bc);
+    neumann_bc_vectorized   = make_function_vectorized(neumann_bc);
+  }
+
 
   // return the boundary type
   inline DEAL_II_ALWAYS_INLINE //
@@ -159,6 +176,18 @@ struct BoundaryDescriptorP
 
   // add more types of boundary conditions
 
+  // Vectorized representation of dirichlet_bc evaluated by the matrix-free kernels, see
+  // set_vectorized_functions().
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    dirichlet_bc_vectorized;
+
+  // has to be called once all boundary conditions have been prescribed
+  void
+  set_vectorized_functions()
+  {
+    dirichlet_bc_vectorized = make_function_vectorized(dirichlet_bc);
+  }
+
 
   // return the boundary type
   inline DEAL_II_ALWAYS_INLINE //
@@ -218,6 +247,14 @@ verify_boundary_conditions(BoundaryDescriptor<dim> const & boundary_descriptor,
   ExaDG::verify_boundary_conditions(*boundary_descriptor.pressure, grid);
 }
 
+template<int dim>
+inline void
+set_vectorized_functions(BoundaryDescriptor<dim> & boundary_descriptor)
+{
+  boundary_descriptor.velocity->set_vectorized_functions();
+  boundary_descriptor.pressure->set_vectorized_functions();
+}
+
 } // namespace IncNS
 } // namespace ExaDG
 
@@ -86,6 +86,9 @@ Parameters::Parameters()
     restarted_simulation(false),
     restart_data(RestartData()),
 
+    // telemetry
+    telemetry_data(TelemetryData()),
+
     // SPATIAL DISCRETIZATION
 
     // grid
@@ -131,11 +134,16 @@ Parameters::Parameters()
     use_turbulence_model(false),
     turbulence_model_constant(1.0),
     turbulence_model(TurbulenceEddyViscosityModel::Undefined),
+    turbulence_model_viscosity_storage(VariableCoefficientsStorage::Full),
+    turbulence_model_viscosity_storage_degree(1),
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
+    compact_block_diagonal_storage(false),
+    block_diagonal_single_precision(false),
     use_cell_based_face_loops(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
+    preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
 
     // PROJECTION METHODS
@@ -148,6 +156,7 @@ Parameters::Parameters()
     multigrid_data_pressure_poisson(MultigridData()),
     update_preconditioner_pressure_poisson(false),
     update_preconditioner_pressure_poisson_every_time_steps(1),
+    solution_projection_dimension_pressure_poisson(0),
 
     // projection step
     solver_projection(SolverProjection::CG),
@@ -173,6 +182,7 @@ Parameters::Parameters()
     preconditioner_viscous(PreconditionerViscous::InverseMassMatrix),
     update_preconditioner_viscous(false),
     update_preconditioner_viscous_every_time_steps(1),
+    solution_projection_dimension_viscous(0),
     multigrid_data_viscous(MultigridData()),
 
     // PRESSURE-CORRECTION SCHEME
@@ -185,6 +195,7 @@ Parameters::Parameters()
     update_preconditioner_momentum(false),
     update_preconditioner_momentum_every_newton_iter(1),
     update_preconditioner_momentum_every_time_steps(1),
+    solution_projection_dimension_momentum(0),
     multigrid_data_momentum(MultigridData()),
     multigrid_operator_type_momentum(MultigridOperatorType::Undefined),
 
@@ -211,6 +222,7 @@ Parameters::Parameters()
     update_preconditioner_coupled(false),
     update_preconditioner_coupled_every_newton_iter(1),
     update_preconditioner_coupled_every_time_steps(1),
+    solution_projection_dimension_coupled(0),
 
     // preconditioner velocity/momentum block
     preconditioner_velocity_block(MomentumPreconditioner::InverseMassMatrix),
@@ -470,6 +482,12 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
         "Cell based face loops have to be used for matrix-free implementation of block diagonal preconditioner."));
   }
 
+  AssertThrow(preconditioner_block_diagonal != Elementwise::Preconditioner::FastDiagonalization or
+                implement_block_diagonal_preconditioner_matrix_free,
+              dealii::ExcMessage("The fast diagonalization preconditioner is only available for "
+                                 "the matrix-free implementation of the block diagonal "
+                                 "preconditioner."));
+
 
   // TURBULENCE
   if(use_turbulence_model)
@@ -478,6 +496,11 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("parameter must be defined"));
     AssertThrow(turbulence_model_constant > 0,
                 dealii::ExcMessage("parameter must be greater than zero"));
+
+    if(turbulence_model_viscosity_storage == VariableCoefficientsStorage::Polynomial)
+      AssertThrow(turbulence_model_viscosity_storage_degree < degree_u,
+                  dealii::ExcMessage("The polynomial degree of the turbulent viscosity has to be "
+                                     "smaller than the polynomial degree of the velocity."));
   }
 }
 
@@ -688,6 +711,9 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   // restart
   print_parameter(pcout, "Restarted simulation", restarted_simulation);
   restart_data.print(pcout);
+
+  // telemetry
+  telemetry_data.print(pcout);
 }
 
 void
@@ -788,6 +814,13 @@ Parameters::print_parameters_turbulence(dealii::ConditionalOStream const & pcout
   {
     print_parameter(pcout, "Turbulence model", enum_to_string(turbulence_model));
     print_parameter(pcout, "Turbulence model constant", turbulence_model_constant);
+    print_parameter(pcout,
+                    "Storage of turbulent viscosity",
+                    enum_to_string(turbulence_model_viscosity_storage));
+    if(turbulence_model_viscosity_storage == VariableCoefficientsStorage::Polynomial)
+      print_parameter(pcout,
+                      "Polynomial degree of turbulent viscosity",
+                      turbulence_model_viscosity_storage_degree);
   }
 }
 
@@ -800,11 +833,22 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
                   "Block Jacobi matrix-free",
                   implement_block_diagonal_preconditioner_matrix_free);
 
+  if(not(implement_block_diagonal_preconditioner_matrix_free))
+  {
+    print_parameter(pcout, "Block Jacobi compact storage", compact_block_diagonal_storage);
+    if(compact_block_diagonal_storage)
+      print_parameter(pcout, "Block Jacobi single precision", block_diagonal_single_precision);
+  }
+
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
 
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     solver_data_block_diagonal.print(pcout);
+
+    print_parameter(pcout,
+                    "Preconditioner block diagonal",
+                    enum_to_string(preconditioner_block_diagonal));
   }
 
   print_parameter(pcout, "Quadrature rule linearization", enum_to_string(quad_rule_linearization));
@@ -835,6 +879,13 @@ Parameters::print_parameters_pressure_poisson(dealii::ConditionalOStream const &
                     update_preconditioner_pressure_poisson_every_time_steps);
   }
 
+  if(solution_projection_dimension_pressure_poisson > 0)
+  {
+    print_parameter(pcout,
+                    "Solution projection dimension",
+                    solution_projection_dimension_pressure_poisson);
+  }
+
   if(preconditioner_pressure_poisson == PreconditionerPressurePoisson::Multigrid)
   {
     multigrid_data_pressure_poisson.print(pcout);
@@ -927,6 +978,13 @@ Parameters::print_parameters_dual_splitting(dealii::ConditionalOStream const & p
                       update_preconditioner_viscous_every_time_steps);
     }
 
+    if(solution_projection_dimension_viscous > 0)
+    {
+      print_parameter(pcout,
+                      "Solution projection dimension",
+                      solution_projection_dimension_viscous);
+    }
+
     if(preconditioner_viscous == PreconditionerViscous::Multigrid)
     {
       multigrid_data_viscous.print(pcout);
@@ -985,6 +1043,13 @@ Parameters::print_parameters_pressure_correction(dealii::ConditionalOStream cons
                     update_preconditioner_momentum_every_time_steps);
   }
 
+  if(linear_problem_has_to_be_solved() and solution_projection_dimension_momentum > 0)
+  {
+    print_parameter(pcout,
+                    "Solution projection dimension",
+                    solution_projection_dimension_momentum);
+  }
+
   if(preconditioner_momentum == MomentumPreconditioner::Multigrid)
   {
     print_parameter(pcout,
@@ -1054,6 +1119,13 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
                     update_preconditioner_coupled_every_time_steps);
   }
 
+  if(linear_problem_has_to_be_solved() and solution_projection_dimension_coupled > 0)
+  {
+    print_parameter(pcout,
+                    "Solution projection dimension",
+                    solution_projection_dimension_coupled);
+  }
+
   pcout << std::endl << "  Velocity/momentum block:" << std::endl;
 
   print_parameter(pcout, "Preconditioner", enum_to_string(preconditioner_velocity_block));
@@ -29,6 +29,7 @@
 #include <exadg/grid/enum_types.h>
 #include <exadg/grid/grid_data.h>
 #include <exadg/incompressible_navier_stokes/user_interface/enum_types.h>
+#include <exadg/operators/variable_coefficients_storage.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
@@ -36,6 +37,7 @@
 #include <exadg/time_integration/enum_types.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
+#include <exadg/time_integration/telemetry.h>
 
 namespace ExaDG
 {
@@ -270,6 +272,9 @@ public:
   // restart
   RestartData restart_data;
 
+  // per-time-step performance telemetry
+  TelemetryData telemetry_data;
+
 
   /**************************************************************************************/
   /*                                                                                    */
@@ -381,6 +386,14 @@ public:
   // turbulence model
   TurbulenceEddyViscosityModel turbulence_model;
 
+  // storage of the variable viscosity in the quadrature points. The compressed variants reduce
+  // memory consumption and memory transfer of the viscous operator at the price of an approximation
+  // of the turbulent viscosity.
+  VariableCoefficientsStorage turbulence_model_viscosity_storage;
+
+  // polynomial degree of the viscosity for VariableCoefficientsStorage::Polynomial
+  unsigned int turbulence_model_viscosity_storage_degree;
+
 
   /**************************************************************************************/
   /*                                                                                    */
@@ -397,6 +410,13 @@ public:
   // the matrix-based variant should be used.
   bool implement_block_diagonal_preconditioner_matrix_free;
 
+  // Only relevant for the matrix-based block Jacobi preconditioner: store the LU factors of all
+  // cells in a compact format vectorized over cells, optionally in single precision, in order to
+  // reduce the memory consumption. The block matrices are assembled and factorized one cell batch
+  // at a time, which requires cell-based face loops for operators with face integrals.
+  bool compact_block_diagonal_storage;
+  bool block_diagonal_single_precision;
+
   // By default, the matrix-free implementation performs separate loops over all cells,
   // interior faces, and boundary faces. For a certain type of operations, however, it
   // is necessary to perform the face-loop as a loop over all faces of a cell with an
@@ -413,6 +433,12 @@ public:
   // preconditioning problems without a further benefit in global iteration counts.
   SolverData solver_data_block_diagonal;
 
+  // Elementwise preconditioner of the matrix-free block Jacobi preconditioner of the momentum
+  // operator and the pressure Poisson operator (description: see enum declaration). With
+  // FastDiagonalization, the elementwise iterative solver is only used for cells on which the
+  // block can not be inverted by the fast diagonalization method.
+  Elementwise::Preconditioner preconditioner_block_diagonal;
+
   // Quadrature rule used to integrate the linearized convective term. This parameter is
   // therefore only relevant if linear systems of equations have to be solved involving
   // the convective term. For reasons of computational efficiency, it might be advantageous
@@ -457,6 +483,16 @@ public:
   // This variable is only used if update of preconditioner is true.
   unsigned int update_preconditioner_pressure_poisson_every_time_steps;
 
+  // Number of previous solutions used to compute the initial guess of the solver by projection
+  // of the right-hand side onto the space spanned by these solutions (successive solution
+  // projection). This replaces the extrapolation of the solution, and a value of 0 disables the
+  // projection. Note that a better initial guess only reduces the number of iterations if the
+  // absolute solver tolerance is the active stopping criterion. The space is discarded whenever
+  // the matrix changes, e.g. after a change of the time step size. For moving meshes (and for
+  // the momentum operators in case of a turbulence model) this happens in every time step, so
+  // that the projection is not effective.
+  unsigned int solution_projection_dimension_pressure_poisson;
+
   // PROJECTION STEP
 
   // description: see enum declaration
@@ -530,6 +566,9 @@ public:
   // This variable is only used if update_preconditioner_viscous is true.
   unsigned int update_preconditioner_viscous_every_time_steps;
 
+  // see solution_projection_dimension_pressure_poisson
+  unsigned int solution_projection_dimension_viscous;
+
   // description: see declaration of MultigridData
   MultigridData multigrid_data_viscous;
 
@@ -565,6 +604,9 @@ public:
   // This variable is only used if update_preconditioner_coupled = true.
   unsigned int update_preconditioner_momentum_every_time_steps;
 
+  // see solution_projection_dimension_pressure_poisson (only relevant for linear problems)
+  unsigned int solution_projection_dimension_momentum;
+
   // description: see declaration of MultigridData
   MultigridData multigrid_data_momentum;
 
@@ -616,6 +658,9 @@ public:
   // This variable is only used if update_preconditioner_coupled = true.
   unsigned int update_preconditioner_coupled_every_time_steps;
 
+  // see solution_projection_dimension_pressure_poisson (only relevant for linear problems)
+  unsigned int solution_projection_dimension_coupled;
+
   // description: see enum declaration
   MomentumPreconditioner preconditioner_velocity_block;
 
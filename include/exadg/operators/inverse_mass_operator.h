@@ -22,6 +22,9 @@
 #ifndef INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 #define INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/operators.h>
@@ -48,6 +51,8 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
+  typedef std::function<void(unsigned int const, unsigned int const)> VectorOperation;
+
   InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
   {
   }
@@ -70,6 +75,27 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Same as above, but with operations on vector entries performed before and after the
+   * cells touching these entries are processed (see the corresponding variant of
+   * dealii::MatrixFree::cell_loop()). The index ranges passed to these functions refer to
+   * the locally owned part of the vectors described by the DoF index of this operator.
+   * This allows to fuse vector updates, e.g. the stage updates of explicit time
+   * integrators, with the application of the inverse mass operator while the data is still
+   * in cache.
+   */
+  void
+  apply(VectorType &            dst,
+        VectorType const &      src,
+        VectorOperation const & operation_before_loop,
+        VectorOperation const & operation_after_loop) const
+  {
+    dst.zero_out_ghost_values();
+
+    matrix_free->cell_loop(
+      &This::cell_loop, this, dst, src, operation_before_loop, operation_after_loop, dof_index);
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &,
@@ -591,6 +591,16 @@ OperatorBase<dim, Number, n_components>::initialize_block_diagonal_preconditione
     elementwise_preconditioner =
       std::make_shared<INVERSE_MASS>(get_matrix_free(), get_dof_index(), get_quad_index());
   }
+  else if(data.preconditioner_block_diagonal == Elementwise::Preconditioner::FastDiagonalization)
+  {
+    // The relative tolerance of the elementwise solver is used to decide whether the fast
+    // diagonalization method is accurate enough to replace the elementwise solver on a cell.
+    fast_diagonalization =
+      std::make_shared<FAST_DIAGONALIZATION>(*elementwise_operator,
+                                             data.solver_data_block_diagonal.rel_tol);
+
+    elementwise_preconditioner = fast_diagonalization;
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -681,6 +691,14 @@ OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner()
     {
       initialize_block_diagonal_preconditioner_matrix_free();
     }
+    else if(data.compact_block_diagonal_storage)
+    {
+      auto dofs =
+        matrix_free->get_shape_info(this->data.dof_index).dofs_per_component_on_cell * n_components;
+      compact_matrices.reinit(matrix_free->n_cell_batches(),
+                              dofs,
+                              data.block_diagonal_single_precision);
+    }
     else // matrix-based variant
     {
       // allocate memory only the first time
@@ -695,17 +713,40 @@ OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner()
 
   // update
 
-  // For the matrix-free variant there is nothing to do.
+  // For the matrix-free variant there is nothing to do, except for the fast diagonalization method
+  // where the 1D matrices have to be extracted from the current operator.
   // For the matrix-based variant we have to recompute the block matrices.
-  if(!data.implement_block_diagonal_preconditioner_matrix_free)
+  if(data.implement_block_diagonal_preconditioner_matrix_free)
+  {
+    if(fast_diagonalization.get() != nullptr)
+      fast_diagonalization->update();
+  }
+  else
   {
-    // clear matrices
-    initialize_block_jacobi_matrices_with_zero(matrices);
+    if(data.compact_block_diagonal_storage)
+    {
+      // assemble and factorize the block matrices one cell batch at a time
+      AssertThrow(
+        not(evaluate_face_integrals()) or data.use_cell_based_loops,
+        dealii::ExcMessage(
+          "Compact storage of block Jacobi matrices requires cell based loops for operators "
+          "with face integrals."));
+
+      matrix_free->cell_loop(&This::cell_based_loop_block_diagonal_compact,
+                             this,
+                             compact_matrices,
+                             compact_matrices);
+    }
+    else
+    {
+      // clear matrices
+      initialize_block_jacobi_matrices_with_zero(matrices);
 
-    // compute block matrices and add
-    add_block_diagonal_matrices(matrices);
+      // compute block matrices and add
+      add_block_diagonal_matrices(matrices);
 
-    calculate_lu_factorization_block_jacobi(matrices);
+      calculate_lu_factorization_block_jacobi(matrices);
+    }
   }
 }
 
@@ -1459,17 +1500,25 @@ OperatorBase<dim, Number, n_components>::cell_loop_apply_inverse_block_diagonal_
 
     integrator->read_dof_values(src);
 
-    for(unsigned int v = 0; v < vectorization_length; ++v)
+    if(data.compact_block_diagonal_storage)
     {
-      dealii::Vector<Number> src_vector(dofs_per_cell);
-      for(unsigned int j = 0; j < dofs_per_cell; ++j)
-        src_vector(j) = integrator->begin_dof_values()[j][v];
+      // apply inverse matrices of all cells of the cell batch at once
+      compact_matrices.solve(cell, integrator->begin_dof_values());
+    }
+    else
+    {
+      for(unsigned int v = 0; v < vectorization_length; ++v)
+      {
+        dealii::Vector<Number> src_vector(dofs_per_cell);
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          src_vector(j) = integrator->begin_dof_values()[j][v];
 
-      // apply inverse matrix
-      matrices[cell * vectorization_length + v].solve(src_vector, false);
+        // apply inverse matrix
+        matrices[cell * vectorization_length + v].solve(src_vector, false);
 
-      for(unsigned int j = 0; j < dofs_per_cell; ++j)
-        integrator->begin_dof_values()[j][v] = src_vector(j);
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          integrator->begin_dof_values()[j][v] = src_vector(j);
+      }
     }
 
     integrator->set_dof_values(dst);
@@ -1494,18 +1543,26 @@ OperatorBase<dim, Number, n_components>::cell_loop_apply_block_diagonal_matrix_b
 
     integrator->read_dof_values(src);
 
-    for(unsigned int v = 0; v < vectorization_length; ++v)
+    if(data.compact_block_diagonal_storage)
     {
-      dealii::Vector<Number> src_vector(dofs_per_cell);
-      dealii::Vector<Number> dst_vector(dofs_per_cell);
-      for(unsigned int j = 0; j < dofs_per_cell; ++j)
-        src_vector(j) = integrator->begin_dof_values()[j][v];
+      // only the LU factors are stored, from which the matrices of the cell batch are applied
+      compact_matrices.vmult(cell, integrator->begin_dof_values());
+    }
+    else
+    {
+      for(unsigned int v = 0; v < vectorization_length; ++v)
+      {
+        dealii::Vector<Number> src_vector(dofs_per_cell);
+        dealii::Vector<Number> dst_vector(dofs_per_cell);
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          src_vector(j) = integrator->begin_dof_values()[j][v];
 
-      // apply matrix
-      matrices[cell * vectorization_length + v].vmult(dst_vector, src_vector, false);
+        // apply matrix
+        matrices[cell * vectorization_length + v].vmult(dst_vector, src_vector, false);
 
-      for(unsigned int j = 0; j < dofs_per_cell; ++j)
-        integrator->begin_dof_values()[j][v] = dst_vector(j);
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+          integrator->begin_dof_values()[j][v] = dst_vector(j);
+      }
     }
 
     integrator->set_dof_values(dst);
@@ -1713,6 +1770,83 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal(
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal_compact(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  CompactBlockJacobiMatrices<Number> &    factors,
+  CompactBlockJacobiMatrices<Number> const &,
+  Range const & range) const
+{
+  unsigned int const dofs_per_cell = integrator->dofs_per_cell;
+
+  // block matrices of one cell batch, entry (i,j) of all cells of the batch interleaved
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> blocks(dofs_per_cell * dofs_per_cell);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
+
+    blocks.fill(dealii::make_vectorized_array<Number>(0.0));
+
+    this->reinit_cell(cell);
+
+    for(unsigned int j = 0; j < dofs_per_cell; ++j)
+    {
+      this->create_standard_basis(j, *integrator);
+
+      integrator->evaluate(integrator_flags.cell_evaluate);
+
+      this->do_cell_integral(*integrator);
+
+      integrator->integrate(integrator_flags.cell_integrate);
+
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+        blocks[i * dofs_per_cell + j] += integrator->begin_dof_values()[i];
+    }
+
+    if(evaluate_face_integrals())
+    {
+      // loop over all faces
+      unsigned int const n_faces = dealii::ReferenceCells::template get_hypercube<dim>().n_faces();
+      for(unsigned int face = 0; face < n_faces; ++face)
+      {
+        auto bid = matrix_free.get_faces_by_cells_boundary_id(cell, face)[0];
+
+        this->reinit_face_cell_based(cell, face, bid);
+
+        for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          this->create_standard_basis(j, *integrator_m);
+
+          integrator_m->evaluate(integrator_flags.face_evaluate);
+
+          if(bid == dealii::numbers::internal_face_boundary_id) // internal face
+          {
+            this->do_face_int_integral_cell_based(*integrator_m, *integrator_p);
+          }
+          else // boundary face
+          {
+            this->do_boundary_integral(*integrator_m, OperatorType::homogeneous, bid);
+          }
+
+          integrator_m->integrate(integrator_flags.face_integrate);
+
+          for(unsigned int i = 0; i < dofs_per_cell; ++i)
+            blocks[i * dofs_per_cell + j] += integrator_m->begin_dof_values()[i];
+        }
+      }
+    }
+
+    // lanes that are not filled get a zero matrix, which is handled by the factorization
+    for(unsigned int e = 0; e < blocks.size(); ++e)
+      for(unsigned int v = n_filled_lanes; v < vectorization_length; ++v)
+        blocks[e][v] = 0.0;
+
+    factors.factorize(cell, blocks);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 template<typename SparseMatrix>
 void
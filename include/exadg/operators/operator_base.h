@@ -44,6 +44,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/wrapper_elementwise_solvers.h>
+#include <exadg/solvers_and_preconditioners/utilities/compact_block_jacobi_matrices.h>
 #include <exadg/solvers_and_preconditioners/utilities/invert_diagonal.h>
 
 #include <exadg/operators/elementwise_operator.h>
@@ -62,6 +63,8 @@ struct OperatorBaseData
       operator_is_singular(false),
       use_cell_based_loops(false),
       implement_block_diagonal_preconditioner_matrix_free(false),
+      compact_block_diagonal_storage(false),
+      block_diagonal_single_precision(false),
       solver_block_diagonal(Elementwise::Solver::GMRES),
       preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
       solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000))
@@ -79,6 +82,12 @@ struct OperatorBaseData
   // block Jacobi preconditioner
   bool implement_block_diagonal_preconditioner_matrix_free;
 
+  // matrix-based block Jacobi preconditioner: store the LU factors of all cells in one contiguous
+  // buffer (see CompactBlockJacobiMatrices) instead of one dealii::LAPACKFullMatrix per cell, and
+  // optionally in single precision
+  bool compact_block_diagonal_storage;
+  bool block_diagonal_single_precision;
+
   // elementwise iterative solution of block Jacobi problems
   Elementwise::Solver         solver_block_diagonal;
   Elementwise::Preconditioner preconditioner_block_diagonal;
@@ -396,10 +405,17 @@ protected:
     IterativeSolver<dim, n_components, Number, ELEMENTWISE_OPERATOR, ELEMENTWISE_PRECONDITIONER>
       ELEMENTWISE_SOLVER;
 
+  typedef Elementwise::
+    FastDiagonalizationPreconditioner<dim, n_components, Number, ELEMENTWISE_OPERATOR>
+      FAST_DIAGONALIZATION;
+
   mutable std::shared_ptr<ELEMENTWISE_OPERATOR>       elementwise_operator;
   mutable std::shared_ptr<ELEMENTWISE_PRECONDITIONER> elementwise_preconditioner;
   mutable std::shared_ptr<ELEMENTWISE_SOLVER>         elementwise_solver;
 
+  // only used for Elementwise::Preconditioner::FastDiagonalization
+  mutable std::shared_ptr<FAST_DIAGONALIZATION> fast_diagonalization;
+
 private:
   /*
    * Helper functions:
@@ -545,6 +561,13 @@ private:
                                  BlockMatrix const &                     src,
                                  Range const &                           range) const;
 
+  // cell-based variant for compact storage: assembles and factorizes one cell batch at a time
+  void
+  cell_based_loop_block_diagonal_compact(dealii::MatrixFree<dim, Number> const &    matrix_free,
+                                         CompactBlockJacobiMatrices<Number> &       factors,
+                                         CompactBlockJacobiMatrices<Number> const & src,
+                                         Range const &                              range) const;
+
   /*
    * Apply block diagonal.
    */
@@ -632,6 +655,12 @@ private:
    */
   mutable std::vector<dealii::LAPACKFullMatrix<Number>> matrices;
 
+  /*
+   * LU factors of the block-diagonal matrices in case of compact storage. The vector of matrices
+   * above is then not used.
+   */
+  mutable CompactBlockJacobiMatrices<Number> compact_matrices;
+
   /*
    * We want to initialize the block diagonal preconditioner (block diagonal matrices or elementwise
    * iterative solvers in case of matrix-free implementation) only once, so we store the status of
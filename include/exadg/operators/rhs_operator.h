@@ -53,6 +53,8 @@ public:
   reinit(RHSKernelData<dim> const & data_in) const
   {
     data = data_in;
+
+    f = make_function_vectorized(data.f);
   }
 
   static MappingFlags
@@ -79,11 +81,14 @@ public:
   {
     dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-    return FunctionEvaluator<rank, dim, Number>::value(data.f, q_points, time);
+    return FunctionEvaluator<rank, dim, Number>::value(f, q_points, time);
   }
 
 private:
   mutable RHSKernelData<dim> data;
+
+  // vectorized representation of data.f, resolved once in reinit()
+  mutable std::shared_ptr<FunctionVectorized<dim>> f;
 };
 
 } // namespace Operators
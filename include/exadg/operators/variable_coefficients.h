@@ -21,6 +21,19 @@
 #ifndef INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 #define INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 
+// C/C++
+#include <array>
+
+// deal.II
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/operators/variable_coefficients_storage.h>
+
 namespace ExaDG
 {
 template<int dim, typename Number>
@@ -30,6 +43,10 @@ private:
   typedef dealii::VectorizedArray<Number> scalar;
 
 public:
+  /*
+   *  The coefficients are initialized with constant_coefficient, which also serves as lower bound
+   *  of the coefficients in case of VariableCoefficientsStorage::Polynomial.
+   */
   void
   initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
              unsigned int const                      degree,
@@ -58,6 +75,310 @@ private:
   dealii::Table<2, scalar> coefficients_cell;
 };
 
+namespace internal
+{
+/*
+ *  Coefficients in the (n_points_1d)^points_dim Gauss points of a batch of cells (points_dim = dim)
+ *  or faces (points_dim = dim - 1), stored according to VariableCoefficientsStorage.
+ */
+template<int points_dim, typename Number>
+class CoefficientStorage
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  static unsigned int const n_lanes = scalar::size();
+
+public:
+  CoefficientStorage()
+    : storage(VariableCoefficientsStorage::Full),
+      n_batches(0),
+      n_points_1d(1),
+      n_points(1),
+      n_coefficients_1d(1),
+      n_coefficients(1),
+      lower_bound(0.0),
+      cached_batch(dealii::numbers::invalid_unsigned_int)
+  {
+  }
+
+  void
+  reinit(unsigned int const                n_batches_in,
+         unsigned int const                n_points_1d_in,
+         VariableCoefficientsStorage const storage_in,
+         unsigned int const                storage_degree,
+         Number const &                    constant_coefficient)
+  {
+    storage      = storage_in;
+    n_batches    = n_batches_in;
+    n_points_1d  = n_points_1d_in;
+    n_points     = dealii::Utilities::pow(n_points_1d, points_dim);
+    lower_bound  = constant_coefficient;
+    cached_batch = dealii::numbers::invalid_unsigned_int;
+
+    n_coefficients_1d = n_points_1d;
+    if(storage == VariableCoefficientsStorage::CellwiseConstant)
+    {
+      n_coefficients_1d = 1;
+    }
+    else if(storage == VariableCoefficientsStorage::Polynomial)
+    {
+      AssertThrow(storage_degree + 1 < n_points_1d,
+                  dealii::ExcMessage("The degree of the polynomial representation of variable "
+                                     "coefficients has to be smaller than the number of "
+                                     "quadrature points per direction minus one."));
+
+      n_coefficients_1d = storage_degree + 1;
+    }
+    n_coefficients = dealii::Utilities::pow(n_coefficients_1d, points_dim);
+
+    if(storage == VariableCoefficientsStorage::CellwiseConstant or
+       storage == VariableCoefficientsStorage::Polynomial)
+      setup_projection();
+
+    if(storage == VariableCoefficientsStorage::ReducedPrecision)
+    {
+      coefficients.reinit(0, 0);
+      coefficients_float.resize_fast(n_batches * n_points * n_lanes);
+    }
+    else
+    {
+      coefficients.reinit(n_batches, n_coefficients);
+      coefficients_float.clear();
+    }
+
+    // initialize with constant coefficient
+    dealii::AlignedVector<scalar> const values(
+      n_points, dealii::make_vectorized_array<Number>(constant_coefficient));
+    for(unsigned int batch = 0; batch < n_batches; ++batch)
+      set(batch, values.data());
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    scalar
+    get(unsigned int const batch, unsigned int const q) const
+  {
+    if(storage == VariableCoefficientsStorage::Full)
+    {
+      return coefficients[batch][q];
+    }
+    else if(storage == VariableCoefficientsStorage::CellwiseConstant)
+    {
+      return coefficients[batch][0];
+    }
+    else if(storage == VariableCoefficientsStorage::Polynomial)
+    {
+      // evaluate in all points of the batch once and serve subsequent calls from the cache
+      if(batch != cached_batch)
+      {
+        evaluate(&coefficients[batch][0], cached_values.data());
+
+        // the projection may undershoot near steep gradients, e.g. below the molecular viscosity
+        // or even to negative values in case of turbulence models
+        scalar const bound = dealii::make_vectorized_array<Number>(lower_bound);
+        for(unsigned int q = 0; q < n_points; ++q)
+          cached_values[q] = std::max(cached_values[q], bound);
+
+        cached_batch = batch;
+      }
+
+      return cached_values[q];
+    }
+    else // ReducedPrecision
+    {
+      float const * values = &coefficients_float[(batch * n_points + q) * n_lanes];
+
+      scalar value;
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        value[v] = values[v];
+
+      return value;
+    }
+  }
+
+  /*
+   *  Sets the coefficients in all n_points quadrature points of a batch.
+   */
+  void
+  set(unsigned int const batch, scalar const * values)
+  {
+    if(batch == cached_batch)
+      cached_batch = dealii::numbers::invalid_unsigned_int;
+
+    if(storage == VariableCoefficientsStorage::Full)
+    {
+      for(unsigned int q = 0; q < n_points; ++q)
+        coefficients[batch][q] = values[q];
+    }
+    else if(storage == VariableCoefficientsStorage::CellwiseConstant or
+            storage == VariableCoefficientsStorage::Polynomial)
+    {
+      project(values, &coefficients[batch][0]);
+    }
+    else // ReducedPrecision
+    {
+      float * values_float = &coefficients_float[batch * n_points * n_lanes];
+      for(unsigned int q = 0; q < n_points; ++q)
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          values_float[q * n_lanes + v] = static_cast<float>(values[q][v]);
+    }
+  }
+
+  std::size_t
+  memory_consumption() const
+  {
+    return coefficients.memory_consumption() + coefficients_float.memory_consumption();
+  }
+
+  /*
+   *  Memory consumption with storage VariableCoefficientsStorage::Full.
+   */
+  std::size_t
+  memory_consumption_full_storage() const
+  {
+    return std::size_t(n_batches) * n_points * sizeof(scalar);
+  }
+
+private:
+  /*
+   *  One-dimensional L2-projection in the Gauss points onto Legendre polynomials, which are
+   *  orthogonal with respect to the discrete inner product since the Gauss quadrature integrates
+   *  their products exactly, and evaluation of the Legendre polynomials in the Gauss points. For
+   *  cellwise constant coefficients, the projection directly yields the mean value.
+   */
+  void
+  setup_projection()
+  {
+    dealii::QGauss<1> const quadrature(n_points_1d);
+
+    std::vector<dealii::Polynomials::Polynomial<double>> const basis =
+      dealii::Polynomials::Legendre::generate_complete_basis(n_coefficients_1d - 1);
+
+    projection_1d.resize(n_coefficients_1d * n_points_1d);
+    evaluation_1d.resize(n_points_1d * n_coefficients_1d);
+
+    for(unsigned int i = 0; i < n_coefficients_1d; ++i)
+    {
+      double norm = 0.0;
+      for(unsigned int q = 0; q < n_points_1d; ++q)
+        norm += quadrature.weight(q) * dealii::Utilities::fixed_power<2>(
+                                         basis[i].value(quadrature.point(q)[0]));
+
+      for(unsigned int q = 0; q < n_points_1d; ++q)
+      {
+        double const value = basis[i].value(quadrature.point(q)[0]);
+
+        projection_1d[i * n_points_1d + q]       = quadrature.weight(q) * value / norm;
+        evaluation_1d[q * n_coefficients_1d + i] = value;
+      }
+    }
+
+    if(storage == VariableCoefficientsStorage::CellwiseConstant)
+      for(unsigned int q = 0; q < n_points_1d; ++q)
+        projection_1d[q] = quadrature.weight(q);
+
+    scratch[0].resize(n_points);
+    scratch[1].resize(n_points);
+    cached_values.resize(n_points);
+  }
+
+  /*
+   *  Applies the matrix (n_rows x n_columns, row-major) along the given direction of a tensor in
+   *  lexicographic ordering, where the extent of the tensor is given by sizes. On return, sizes
+   *  contains the extent of the result.
+   */
+  static void
+  apply_1d(std::vector<Number> const &            matrix,
+           unsigned int const                     n_rows,
+           unsigned int const                     n_columns,
+           unsigned int const                     direction,
+           std::array<unsigned int, points_dim> & sizes,
+           scalar const *                         in,
+           scalar *                               out)
+  {
+    unsigned int stride = 1, n_outer = 1;
+    for(unsigned int d = 0; d < direction; ++d)
+      stride *= sizes[d];
+    for(unsigned int d = direction + 1; d < points_dim; ++d)
+      n_outer *= sizes[d];
+
+    for(unsigned int outer = 0; outer < n_outer; ++outer)
+      for(unsigned int inner = 0; inner < stride; ++inner)
+        for(unsigned int r = 0; r < n_rows; ++r)
+        {
+          scalar sum = dealii::make_vectorized_array<Number>(0.0);
+          for(unsigned int c = 0; c < n_columns; ++c)
+            sum += matrix[r * n_columns + c] * in[inner + stride * (c + n_columns * outer)];
+
+          out[inner + stride * (r + n_rows * outer)] = sum;
+        }
+
+    sizes[direction] = n_rows;
+  }
+
+  // values in points -> coefficients
+  void
+  project(scalar const * values, scalar * result) const
+  {
+    apply_tensor_product(
+      projection_1d, n_coefficients_1d, n_points_1d, n_points_1d, values, result);
+  }
+
+  // coefficients -> values in points
+  void
+  evaluate(scalar const * coefficients_in, scalar * result) const
+  {
+    apply_tensor_product(
+      evaluation_1d, n_points_1d, n_coefficients_1d, n_coefficients_1d, coefficients_in, result);
+  }
+
+  void
+  apply_tensor_product(std::vector<Number> const & matrix,
+                       unsigned int const          n_rows,
+                       unsigned int const          n_columns,
+                       unsigned int const          size_in,
+                       scalar const *              in,
+                       scalar *                    out) const
+  {
+    std::array<unsigned int, points_dim> sizes;
+    sizes.fill(size_in);
+
+    // intermediate results alternate between the two scratch arrays, the last direction writes to
+    // out
+    scalar const * src = in;
+    for(unsigned int d = 0; d < points_dim; ++d)
+    {
+      scalar * dst = (d == points_dim - 1) ? out : scratch[d % 2].data();
+      apply_1d(matrix, n_rows, n_columns, d, sizes, src, dst);
+      src = dst;
+    }
+  }
+
+  VariableCoefficientsStorage storage;
+
+  unsigned int n_batches;
+  unsigned int n_points_1d, n_points;
+  unsigned int n_coefficients_1d, n_coefficients;
+
+  // lower bound of the values evaluated from the polynomial representation
+  Number lower_bound;
+
+  // values in points (Full) or polynomial coefficients (CellwiseConstant, Polynomial)
+  dealii::Table<2, scalar> coefficients;
+
+  // values in points (ReducedPrecision), all lanes of a batch stored contiguously
+  dealii::AlignedVector<float> coefficients_float;
+
+  std::vector<Number> projection_1d, evaluation_1d;
+
+  // scratch data for sum factorization and values in the points of the batch evaluated last. Like
+  // the penalty parameter cached by the kernels using this class, this data is not thread-safe.
+  mutable std::array<dealii::AlignedVector<scalar>, 2> scratch;
+  mutable dealii::AlignedVector<scalar>                cached_values;
+  mutable unsigned int                                 cached_batch;
+};
+} // namespace internal
+
 template<int dim, typename Number>
 class VariableCoefficients
 {
@@ -68,99 +389,102 @@ public:
   void
   initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
              unsigned int const                      degree,
-             Number const &                          constant_coefficient)
+             Number const &                          constant_coefficient,
+             VariableCoefficientsStorage const       storage = VariableCoefficientsStorage::Full,
+             unsigned int const                      storage_degree = 1)
   {
-    unsigned int const points_per_cell = dealii::Utilities::pow(degree + 1, dim);
-    unsigned int const points_per_face = dealii::Utilities::pow(degree + 1, dim - 1);
-
     // cells
-    coefficients_cell.reinit(matrix_free.n_cell_batches(), points_per_cell);
-
-    coefficients_cell.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+    coefficients_cell.reinit(
+      matrix_free.n_cell_batches(), degree + 1, storage, storage_degree, constant_coefficient);
 
     // face-based loops
     coefficients_face.reinit(matrix_free.n_inner_face_batches() +
                                matrix_free.n_boundary_face_batches(),
-                             points_per_face);
-
-    coefficients_face.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
-
-    coefficients_face_neighbor.reinit(matrix_free.n_inner_face_batches(), points_per_face);
+                             degree + 1,
+                             storage,
+                             storage_degree,
+                             constant_coefficient);
 
-    coefficients_face_neighbor.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+    coefficients_face_neighbor.reinit(matrix_free.n_inner_face_batches(),
+                                      degree + 1,
+                                      storage,
+                                      storage_degree,
+                                      constant_coefficient);
 
     // TODO cell-based face loops
-    //    coefficients_face_cell_based.reinit(matrix_free.n_cell_batches()*2*dim,
-    //        points_per_face);
-    //
-    //    coefficients_face_cell_based.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
   }
 
   scalar
   get_coefficient_cell(unsigned int const cell, unsigned int const q) const
   {
-    return coefficients_cell[cell][q];
+    return coefficients_cell.get(cell, q);
   }
 
+  /*
+   *  The functions below set the coefficients in all quadrature points of a cell/face batch.
+   */
   void
-  set_coefficient_cell(unsigned int const cell, unsigned int const q, scalar const & value)
+  set_coefficients_cell(unsigned int const cell, scalar const * values)
   {
-    coefficients_cell[cell][q] = value;
+    coefficients_cell.set(cell, values);
   }
 
   scalar
   get_coefficient_face(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face[face][q];
+    return coefficients_face.get(face, q);
   }
 
   void
-  set_coefficient_face(unsigned int const face, unsigned int const q, scalar const & value)
+  set_coefficients_face(unsigned int const face, scalar const * values)
   {
-    coefficients_face[face][q] = value;
+    coefficients_face.set(face, values);
   }
 
   scalar
   get_coefficient_face_neighbor(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face_neighbor[face][q];
+    return coefficients_face_neighbor.get(face, q);
   }
 
   void
-  set_coefficient_face_neighbor(unsigned int const face, unsigned int const q, scalar const & value)
+  set_coefficients_face_neighbor(unsigned int const face, scalar const * values)
   {
-    coefficients_face_neighbor[face][q] = value;
+    coefficients_face_neighbor.set(face, values);
   }
 
-  // TODO
-  //  scalar
-  //  get_coefficient_cell_based(unsigned int const face,
-  //                             unsigned int const q) const
-  //  {
-  //    return coefficients_face_cell_based[face][q];
-  //  }
-  //
-  //  void
-  //  set_coefficient_cell_based(unsigned int const face,
-  //                             unsigned int const q,
-  //                             scalar const &     value)
-  //  {
-  //    coefficients_face_cell_based[face][q] = value;
-  //  }
+  std::size_t
+  memory_consumption() const
+  {
+    return coefficients_cell.memory_consumption() + coefficients_face.memory_consumption() +
+           coefficients_face_neighbor.memory_consumption();
+  }
+
+  /*
+   *  Memory consumption with storage VariableCoefficientsStorage::Full, to quantify the savings of
+   *  the compressed storage variants.
+   */
+  std::size_t
+  memory_consumption_full_storage() const
+  {
+    return coefficients_cell.memory_consumption_full_storage() +
+           coefficients_face.memory_consumption_full_storage() +
+           coefficients_face_neighbor.memory_consumption_full_storage();
+  }
 
 private:
   // variable coefficients
 
   // cell
-  dealii::Table<2, scalar> coefficients_cell;
+  internal::CoefficientStorage<dim, Number> coefficients_cell;
 
   // face-based loops
-  dealii::Table<2, scalar> coefficients_face;
-  dealii::Table<2, scalar> coefficients_face_neighbor;
+  internal::CoefficientStorage<dim - 1, Number> coefficients_face;
+  internal::CoefficientStorage<dim - 1, Number> coefficients_face_neighbor;
 
   // TODO
   //  // cell-based face loops
-  //  dealii::Table<2, scalar> coefficients_face_cell_based;
+  //  internal::CoefficientStorage<dim - 1, Number> coefficients_face_cell_based;
 };
 
 } // namespace ExaDG
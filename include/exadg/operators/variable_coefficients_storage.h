@@ -0,0 +1,82 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+#ifndef INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_STORAGE_H_
+#define INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_STORAGE_H_
+
+// C/C++
+#include <string>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+namespace ExaDG
+{
+/*
+ *  Storage of variable coefficients given in the quadrature points of cells and faces:
+ *
+ *  Full:             one value per quadrature point
+ *  CellwiseConstant: one value per cell/face (mean value)
+ *  Polynomial:       L2-projection onto tensor-product polynomials of low degree, which are
+ *                    evaluated in the quadrature points by sum factorization. Since the
+ *                    projection may undershoot, the values are bounded from below by the
+ *                    constant coefficient the storage is initialized with.
+ *  ReducedPrecision: one value per quadrature point in single precision
+ *
+ *  The compressed variants reduce the memory footprint and the amount of data that has to be
+ *  loaded from memory in each operator evaluation.
+ */
+enum class VariableCoefficientsStorage
+{
+  Full,
+  CellwiseConstant,
+  Polynomial,
+  ReducedPrecision
+};
+
+inline std::string
+enum_to_string(VariableCoefficientsStorage const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case VariableCoefficientsStorage::Full:
+      string_type = "Full";
+      break;
+    case VariableCoefficientsStorage::CellwiseConstant:
+      string_type = "CellwiseConstant";
+      break;
+    case VariableCoefficientsStorage::Polynomial:
+      string_type = "Polynomial";
+      break;
+    case VariableCoefficientsStorage::ReducedPrecision:
+      string_type = "ReducedPrecision";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_STORAGE_H_ */
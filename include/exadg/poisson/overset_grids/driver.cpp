@@ -31,29 +31,84 @@ namespace Poisson
 {
 template<int dim, int n_components, typename Number>
 DriverOversetGrids<dim, n_components, Number>::DriverOversetGrids(
+  std::string const &                                                     input_file,
   MPI_Comm const &                                                        comm,
   std::shared_ptr<ApplicationOversetGridsBase<dim, n_components, Number>> app)
   : mpi_comm(comm),
+    mpi_comm_1(comm),
+    mpi_comm_2(comm),
+    is_domain1_process(true),
+    is_domain2_process(true),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
     application(app)
 {
   print_general_info<Number>(pcout, mpi_comm, false /* is_test */);
 
+  dealii::ParameterHandler prm;
+  parameters.add_parameters(prm);
+  prm.parse_input(input_file, "", true, true);
+
+  setup_communicators();
+
   poisson1 = std::make_shared<SolverPoisson<dim, n_components, Number>>();
   poisson2 = std::make_shared<SolverPoisson<dim, n_components, Number>>();
 }
 
+template<int dim, int n_components, typename Number>
+void
+DriverOversetGrids<dim, n_components, Number>::setup_communicators()
+{
+  if(separate_processes())
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+    unsigned int const rank_global = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    AssertThrow(parameters.variant == "Additive",
+                dealii::ExcMessage("Solving the domains on separate processes requires the "
+                                   "additive Schwarz iteration."));
+    AssertThrow(parameters.n_processes_domain1 < n_processes,
+                dealii::ExcMessage("At least one process has to be left for domain 2."));
+
+    is_domain1_process = (rank_global < parameters.n_processes_domain1);
+    is_domain2_process = not(is_domain1_process);
+
+    // The communicator is not freed by the driver, since the triangulations created by the
+    // application on this communicator may outlive the driver.
+    MPI_Comm sub_comm;
+    MPI_Comm_split(mpi_comm, is_domain1_process ? 0 : 1, rank_global, &sub_comm);
+
+    mpi_comm_1 = is_domain1_process ? sub_comm : MPI_COMM_NULL;
+    mpi_comm_2 = is_domain2_process ? sub_comm : MPI_COMM_NULL;
+
+    pcout << std::endl
+          << "Domain 1 is solved on " << parameters.n_processes_domain1 << " of " << n_processes
+          << " processes." << std::endl;
+  }
+}
+
+template<int dim, int n_components, typename Number>
+bool
+DriverOversetGrids<dim, n_components, Number>::separate_processes() const
+{
+  return parameters.n_processes_domain1 > 0;
+}
+
 template<int dim, int n_components, typename Number>
 void
 DriverOversetGrids<dim, n_components, Number>::setup()
 {
   pcout << std::endl << "Setting up Poisson solver for overset grids:" << std::endl;
 
+  if(separate_processes())
+    application->set_mpi_comm(is_domain1_process ? mpi_comm_1 : mpi_comm_2);
+
   application->setup();
 
   // setup Poisson solvers
-  poisson1->setup(application->domain1, mpi_comm, false);
-  poisson2->setup(application->domain2, mpi_comm, false);
+  if(is_domain1_process)
+    poisson1->setup(application->domain1, mpi_comm_1, false);
+  if(is_domain2_process)
+    poisson2->setup(application->domain2, mpi_comm_2, false);
 
   // setup interface coupling
   {
@@ -61,14 +116,12 @@ DriverOversetGrids<dim, n_components, Number>::setup()
     pcout << std::endl << "Setup interface coupling first -> second ..." << std::endl;
 
     first_to_second = std::make_shared<InterfaceCoupling<dim, n_components, Number>>();
-    // No map of boundary IDs can be provided to make the search more efficient. The reason behind
-    // is that the two domains are not connected along boundaries but are overlapping instead. To
-    // resolve this, the implementation of InterfaceCoupling needs to be generalized.
-    first_to_second->setup(poisson2->pde_operator->get_container_interface_data(),
-                           poisson1->pde_operator->get_dof_handler(),
-                           *application->domain1->get_grid()->mapping,
-                           {} /* marked_vertices */,
-                           1.e-8 /* geometric tolerance */);
+    setup_coupling(*first_to_second,
+                   is_domain2_process ? poisson2->pde_operator->get_container_interface_data() :
+                                        nullptr,
+                   is_domain1_process ? &poisson1->pde_operator->get_dof_handler() : nullptr,
+                   is_domain1_process ? application->domain1->get_grid()->mapping.get() :
+                                        nullptr);
 
     pcout << std::endl << "... done." << std::endl;
 
@@ -76,63 +129,243 @@ DriverOversetGrids<dim, n_components, Number>::setup()
     pcout << std::endl << "Setup interface coupling second -> first ..." << std::endl;
 
     second_to_first = std::make_shared<InterfaceCoupling<dim, n_components, Number>>();
-    second_to_first->setup(poisson1->pde_operator->get_container_interface_data(),
-                           poisson2->pde_operator->get_dof_handler(),
-                           *application->domain2->get_grid()->mapping,
-                           {} /* marked_vertices */,
-                           1.e-8 /* geometric tolerance */);
+    setup_coupling(*second_to_first,
+                   is_domain1_process ? poisson1->pde_operator->get_container_interface_data() :
+                                        nullptr,
+                   is_domain2_process ? &poisson2->pde_operator->get_dof_handler() : nullptr,
+                   is_domain2_process ? application->domain2->get_grid()->mapping.get() :
+                                        nullptr);
 
     pcout << std::endl << "... done." << std::endl;
   }
 }
 
+template<int dim, int n_components, typename Number>
+void
+DriverOversetGrids<dim, n_components, Number>::setup_coupling(
+  InterfaceCoupling<dim, n_components, Number> &                     coupling,
+  std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst,
+  dealii::DoFHandler<dim> const *                                    dof_handler_src,
+  dealii::Mapping<dim> const *                                       mapping_src) const
+{
+  // No map of boundary IDs can be provided to make the search more efficient. The reason behind
+  // is that the two domains are not connected along boundaries but are overlapping instead. To
+  // resolve this, the implementation of InterfaceCoupling needs to be generalized.
+  if(separate_processes())
+  {
+    coupling.setup(interface_data_dst,
+                   dof_handler_src,
+                   mapping_src,
+                   {} /* marked_vertices */,
+                   parameters.geometric_tolerance,
+                   mpi_comm);
+  }
+  else
+  {
+    coupling.setup(interface_data_dst,
+                   *dof_handler_src,
+                   *mapping_src,
+                   {} /* marked_vertices */,
+                   parameters.geometric_tolerance);
+  }
+}
+
+template<int dim, int n_components, typename Number>
+double
+DriverOversetGrids<dim, n_components, Number>::sum_over_domains(double const value_1,
+                                                                double const value_2) const
+{
+  if(separate_processes())
+  {
+    // domain 1 lives on the first processes of mpi_comm, domain 2 on the remaining ones
+    return dealii::Utilities::MPI::broadcast(mpi_comm, value_1, 0) +
+           dealii::Utilities::MPI::broadcast(mpi_comm, value_2, parameters.n_processes_domain1);
+  }
+  else
+  {
+    return value_1 + value_2;
+  }
+}
+
+template<int dim, int n_components, typename Number>
+bool
+DriverOversetGrids<dim, n_components, Number>::check_convergence(VectorType const & r_1,
+                                                                 VectorType const & r_2,
+                                                                 VectorType const & sol_1,
+                                                                 VectorType const & sol_2) const
+{
+  double const residual_norm =
+    std::sqrt(sum_over_domains(is_domain1_process ? r_1.norm_sqr() : 0.0,
+                               is_domain2_process ? r_2.norm_sqr() : 0.0));
+
+  double const ref_norm_abs = std::sqrt(sum_over_domains(
+    is_domain1_process ? (double)poisson1->pde_operator->get_dof_handler().n_dofs() : 0.0,
+    is_domain2_process ? (double)poisson2->pde_operator->get_dof_handler().n_dofs() : 0.0));
+
+  double const ref_norm_rel =
+    std::sqrt(sum_over_domains(is_domain1_process ? sol_1.norm_sqr() : 0.0,
+                               is_domain2_process ? sol_2.norm_sqr() : 0.0));
+
+  pcout << std::endl << "  Schwarz iteration: residual = " << residual_norm << std::endl;
+
+  bool const converged = (residual_norm < parameters.abs_tol * ref_norm_abs) ||
+                         (residual_norm < parameters.rel_tol * ref_norm_rel);
+
+  return converged;
+}
+
+template<int dim, int n_components, typename Number>
+void
+DriverOversetGrids<dim, n_components, Number>::do_postprocessing(VectorType const & sol_1,
+                                                                 VectorType const & sol_2) const
+{
+  if(is_domain1_process)
+    poisson1->postprocessor->do_postprocessing(sol_1);
+  if(is_domain2_process)
+    poisson2->postprocessor->do_postprocessing(sol_2);
+}
+
 template<int dim, int n_components, typename Number>
 void
 DriverOversetGrids<dim, n_components, Number>::solve()
 {
-  // initialization of vectors
-  dealii::LinearAlgebra::distributed::Vector<Number> rhs_1, rhs_2;
-  dealii::LinearAlgebra::distributed::Vector<Number> sol_1, sol_2;
-  poisson1->pde_operator->initialize_dof_vector(rhs_1);
-  poisson1->pde_operator->initialize_dof_vector(sol_1);
-  poisson1->pde_operator->prescribe_initial_conditions(sol_1);
+  // initialization of vectors (only on the processes of the respective domain)
+  VectorType rhs_1, rhs_2;
+  VectorType sol_1, sol_2;
+  VectorType r_1, r_2, r_1_old, r_2_old;
+  if(is_domain1_process)
+  {
+    poisson1->pde_operator->initialize_dof_vector(rhs_1);
+    poisson1->pde_operator->initialize_dof_vector(sol_1);
+    poisson1->pde_operator->prescribe_initial_conditions(sol_1);
+  }
 
-  poisson2->pde_operator->initialize_dof_vector(rhs_2);
-  poisson2->pde_operator->initialize_dof_vector(sol_2);
-  poisson2->pde_operator->prescribe_initial_conditions(sol_2);
+  if(is_domain2_process)
+  {
+    poisson2->pde_operator->initialize_dof_vector(rhs_2);
+    poisson2->pde_operator->initialize_dof_vector(sol_2);
+    poisson2->pde_operator->prescribe_initial_conditions(sol_2);
+  }
 
   // postprocessing of results
-  poisson1->postprocessor->do_postprocessing(sol_1);
-  poisson2->postprocessor->do_postprocessing(sol_2);
+  do_postprocessing(sol_1, sol_2);
 
-  // solve linear system of equations
-  bool         converged = false;
-  unsigned int iter      = 0;
-  while(not(converged))
-  {
-    // solve on domain 1
+  bool const additive = (parameters.variant == "Additive");
+
+  auto const solve_domain_1 = [&]() {
     poisson1->pde_operator->rhs(rhs_1);
     poisson1->pde_operator->solve(sol_1, rhs_1, 0.0 /* time */);
+  };
 
-    // Transfer data domain 1 to domain 2
-    first_to_second->update_data(sol_1);
-
-    // solve on domain 2
+  auto const solve_domain_2 = [&]() {
     poisson2->pde_operator->rhs(rhs_2);
     poisson2->pde_operator->solve(sol_2, rhs_2, 0.0 /* time */);
+  };
+
+  // Schwarz iteration: one iteration maps the subdomain solutions x = (sol_1, sol_2) to G(x),
+  // the residual is r = G(x) - x
+  bool         converged = false;
+  unsigned int k         = 0;
+  double       omega     = parameters.omega_init;
+  while(not(converged) and k < parameters.iter_max)
+  {
+    if(is_domain1_process)
+      r_1 = sol_1;
+    if(is_domain2_process)
+      r_2 = sol_2;
+
+    if(additive)
+    {
+      // both domains are solved at the same time using the interface data of the previous
+      // iteration (concurrently in case of separate processes)
+      if(is_domain1_process)
+        solve_domain_1();
+      if(is_domain2_process)
+        solve_domain_2();
+    }
+    else
+    {
+      solve_domain_1();
+
+      // transfer data from domain 1 to domain 2
+      first_to_second->update_data(sol_1);
+
+      solve_domain_2();
+    }
+
+    // compute residual and check convergence
+    if(is_domain1_process)
+      r_1.sadd(-1.0, 1.0, sol_1);
+    if(is_domain2_process)
+      r_2.sadd(-1.0, 1.0, sol_2);
+
+    converged = check_convergence(r_1, r_2, sol_1, sol_2);
 
-    // Transfer data from 2 to 1
+    // relaxation
+    if(not(converged))
+    {
+      if(parameters.method == "Aitken" and k > 0)
+      {
+        double r_old_times_delta_r = 0.0, delta_r_norm_sqr = 0.0;
+        if(is_domain1_process)
+        {
+          r_1_old.sadd(-1.0, 1.0, r_1);
+          r_old_times_delta_r += r_1_old * r_1;
+          delta_r_norm_sqr += r_1_old.norm_sqr();
+        }
+        if(is_domain2_process)
+        {
+          r_2_old.sadd(-1.0, 1.0, r_2);
+          r_old_times_delta_r += r_2_old * r_2;
+          delta_r_norm_sqr += r_2_old.norm_sqr();
+        }
+
+        // r_old * delta_r = r * delta_r - delta_r * delta_r
+        r_old_times_delta_r -= delta_r_norm_sqr;
+
+        // In case of separate processes, the contributions of the domains are computed
+        // on different processes. Both are valid on the respective processes.
+        if(separate_processes())
+        {
+          r_old_times_delta_r = sum_over_domains(r_old_times_delta_r, r_old_times_delta_r);
+          delta_r_norm_sqr    = sum_over_domains(delta_r_norm_sqr, delta_r_norm_sqr);
+        }
+
+        omega *= -r_old_times_delta_r / delta_r_norm_sqr;
+      }
+
+      // x = x + omega * r = G(x) - (1 - omega) * r
+      if(omega != 1.0)
+      {
+        if(is_domain1_process)
+          sol_1.add(omega - 1.0, r_1);
+        if(is_domain2_process)
+          sol_2.add(omega - 1.0, r_2);
+      }
+
+      if(is_domain1_process)
+        r_1_old = r_1;
+      if(is_domain2_process)
+        r_2_old = r_2;
+    }
+
+    // transfer data in both directions (domain 2 receives the data from domain 1 within the
+    // next iteration in case of the multiplicative variant)
+    if(additive)
+      first_to_second->update_data(sol_1);
     second_to_first->update_data(sol_2);
 
     // postprocessing of results
-    poisson1->postprocessor->do_postprocessing(sol_1);
-    poisson2->postprocessor->do_postprocessing(sol_2);
+    do_postprocessing(sol_1, sol_2);
 
-    // TODO check convergence
-    ++iter;
-    if(iter > 10)
-      converged = true;
+    ++k;
   }
+
+  if(converged)
+    pcout << std::endl << "Schwarz iteration converged in " << k << " iterations." << std::endl;
+  else
+    pcout << std::endl
+          << "Schwarz iteration did not converge within " << k << " iterations." << std::endl;
 }
 
 template class DriverOversetGrids<2, 1, float>;
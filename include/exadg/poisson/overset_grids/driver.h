@@ -24,6 +24,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/interface_coupling.h>
+#include <exadg/poisson/overset_grids/parameters.h>
 #include <exadg/poisson/solver_poisson.h>
 
 namespace ExaDG
@@ -33,8 +34,12 @@ namespace Poisson
 template<int dim, int n_components, typename Number>
 class DriverOversetGrids
 {
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
 public:
   DriverOversetGrids(
+    std::string const &                                                     input_file,
     MPI_Comm const &                                                        mpi_comm,
     std::shared_ptr<ApplicationOversetGridsBase<dim, n_components, Number>> application);
 
@@ -45,15 +50,56 @@ public:
   solve();
 
 private:
+  void
+  setup_communicators();
+
+  bool
+  separate_processes() const;
+
+  void
+  setup_coupling(
+    InterfaceCoupling<dim, n_components, Number> &                     coupling,
+    std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst,
+    dealii::DoFHandler<dim> const *                                    dof_handler_src,
+    dealii::Mapping<dim> const *                                       mapping_src) const;
+
+  /*
+   * Sums a quantity computed separately for both domains. In case of separate processes,
+   * value_1 is only valid on the processes of domain 1 and value_2 only on the processes of
+   * domain 2.
+   */
+  double
+  sum_over_domains(double const value_1, double const value_2) const;
+
+  bool
+  check_convergence(VectorType const & r_1,
+                    VectorType const & r_2,
+                    VectorType const & sol_1,
+                    VectorType const & sol_2) const;
+
+  void
+  do_postprocessing(VectorType const & sol_1, VectorType const & sol_2) const;
+
   static unsigned int const rank =
     (n_components == 1) ? 0 : ((n_components == dim) ? 1 : dealii::numbers::invalid_unsigned_int);
 
   // MPI communicator
   MPI_Comm const mpi_comm;
 
+  // communicators of the two domains (equal to mpi_comm unless the domains are solved on
+  // separate processes, MPI_COMM_NULL on processes not involved)
+  MPI_Comm mpi_comm_1;
+  MPI_Comm mpi_comm_2;
+
+  bool is_domain1_process;
+  bool is_domain2_process;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
+  // parameters of the Schwarz iteration
+  OversetGridsParameters parameters;
+
   std::shared_ptr<ApplicationOversetGridsBase<dim, n_components, Number>> application;
 
   // Poisson solvers
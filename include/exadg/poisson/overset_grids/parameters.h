@@ -0,0 +1,123 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POISSON_OVERSET_GRIDS_PARAMETERS_H_
+#define INCLUDE_EXADG_POISSON_OVERSET_GRIDS_PARAMETERS_H_
+
+// deal.II
+#include <deal.II/base/parameter_handler.h>
+
+namespace ExaDG
+{
+namespace Poisson
+{
+/*
+ * Parameters of the Schwarz iteration coupling the two overlapping grids.
+ */
+struct OversetGridsParameters
+{
+  OversetGridsParameters()
+    : variant("Multiplicative"),
+      method("FixedPoint"),
+      abs_tol(1.e-12),
+      rel_tol(1.e-6),
+      omega_init(1.0),
+      iter_max(100),
+      geometric_tolerance(1.e-8),
+      n_processes_domain1(0)
+  {
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm, std::string const & subsection_name = "Schwarz")
+  {
+    // clang-format off
+    prm.enter_subsection(subsection_name);
+      prm.add_parameter("Variant",
+                        variant,
+                        "Multiplicative (one domain after the other) or additive (both domains "
+                        "at the same time) Schwarz iteration.",
+                        dealii::Patterns::Selection("Multiplicative|Additive"),
+                        false);
+      prm.add_parameter("Method",
+                        method,
+                        "Acceleration method.",
+                        dealii::Patterns::Selection("FixedPoint|Aitken"),
+                        false);
+      prm.add_parameter("AbsTol",
+                        abs_tol,
+                        "Absolute tolerance of the Schwarz iteration.",
+                        dealii::Patterns::Double(0.0,1.0),
+                        false);
+      prm.add_parameter("RelTol",
+                        rel_tol,
+                        "Relative tolerance of the Schwarz iteration.",
+                        dealii::Patterns::Double(0.0,1.0),
+                        false);
+      prm.add_parameter("OmegaInit",
+                        omega_init,
+                        "Initial relaxation parameter.",
+                        dealii::Patterns::Double(0.0,1.0),
+                        false);
+      prm.add_parameter("IterMax",
+                        iter_max,
+                        "Maximum number of Schwarz iterations.",
+                        dealii::Patterns::Integer(1,10000),
+                        false);
+      prm.add_parameter("GeometricTolerance",
+                        geometric_tolerance,
+                        "Tolerance used to locate points in the overlap region.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
+      prm.add_parameter("ProcessesDomain1",
+                        n_processes_domain1,
+                        "Number of processes dedicated to domain 1 (0: all processes). "
+                        "Only possible for the additive variant.",
+                        dealii::Patterns::Integer(0),
+                        false);
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+  std::string variant;
+  std::string method;
+
+  // The Schwarz iteration is converged if the l2-norm of the change of the subdomain
+  // solutions is smaller than abs_tol * sqrt(n_dofs) or rel_tol times the l2-norm of the
+  // subdomain solutions.
+  double abs_tol;
+  double rel_tol;
+
+  // initial relaxation parameter (Aitken) or constant relaxation parameter (FixedPoint)
+  double omega_init;
+
+  unsigned int iter_max;
+
+  double geometric_tolerance;
+
+  // If 0, both domains are solved on all processes. Otherwise, domain 1 is solved on the
+  // first n_processes_domain1 processes and domain 2 on the remaining processes.
+  unsigned int n_processes_domain1;
+};
+} // namespace Poisson
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POISSON_OVERSET_GRIDS_PARAMETERS_H_ */
@@ -51,6 +51,9 @@ create_input_file(std::string const & input_file)
   Poisson::get_application_overset_grids<Dim, 1, Number>(input_file, MPI_COMM_WORLD)
     ->add_parameters(prm);
 
+  Poisson::OversetGridsParameters overset_grids;
+  overset_grids.add_parameters(prm);
+
   prm.print_parameters(input_file,
                        dealii::ParameterHandler::Short |
                          dealii::ParameterHandler::KeepDeclarationOrder);
@@ -64,7 +67,9 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm)
     Poisson::get_application_overset_grids<dim, n_components, Number>(input_file, mpi_comm);
 
   std::shared_ptr<Poisson::DriverOversetGrids<dim, n_components, Number>> driver =
-    std::make_shared<Poisson::DriverOversetGrids<dim, n_components, Number>>(mpi_comm, application);
+    std::make_shared<Poisson::DriverOversetGrids<dim, n_components, Number>>(input_file,
+                                                                             mpi_comm,
+                                                                             application);
 
   driver->setup();
 
@@ -133,6 +133,19 @@ public:
   {
   }
 
+  /*
+   * Creates both domains on the given communicator. In case the domains are solved on
+   * separate processes, each group of processes creates the grids of both domains, which is
+   * needed to identify the overlap region, but solves only on one of them. This function has
+   * to be called before setup().
+   */
+  void
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    domain1->set_mpi_comm(comm);
+    domain2->set_mpi_comm(comm);
+  }
+
   void
   setup()
   {
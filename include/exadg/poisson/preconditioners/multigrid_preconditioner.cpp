@@ -28,7 +28,7 @@ namespace Poisson
 template<int dim, typename Number, int n_components>
 MultigridPreconditioner<dim, Number, n_components>::MultigridPreconditioner(
   MPI_Comm const & mpi_comm)
-  : Base(mpi_comm), is_dg(true), mesh_is_moving(false)
+  : Base(mpi_comm, "Multigrid Poisson"), is_dg(true), mesh_is_moving(false)
 {
 }
 
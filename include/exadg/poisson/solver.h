@@ -30,6 +30,7 @@
 // utilities
 #include <exadg/utilities/general_parameters.h>
 #include <exadg/utilities/hypercube_resolution_parameters.h>
+#include <exadg/utilities/profiler.h>
 
 // application
 #include <exadg/poisson/user_interface/declare_get_application.h>
@@ -44,6 +45,9 @@ create_input_file(std::string const & input_file)
   GeneralParameters general;
   general.add_parameters(prm);
 
+  ProfilerParameters profiler;
+  profiler.add_parameters(prm);
+
   HypercubeResolutionParameters resolution;
   resolution.add_parameters(prm);
 
@@ -71,6 +75,8 @@ run(std::vector<SolverResult> & results,
   dealii::Timer timer;
   timer.restart();
 
+  Profiler::instance().reinit(ProfilerParameters(input_file), mpi_comm);
+
   std::shared_ptr<Poisson::ApplicationBase<dim, 1, Number>> application =
     Poisson::get_application<dim, 1, Number>(input_file, mpi_comm);
 
@@ -85,6 +91,14 @@ run(std::vector<SolverResult> & results,
 
   SolverResult result = driver->print_performance_results(timer.wall_time());
   results.push_back(result);
+
+  if(not(is_test))
+  {
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    Profiler::instance().print_summary(pcout, mpi_comm);
+    Profiler::instance().write_results(mpi_comm);
+  }
 }
 } // namespace ExaDG
 
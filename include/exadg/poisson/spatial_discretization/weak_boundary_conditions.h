@@ -91,7 +91,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryType::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+        auto bc       = boundary_descriptor->dirichlet_bc_vectorized.find(boundary_id)->second;
         auto q_points = integrator.quadrature_point(q);
 
         g = FunctionEvaluator<rank, dim, Number>::value(bc, q_points, time);
@@ -207,7 +207,7 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full || operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
+      auto bc       = boundary_descriptor->neumann_bc_vectorized.find(boundary_id)->second;
       auto q_points = integrator.quadrature_point(q);
 
       auto h = FunctionEvaluator<rank, dim, Number>::value(bc, q_points, time);
@@ -250,7 +250,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
   if(boundary_type == BoundaryType::Neumann)
   {
-    auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
+    auto bc       = boundary_descriptor->neumann_bc_vectorized.find(boundary_id)->second;
     auto q_points = integrator.quadrature_point(q);
 
     normal_gradient = FunctionEvaluator<rank, dim, Number>::value(bc, q_points, time);
@@ -70,6 +70,18 @@ public:
   {
   }
 
+  /*
+   * Assigns the application to a different communicator, e.g. to a subset of the processes
+   * in case of overset grids solved on separate processes. This function has to be called
+   * before setup().
+   */
+  void
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
   virtual void
   set_parameters_refinement_study(unsigned int const degree,
                                   unsigned int const refine_space,
@@ -113,6 +125,7 @@ public:
     boundary_descriptor = std::make_shared<BoundaryDescriptor<rank, dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions(*boundary_descriptor, *grid);
+    boundary_descriptor->set_vectorized_functions();
 
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
@@ -171,7 +184,7 @@ protected:
     }
   }
 
-  MPI_Comm const & mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
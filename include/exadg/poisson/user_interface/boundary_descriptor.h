@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/function_cached.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 
 namespace ExaDG
 {
@@ -54,6 +55,21 @@ struct BoundaryDescriptor
 
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> neumann_bc;
 
+  // Vectorized representation of dirichlet_bc and neumann_bc evaluated by the matrix-free
+  // kernels, see set_vectorized_functions().
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    dirichlet_bc_vectorized;
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    neumann_bc_vectorized;
+
+  // has to be called once all boundary conditions have been prescribed
+  void
+  set_vectorized_functions()
+  {
+    dirichlet_bc_vectorized = make_function_vectorized(dirichlet_bc);
+    neumann_bc_vectorized   = make_function_vectorized(neumann_bc);
+  }
+
   // returns the boundary type
   inline DEAL_II_ALWAYS_INLINE //
     BoundaryType
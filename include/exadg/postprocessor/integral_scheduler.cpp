@@ -0,0 +1,487 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <limits>
+
+// ExaDG
+#include <exadg/postprocessor/integral_scheduler.h>
+
+namespace ExaDG
+{
+namespace
+{
+/*
+ * MPI reduction operation for the buffer of the IntegralScheduler: The buffer is communicated as a
+ * single element of a contiguous datatype, so that it is never split by the MPI implementation. Its
+ * first entry contains the number n of values to be summed, which are stored in the entries
+ * [1, n]. The maximum is taken for the remaining entries.
+ */
+void
+reduce_sum_and_max(void * in, void * inout, int * len, MPI_Datatype * datatype)
+{
+  int size = 0;
+  MPI_Type_size(*datatype, &size);
+  unsigned int const n_entries = size / sizeof(double);
+
+  for(int e = 0; e < *len; ++e)
+  {
+    double const * a = static_cast<double const *>(in) + e * n_entries;
+    double *       b = static_cast<double *>(inout) + e * n_entries;
+
+    unsigned int const n_sum = static_cast<unsigned int>(a[0]);
+
+    for(unsigned int i = 1; i < n_entries; ++i)
+      b[i] = (i <= n_sum) ? a[i] + b[i] : std::max(a[i], b[i]);
+  }
+}
+} // namespace
+
+template<int dim, typename Number>
+IntegralScheduler<dim, Number>::IntegralScheduler(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    matrix_free(nullptr),
+    dof_index_velocity(0),
+    dof_index_pressure(0),
+    quad_index(0),
+    cell_flags(dealii::EvaluationFlags::nothing),
+    face_flags(dealii::EvaluationFlags::nothing),
+    boundary_flags_velocity(dealii::EvaluationFlags::nothing),
+    boundary_flags_pressure(dealii::EvaluationFlags::nothing),
+    pressure(nullptr),
+    reduction_pending(false)
+{
+  MPI_Op_create(&reduce_sum_and_max, 1 /* commutative */, &mpi_op);
+}
+
+template<int dim, typename Number>
+IntegralScheduler<dim, Number>::~IntegralScheduler()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+
+  if(not finalized)
+  {
+    if(reduction_pending)
+    {
+      MPI_Wait(&mpi_request, MPI_STATUS_IGNORE);
+      MPI_Type_free(&mpi_datatype);
+    }
+
+    MPI_Op_free(&mpi_op);
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                      unsigned int const                      dof_index_velocity_in,
+                                      unsigned int const                      dof_index_pressure_in,
+                                      unsigned int const                      quad_index_in)
+{
+  matrix_free        = &matrix_free_in;
+  dof_index_velocity = dof_index_velocity_in;
+  dof_index_pressure = dof_index_pressure_in;
+  quad_index         = quad_index_in;
+}
+
+template<int dim, typename Number>
+unsigned int
+IntegralScheduler<dim, Number>::add_integral(Integral const & integral)
+{
+  AssertThrow(integral.reduction.size() > 0,
+              dealii::ExcMessage("An integral has to provide at least one value."));
+
+  integrals.push_back(integral);
+
+  return integrals.size() - 1;
+}
+
+template<int dim, typename Number>
+unsigned int
+IntegralScheduler<dim, Number>::add_cell_integral(
+  std::vector<ReductionType> const &             reduction,
+  dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+  CellIntegrand const &                          integrand)
+{
+  Integral integral;
+  integral.reduction      = reduction;
+  integral.flags_velocity = flags_velocity;
+  integral.flags_pressure = dealii::EvaluationFlags::nothing;
+  integral.cell_integrand = integrand;
+
+  return add_integral(integral);
+}
+
+template<int dim, typename Number>
+unsigned int
+IntegralScheduler<dim, Number>::add_face_integral(
+  std::vector<ReductionType> const &             reduction,
+  dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+  FaceIntegrand const &                          integrand)
+{
+  Integral integral;
+  integral.reduction      = reduction;
+  integral.flags_velocity = flags_velocity;
+  integral.flags_pressure = dealii::EvaluationFlags::nothing;
+  integral.face_integrand = integrand;
+
+  return add_integral(integral);
+}
+
+template<int dim, typename Number>
+unsigned int
+IntegralScheduler<dim, Number>::add_boundary_face_integral(
+  std::set<dealii::types::boundary_id> const &   boundary_ids,
+  std::vector<ReductionType> const &             reduction,
+  dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+  dealii::EvaluationFlags::EvaluationFlags const flags_pressure,
+  BoundaryFaceIntegrand const &                  integrand)
+{
+  Integral integral;
+  integral.reduction               = reduction;
+  integral.flags_velocity          = flags_velocity;
+  integral.flags_pressure          = flags_pressure;
+  integral.boundary_face_integrand = integrand;
+  integral.boundary_ids            = boundary_ids;
+
+  return add_integral(integral);
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::request(std::vector<unsigned int> const & indices,
+                                        Callback const &                  callback)
+{
+  for(auto const index : indices)
+    AssertThrow(index < integrals.size(), dealii::ExcMessage("Invalid index of integral."));
+
+  requests.emplace_back(indices, callback);
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::start(VectorType const & velocity, VectorType const & pressure_in)
+{
+  finish();
+
+  if(requests.empty())
+    return;
+
+  AssertThrow(matrix_free != nullptr, dealii::ExcMessage("IntegralScheduler is not set up."));
+
+  // collect the integrals to be evaluated and assign positions in the local result vector
+  active_cell_integrals.clear();
+  active_face_integrals.clear();
+  active_boundary_face_integrals.clear();
+
+  cell_flags              = dealii::EvaluationFlags::nothing;
+  face_flags              = dealii::EvaluationFlags::nothing;
+  boundary_flags_velocity = dealii::EvaluationFlags::nothing;
+  boundary_flags_pressure = dealii::EvaluationFlags::nothing;
+
+  // offsets[r][i]: position of the first value of the i-th integral of request r
+  std::vector<std::vector<unsigned int>> offsets(requests.size());
+
+  unsigned int n_values = 0;
+  for(unsigned int r = 0; r < requests.size(); ++r)
+  {
+    for(auto const index : requests[r].first)
+    {
+      Integral const &     integral = integrals[index];
+      ActiveIntegral const active   = {index, n_values};
+
+      if(integral.cell_integrand)
+      {
+        active_cell_integrals.push_back(active);
+        cell_flags = cell_flags | integral.flags_velocity;
+      }
+      else if(integral.face_integrand)
+      {
+        active_face_integrals.push_back(active);
+        face_flags = face_flags | integral.flags_velocity;
+      }
+      else if(integral.boundary_face_integrand)
+      {
+        active_boundary_face_integrals.push_back(active);
+        boundary_flags_velocity = boundary_flags_velocity | integral.flags_velocity;
+        boundary_flags_pressure = boundary_flags_pressure | integral.flags_pressure;
+      }
+
+      offsets[r].push_back(n_values);
+      n_values += integral.reduction.size();
+    }
+  }
+
+  // initialize local values with the neutral element of the respective reduction
+  std::vector<Number> local_values(n_values, 0.0);
+  for(unsigned int r = 0; r < requests.size(); ++r)
+    for(unsigned int i = 0; i < requests[r].first.size(); ++i)
+    {
+      std::vector<ReductionType> const & reduction = integrals[requests[r].first[i]].reduction;
+      for(unsigned int c = 0; c < reduction.size(); ++c)
+        if(reduction[c] == ReductionType::Max)
+          local_values[offsets[r][i] + c] = std::numeric_limits<Number>::lowest();
+    }
+
+  // pressure is only read on boundary faces of locally owned cells
+  bool const pressure_has_ghost_elements = pressure_in.has_ghost_elements();
+  if(boundary_flags_pressure != dealii::EvaluationFlags::nothing and
+     not pressure_has_ghost_elements)
+    pressure_in.update_ghost_values();
+
+  pressure = &pressure_in;
+
+  // one loop over all cells, interior faces, and boundary faces
+  matrix_free->loop(&IntegralScheduler<dim, Number>::cell_loop,
+                    &IntegralScheduler<dim, Number>::face_loop,
+                    &IntegralScheduler<dim, Number>::boundary_face_loop,
+                    this,
+                    local_values,
+                    velocity);
+
+  pressure = nullptr;
+
+  if(boundary_flags_pressure != dealii::EvaluationFlags::nothing and
+     not pressure_has_ghost_elements)
+    pressure_in.zero_out_ghost_values();
+
+  // pack all values into one buffer: header, values to be summed, values to be maximized
+  unsigned int n_sum = 0;
+  for(unsigned int r = 0; r < requests.size(); ++r)
+    for(unsigned int i = 0; i < requests[r].first.size(); ++i)
+      for(auto const reduction : integrals[requests[r].first[i]].reduction)
+        if(reduction == ReductionType::Sum)
+          ++n_sum;
+
+  buffer.assign(1 + n_values, 0.0);
+  buffer[0] = n_sum;
+
+  pending_positions.assign(requests.size(), std::vector<unsigned int>());
+
+  unsigned int position_sum = 1, position_max = 1 + n_sum;
+  for(unsigned int r = 0; r < requests.size(); ++r)
+    for(unsigned int i = 0; i < requests[r].first.size(); ++i)
+    {
+      std::vector<ReductionType> const & reduction = integrals[requests[r].first[i]].reduction;
+      for(unsigned int c = 0; c < reduction.size(); ++c)
+      {
+        unsigned int & position =
+          (reduction[c] == ReductionType::Sum) ? position_sum : position_max;
+
+        buffer[position] = local_values[offsets[r][i] + c];
+        pending_positions[r].push_back(position);
+        ++position;
+      }
+    }
+
+  MPI_Type_contiguous(buffer.size(), MPI_DOUBLE, &mpi_datatype);
+  MPI_Type_commit(&mpi_datatype);
+
+  MPI_Iallreduce(MPI_IN_PLACE, buffer.data(), 1, mpi_datatype, mpi_op, mpi_comm, &mpi_request);
+
+  reduction_pending = true;
+
+  pending_requests.swap(requests);
+  requests.clear();
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::finish()
+{
+  if(not reduction_pending)
+    return;
+
+  MPI_Wait(&mpi_request, MPI_STATUS_IGNORE);
+  MPI_Type_free(&mpi_datatype);
+
+  reduction_pending = false;
+
+  for(unsigned int r = 0; r < pending_requests.size(); ++r)
+  {
+    std::vector<double> values(pending_positions[r].size());
+    for(unsigned int i = 0; i < values.size(); ++i)
+      values[i] = buffer[pending_positions[r][i]];
+
+    pending_requests[r].second(values);
+  }
+
+  pending_requests.clear();
+  pending_positions.clear();
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::reduce_batch(std::vector<Number> &  dst,
+                                             ActiveIntegral const & active,
+                                             scalar const *         values,
+                                             unsigned int const     n_active_entries) const
+{
+  std::vector<ReductionType> const & reduction = integrals[active.index].reduction;
+
+  // only the entries of the dealii::VectorizedArray that are "active" are considered
+  for(unsigned int c = 0; c < reduction.size(); ++c)
+  {
+    Number & result = dst[active.offset + c];
+    for(unsigned int v = 0; v < n_active_entries; ++v)
+    {
+      if(reduction[c] == ReductionType::Sum)
+        result += values[c][v];
+      else
+        result = std::max(result, values[c][v]);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                                          std::vector<Number> &                         dst,
+                                          VectorType const &                            src,
+                                          std::pair<unsigned int, unsigned int> const & range) const
+{
+  if(active_cell_integrals.empty())
+    return;
+
+  CellIntegratorU integrator(matrix_free, dof_index_velocity, quad_index);
+
+  std::vector<scalar> values;
+
+  for(unsigned int cell = range.first; cell < range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(src);
+    integrator.evaluate(cell_flags);
+
+    for(auto const & active : active_cell_integrals)
+    {
+      Integral const & integral = integrals[active.index];
+
+      values.assign(integral.reduction.size(), dealii::make_vectorized_array<Number>(0.));
+      integral.cell_integrand(integrator, values.data());
+
+      reduce_batch(dst, active, values.data(), matrix_free.n_active_entries_per_cell_batch(cell));
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                                          std::vector<Number> &                         dst,
+                                          VectorType const &                            src,
+                                          std::pair<unsigned int, unsigned int> const & range) const
+{
+  if(active_face_integrals.empty())
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorU integrator_p(matrix_free, false, dof_index_velocity, quad_index);
+
+  std::vector<scalar> values;
+
+  for(unsigned int face = range.first; face < range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(src);
+    integrator_m.evaluate(face_flags);
+
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(src);
+    integrator_p.evaluate(face_flags);
+
+    for(auto const & active : active_face_integrals)
+    {
+      Integral const & integral = integrals[active.index];
+
+      values.assign(integral.reduction.size(), dealii::make_vectorized_array<Number>(0.));
+      integral.face_integrand(integrator_m, integrator_p, values.data());
+
+      reduce_batch(dst, active, values.data(), matrix_free.n_active_entries_per_face_batch(face));
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralScheduler<dim, Number>::boundary_face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & range) const
+{
+  if(active_boundary_face_integrals.empty())
+    return;
+
+  FaceIntegratorU integrator_u(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorP integrator_p(matrix_free, true, dof_index_pressure, quad_index);
+
+  std::vector<scalar> values;
+
+  for(unsigned int face = range.first; face < range.second; ++face)
+  {
+    // all faces of a batch have the same boundary ID, so that faces not contributing to any of the
+    // requested integrals are skipped before reading and evaluating the solution
+    dealii::types::boundary_id const boundary_id = matrix_free.get_boundary_id(face);
+
+    bool face_is_relevant = false;
+    for(auto const & active : active_boundary_face_integrals)
+      if(integrals[active.index].boundary_ids.count(boundary_id) > 0)
+        face_is_relevant = true;
+
+    if(not face_is_relevant)
+      continue;
+
+    integrator_u.reinit(face);
+    integrator_u.read_dof_values(src);
+    integrator_u.evaluate(boundary_flags_velocity);
+
+    if(boundary_flags_pressure != dealii::EvaluationFlags::nothing)
+    {
+      integrator_p.reinit(face);
+      integrator_p.read_dof_values(*pressure);
+      integrator_p.evaluate(boundary_flags_pressure);
+    }
+
+    for(auto const & active : active_boundary_face_integrals)
+    {
+      Integral const & integral = integrals[active.index];
+
+      if(integral.boundary_ids.count(boundary_id) == 0)
+        continue;
+
+      values.assign(integral.reduction.size(), dealii::make_vectorized_array<Number>(0.));
+      integral.boundary_face_integrand(integrator_u, integrator_p, values.data());
+
+      reduce_batch(dst, active, values.data(), matrix_free.n_active_entries_per_face_batch(face));
+    }
+  }
+}
+
+template class IntegralScheduler<2, float>;
+template class IntegralScheduler<2, double>;
+
+template class IntegralScheduler<3, float>;
+template class IntegralScheduler<3, double>;
+
+} // namespace ExaDG
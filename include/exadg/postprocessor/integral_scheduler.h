@@ -0,0 +1,220 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_INTEGRAL_SCHEDULER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_INTEGRAL_SCHEDULER_H_
+
+// C/C++
+#include <functional>
+#include <set>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+enum class ReductionType
+{
+  Sum,
+  Max
+};
+
+/*
+ *  Evaluates integrals over cells, interior faces and boundary faces registered by different
+ *  postprocessing tools within a single matrix-free loop over velocity and pressure.
+ *
+ *  In each output step, the postprocessing tools request the integrals they need together with a
+ *  callback. start() evaluates all requested integrals at once and packs the results of all
+ *  requests into a single non-blocking MPI reduction. This reduction is completed by finish(),
+ *  which is called at the beginning of the next output step, i.e., the latency of the reduction is
+ *  hidden behind the next time step. finish() then passes the globally reduced values to the
+ *  callbacks, which typically write the results to file. After the last output step, finish() has
+ *  to be called explicitly on all processes, otherwise the results of this step are lost.
+ */
+template<int dim, typename Number>
+class IntegralScheduler
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
+  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
+
+  // the integrands add the contributions of one batch of cells/faces to values, one entry of the
+  // dealii::VectorizedArray per cell/face of the batch
+  typedef std::function<void(CellIntegratorU &, scalar * values)> CellIntegrand;
+
+  typedef std::function<void(FaceIntegratorU &, FaceIntegratorU &, scalar * values)>
+    FaceIntegrand;
+
+  typedef std::function<void(FaceIntegratorU &, FaceIntegratorP &, scalar * values)>
+    BoundaryFaceIntegrand;
+
+  // receives the values of all integrals of a request after the reduction over all processes
+  typedef std::function<void(std::vector<double> const & values)> Callback;
+
+  IntegralScheduler(MPI_Comm const & comm);
+
+  ~IntegralScheduler();
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index_velocity_in,
+        unsigned int const                      dof_index_pressure_in,
+        unsigned int const                      quad_index_in);
+
+  /*
+   * The functions below register an integral with one value per entry of the vector reduction and
+   * return the index of the integral to be used in request().
+   */
+  unsigned int
+  add_cell_integral(std::vector<ReductionType> const &             reduction,
+                    dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+                    CellIntegrand const &                          integrand);
+
+  unsigned int
+  add_face_integral(std::vector<ReductionType> const &             reduction,
+                    dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+                    FaceIntegrand const &                          integrand);
+
+  unsigned int
+  add_boundary_face_integral(std::set<dealii::types::boundary_id> const &   boundary_ids,
+                             std::vector<ReductionType> const &             reduction,
+                             dealii::EvaluationFlags::EvaluationFlags const flags_velocity,
+                             dealii::EvaluationFlags::EvaluationFlags const flags_pressure,
+                             BoundaryFaceIntegrand const &                  integrand);
+
+  /*
+   * Requests the evaluation of the integrals with the given indices in the next call to start().
+   * The callback is called with the values of all these integrals (in the given order) once the
+   * reduction over all processes has been completed.
+   */
+  void
+  request(std::vector<unsigned int> const & indices, Callback const & callback);
+
+  /*
+   * Evaluates all requested integrals in one loop and starts the reduction over all processes.
+   * Completes a pending reduction first.
+   */
+  void
+  start(VectorType const & velocity, VectorType const & pressure);
+
+  /*
+   * Completes the pending reduction (if any) and invokes the callbacks of the requests.
+   */
+  void
+  finish();
+
+private:
+  struct Integral
+  {
+    std::vector<ReductionType> reduction;
+
+    dealii::EvaluationFlags::EvaluationFlags flags_velocity;
+    dealii::EvaluationFlags::EvaluationFlags flags_pressure;
+
+    // exactly one of the integrands is set
+    CellIntegrand         cell_integrand;
+    FaceIntegrand         face_integrand;
+    BoundaryFaceIntegrand boundary_face_integrand;
+
+    std::set<dealii::types::boundary_id> boundary_ids;
+  };
+
+  // an integral requested in the current output step and the position of its first value in the
+  // local result vector
+  struct ActiveIntegral
+  {
+    unsigned int index;
+    unsigned int offset;
+  };
+
+  unsigned int
+  add_integral(Integral const & integral);
+
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & cell_range) const;
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                     std::vector<Number> &                         dst,
+                     VectorType const &                            src,
+                     std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  // adds the active entries of the batch values to dst according to the reduction type
+  void
+  reduce_batch(std::vector<Number> &  dst,
+               ActiveIntegral const & active,
+               scalar const *         values,
+               unsigned int const     n_active_entries) const;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_velocity, dof_index_pressure, quad_index;
+
+  std::vector<Integral> integrals;
+
+  // requests of the current output step
+  std::vector<std::pair<std::vector<unsigned int>, Callback>> requests;
+
+  // integrals evaluated in the current loop
+  std::vector<ActiveIntegral> active_cell_integrals, active_face_integrals,
+    active_boundary_face_integrals;
+
+  dealii::EvaluationFlags::EvaluationFlags cell_flags, face_flags, boundary_flags_velocity,
+    boundary_flags_pressure;
+
+  VectorType const * pressure;
+
+  // pending reduction: requests, positions of the values of each request in the reduction buffer,
+  // and the buffer itself
+  std::vector<std::pair<std::vector<unsigned int>, Callback>> pending_requests;
+  std::vector<std::vector<unsigned int>>                      pending_positions;
+  std::vector<double>                                         buffer;
+
+  bool         reduction_pending;
+  MPI_Request  mpi_request;
+  MPI_Datatype mpi_datatype;
+  MPI_Op       mpi_op;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_INTEGRAL_SCHEDULER_H_ */
@@ -30,16 +30,23 @@ namespace ExaDG
 {
 template<int dim, typename Number>
 KineticEnergyCalculator<dim, Number>::KineticEnergyCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true), matrix_free(nullptr), dof_index(0), quad_index(0)
+  : mpi_comm(comm),
+    clear_files(true),
+    matrix_free(nullptr),
+    dof_index(0),
+    quad_index(0),
+    integral_index(0)
 {
 }
 
 template<int dim, typename Number>
 void
-KineticEnergyCalculator<dim, Number>::setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-                                            unsigned int const                      dof_index_in,
-                                            unsigned int const                      quad_index_in,
-                                            KineticEnergyData const & kinetic_energy_data_in)
+KineticEnergyCalculator<dim, Number>::setup(
+  dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+  unsigned int const                                    dof_index_in,
+  unsigned int const                                    quad_index_in,
+  KineticEnergyData const &                             kinetic_energy_data_in,
+  std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in)
 {
   matrix_free = &matrix_free_in;
   dof_index   = dof_index_in;
@@ -50,6 +57,21 @@ KineticEnergyCalculator<dim, Number>::setup(dealii::MatrixFree<dim, Number> cons
 
   if(data.calculate)
     create_directories(data.directory, mpi_comm);
+
+  if(integral_scheduler_in and data.calculate)
+  {
+    integral_scheduler = integral_scheduler_in;
+
+    std::vector<ReductionType> reduction(4, ReductionType::Sum);
+    reduction.push_back(ReductionType::Max);
+
+    integral_index = integral_scheduler->add_cell_integral(
+      reduction,
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients,
+      [this](CellIntegrator<dim, dim, Number> & integrator, scalar * values) {
+        integrate_cell_batch(integrator, values);
+      });
+  }
 }
 
 template<int dim, typename Number>
@@ -79,46 +101,70 @@ KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocit
 {
   if((time_step_number - 1) % data.calculate_every_time_steps == 0)
   {
-    Number kinetic_energy = 0.0, enstrophy = 0.0, dissipation = 0.0, max_vorticity = 0.0;
+    if(integral_scheduler)
+    {
+      integral_scheduler->request(
+        {integral_index}, [this, time](std::vector<double> const & values) {
+          // values: volume, energy, enstrophy, dissipation, max_vorticity
+          double const volume = values[0];
+          write_results(
+            time, values[1] / volume, values[2] / volume, values[3] / volume, values[4]);
+        });
+    }
+    else
+    {
+      Number kinetic_energy = 0.0, enstrophy = 0.0, dissipation = 0.0, max_vorticity = 0.0;
+
+      integrate(*matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
+
+      write_results(time, kinetic_energy, enstrophy, dissipation, max_vorticity);
+    }
+  }
+}
 
-    integrate(*matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::write_results(double const time,
+                                                    Number const kinetic_energy,
+                                                    Number const enstrophy,
+                                                    Number const dissipation,
+                                                    Number const max_vorticity)
+{
+  // write output file
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    // clang-format off
+    std::ostringstream filename;
+    filename << data.directory + data.filename;
 
-    // write output file
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    std::ofstream f;
+    if(clear_files == true)
     {
-      // clang-format off
-      std::ostringstream filename;
-      filename << data.directory + data.filename;
-
-      std::ofstream f;
-      if(clear_files == true)
-      {
-        f.open(filename.str().c_str(), std::ios::trunc);
-        f << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
-          << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl;
-
-        f << std::endl
-          << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity"
-          << std::endl;
-
-        clear_files = false;
-      }
-      else
-      {
-        f.open(filename.str().c_str(), std::ios::app);
-      }
-
-      unsigned int precision = 12;
-      f << std::scientific << std::setprecision(precision)
-        << std::setw(precision + 8) << time
-        << std::setw(precision + 8) << kinetic_energy
-        << std::setw(precision + 8) << dissipation
-        << std::setw(precision + 8) << enstrophy
-        << std::setw(precision + 8) << max_vorticity
+      f.open(filename.str().c_str(), std::ios::trunc);
+      f << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
+        << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
+        << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl;
+
+      f << std::endl
+        << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity"
         << std::endl;
-      // clang-format on
+
+      clear_files = false;
     }
+    else
+    {
+      f.open(filename.str().c_str(), std::ios::app);
+    }
+
+    unsigned int precision = 12;
+    f << std::scientific << std::setprecision(precision)
+      << std::setw(precision + 8) << time
+      << std::setw(precision + 8) << kinetic_energy
+      << std::setw(precision + 8) << dissipation
+      << std::setw(precision + 8) << enstrophy
+      << std::setw(precision + 8) << max_vorticity
+      << std::endl;
+    // clang-format on
   }
 }
 
@@ -173,44 +219,22 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
     fe_eval.read_dof_values(src);
     fe_eval.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
-    scalar volume_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar energy_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar enstrophy_vec     = dealii::make_vectorized_array<Number>(0.);
-    scalar dissipation_vec   = dealii::make_vectorized_array<Number>(0.);
-    scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar values[5];
+    for(unsigned int i = 0; i < 5; ++i)
+      values[i] = dealii::make_vectorized_array<Number>(0.);
 
-    for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
-    {
-      volume_vec += fe_eval.JxW(q);
-
-      vector velocity = fe_eval.get_value(q);
-      energy_vec +=
-        fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
-
-      tensor velocity_gradient = fe_eval.get_gradient(q);
-      dissipation_vec += fe_eval.JxW(q) *
-                         dealii::make_vectorized_array<Number>(this->data.viscosity) *
-                         scalar_product(velocity_gradient, velocity_gradient);
-
-      dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
-
-      scalar norm_omega = omega * omega;
-
-      enstrophy_vec += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
-
-      max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
-    }
+    integrate_cell_batch(fe_eval, values);
 
     // sum over entries of dealii::VectorizedArray, but only over those
     // that are "active"
     for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
     {
-      volume += volume_vec[v];
-      energy += energy_vec[v];
-      enstrophy += enstrophy_vec[v];
-      dissipation += dissipation_vec[v];
+      volume += values[0][v];
+      energy += values[1][v];
+      enstrophy += values[2][v];
+      dissipation += values[3][v];
 
-      max_vorticity = std::max(max_vorticity, max_vorticity_vec[v]);
+      max_vorticity = std::max(max_vorticity, values[4][v]);
     }
   }
 
@@ -221,6 +245,33 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
   dst.at(4) = std::max(dst.at(4), max_vorticity);
 }
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::integrate_cell_batch(
+  CellIntegrator<dim, dim, Number> & fe_eval,
+  scalar *                           values) const
+{
+  for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
+  {
+    values[0] += fe_eval.JxW(q);
+
+    vector velocity = fe_eval.get_value(q);
+    values[1] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
+
+    tensor velocity_gradient = fe_eval.get_gradient(q);
+    values[3] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(this->data.viscosity) *
+                 scalar_product(velocity_gradient, velocity_gradient);
+
+    dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
+
+    scalar norm_omega = omega * omega;
+
+    values[2] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
+
+    values[4] = std::max(values[4], std::sqrt(norm_omega));
+  }
+}
+
 template class KineticEnergyCalculator<2, float>;
 template class KineticEnergyCalculator<2, double>;
 
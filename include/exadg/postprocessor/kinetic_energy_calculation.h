@@ -28,6 +28,7 @@
 // ExaDG
 #include <exadg/incompressible_navier_stokes/spatial_discretization/curl_compute.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/integral_scheduler.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -94,11 +95,17 @@ public:
 
   KineticEnergyCalculator(MPI_Comm const & comm);
 
+  /*
+   * If an integral scheduler is provided, the basic quantities are evaluated together with the
+   * other integrals of the scheduler, and the results are written once the reduction of the
+   * scheduler has been completed.
+   */
   void
-  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-        unsigned int const                      dof_index_in,
-        unsigned int const                      quad_index_in,
-        KineticEnergyData const &               kinetic_energy_data_in);
+  setup(dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+        unsigned int const                                    dof_index_in,
+        unsigned int const                                    quad_index_in,
+        KineticEnergyData const &                             kinetic_energy_data_in,
+        std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in = nullptr);
 
   void
   evaluate(VectorType const & velocity, double const & time, int const & time_step_number);
@@ -138,6 +145,20 @@ protected:
             VectorType const &                            src,
             std::pair<unsigned int, unsigned int> const & cell_range);
 
+  /*
+   *  Contributions of one batch of cells to volume, energy, enstrophy, dissipation (sums), and
+   *  maximum vorticity (maximum), in this order.
+   */
+  void
+  integrate_cell_batch(CellIntegrator<dim, dim, Number> & fe_eval, scalar * values) const;
+
+  void
+  write_results(double const time,
+                Number const kinetic_energy,
+                Number const enstrophy,
+                Number const dissipation,
+                Number const max_vorticity);
+
   MPI_Comm const mpi_comm;
 
   bool clear_files;
@@ -145,6 +166,9 @@ protected:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   KineticEnergyData                       data;
+
+  std::shared_ptr<IntegralScheduler<dim, Number>> integral_scheduler;
+  unsigned int                                    integral_index;
 };
 
 } // namespace ExaDG
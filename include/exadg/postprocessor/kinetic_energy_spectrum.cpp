@@ -58,12 +58,25 @@ public:
   /**
    * Constructor
    *
-   * @param write     flush simulation data to hard drive for later post processing
-   * @param inplace   create energy spectrum at run time
+   * @param write           flush simulation data to hard drive for later post processing
+   * @param inplace         create energy spectrum at run time
+   * @param planner_effort  planner effort of the (persistent) FFTW plan
+   * @param wisdom_file     file for FFTW wisdom (ignored if empty)
    *
    */
-  DealSpectrumWrapper(MPI_Comm const & comm, bool write, bool inplace)
-    : comm(comm), write(write), inplace(inplace), s(comm), ipol(comm, s), fftw(comm, s)
+  DealSpectrumWrapper(MPI_Comm const &        comm,
+                      bool                    write,
+                      bool                    inplace,
+                      FFTWPlannerEffort const planner_effort = FFTWPlannerEffort::Estimate,
+                      std::string const &     wisdom_file    = "")
+    : comm(comm),
+      write(write),
+      inplace(inplace),
+      planner_effort(planner_effort),
+      wisdom_file(wisdom_file),
+      s(comm),
+      ipol(comm, s),
+      fftw(comm, s)
   {
   }
 
@@ -130,6 +143,11 @@ public:
     fftw.init();
     timer.stop("Init-FFTW");
 
+    // ... fftw plan (before the input array is filled since planning might overwrite it)
+    timer.start("Plan-FFTW");
+    fftw.create_plan(get_planner_flags(), wisdom_file);
+    timer.stop("Plan-FFTW");
+
     int start_;
     int end_;
     fftw.getLocalRange(start_, end_);
@@ -155,14 +173,12 @@ public:
     dealii::types::global_dof_index N  = s.cells * s.points_dst;
     dealii::types::global_dof_index Nx = (N / 2 + 1) * 2;
 
-    for(dealii::types::global_dof_index d = 0;
-        d < static_cast<dealii::types::global_dof_index>(s.dim);
-        d++)
-    {
-      dealii::types::global_dof_index c = 0;
-      for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
-        for(dealii::types::global_dof_index j = 0; j < N; j++)
-          for(dealii::types::global_dof_index i = 0; i < Nx; i++, c++)
+    // the velocity components are interleaved as required by the batched FFT
+    dealii::types::global_dof_index c = 0;
+    for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
+      for(dealii::types::global_dof_index j = 0; j < N; j++)
+        for(dealii::types::global_dof_index i = 0; i < Nx; i++)
+          for(dealii::types::global_dof_index d = 0; d < dim; d++, c++)
             if(i < N)
               indices_want.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) +
                                      (k + start) *
@@ -171,9 +187,8 @@ public:
             else
               indices_want.push_back(dealii::numbers::invalid_dof_index); // x-padding
 
-      for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
-        indices_want.push_back(dealii::numbers::invalid_dof_index); // z-padding
-    }
+    for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
+      indices_want.push_back(dealii::numbers::invalid_dof_index); // z-padding
 
     nonconti = std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(indices_has,
                                                                                   indices_want,
@@ -213,7 +228,7 @@ public:
         dealii::Utilities::pow(static_cast<dealii::types::global_dof_index>(s.cells * s.points_dst),
                                s.dim) *
         s.dim;
-      dealii::ArrayView<double>       dst(fftw.u_real, size * 2);
+      dealii::ArrayView<double>       dst(fftw.u_real, fftw.bsize);
       dealii::ArrayView<double const> src_(ipol.dst, size);
       nonconti->export_to_ghosted_array(src_, dst);
 
@@ -255,6 +270,21 @@ public:
   }
 
 private:
+  unsigned int
+  get_planner_flags() const
+  {
+    if(planner_effort == FFTWPlannerEffort::Estimate)
+      return FFTW_ESTIMATE;
+    else if(planner_effort == FFTWPlannerEffort::Measure)
+      return FFTW_MEASURE;
+    else if(planner_effort == FFTWPlannerEffort::Patient)
+      return FFTW_PATIENT;
+    else
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+
+    return FFTW_ESTIMATE;
+  }
+
   template<int dim>
   std::size_t
   norm_point_to_lex(dealii::Point<dim> const & c, unsigned int const & n_cells_1D)
@@ -279,6 +309,10 @@ private:
   // perform spectral analysis
   bool const inplace;
 
+  // FFTW planning
+  FFTWPlannerEffort const planner_effort;
+  std::string const       wisdom_file;
+
   // struct containing the setup
   Setup s;
 
@@ -300,7 +334,11 @@ namespace ExaDG
 class DealSpectrumWrapper
 {
 public:
-  DealSpectrumWrapper(MPI_Comm const &, bool, bool)
+  DealSpectrumWrapper(MPI_Comm const &,
+                      bool,
+                      bool,
+                      FFTWPlannerEffort const = FFTWPlannerEffort::Estimate,
+                      std::string const &     = "")
   {
   }
 
@@ -362,7 +400,11 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
     if(deal_spectrum_wrapper == nullptr)
     {
       deal_spectrum_wrapper =
-        std::make_shared<DealSpectrumWrapper>(mpi_comm, data.write_raw_data_to_files, data.do_fftw);
+        std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                              data.write_raw_data_to_files,
+                                              data.do_fftw,
+                                              data.fftw_planner_effort,
+                                              data.fftw_wisdom_file);
     }
 
     unsigned int evaluation_points = std::max(data.degree + 1, data.evaluation_points_per_cell);
@@ -35,12 +35,43 @@ namespace ExaDG
 // forward declaration
 class DealSpectrumWrapper;
 
+/*
+ * Planner effort used for the FFTW plan. The plan is created once, so that a more expensive
+ * planning (Measure, Patient) pays off if the spectrum is evaluated many times.
+ */
+enum class FFTWPlannerEffort
+{
+  Estimate,
+  Measure,
+  Patient
+};
+
+inline std::string
+enum_to_string(FFTWPlannerEffort const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    // clang-format off
+    case FFTWPlannerEffort::Estimate: string_type = "Estimate"; break;
+    case FFTWPlannerEffort::Measure:  string_type = "Measure";  break;
+    case FFTWPlannerEffort::Patient:  string_type = "Patient";  break;
+    default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
+      // clang-format on
+  }
+
+  return string_type;
+}
+
 struct KineticEnergySpectrumData
 {
   KineticEnergySpectrumData()
     : calculate(false),
       write_raw_data_to_files(false),
       do_fftw(true),
+      fftw_planner_effort(FFTWPlannerEffort::Estimate),
+      fftw_wisdom_file(""),
       start_time(0.0),
       calculate_every_time_steps(-1),
       calculate_every_time_interval(-1.0),
@@ -64,6 +95,12 @@ struct KineticEnergySpectrumData
       pcout << std::endl << "  Calculate kinetic energy spectrum:" << std::endl;
       print_parameter(pcout, "Write raw data to files", write_raw_data_to_files);
       print_parameter(pcout, "Do FFTW", do_fftw);
+      if(do_fftw)
+      {
+        print_parameter(pcout, "FFTW planner effort", enum_to_string(fftw_planner_effort));
+        if(not fftw_wisdom_file.empty())
+          print_parameter(pcout, "FFTW wisdom file", fftw_wisdom_file);
+      }
       print_parameter(pcout, "Start time", start_time);
       if(calculate_every_time_steps >= 0)
         print_parameter(pcout, "Calculate every timesteps", calculate_every_time_steps);
@@ -88,6 +125,12 @@ struct KineticEnergySpectrumData
   bool   calculate;
   bool   write_raw_data_to_files;
   bool   do_fftw;
+
+  // FFTW planning (only relevant if do_fftw = true). Wisdom is imported from and exported to
+  // fftw_wisdom_file if a file name is given.
+  FFTWPlannerEffort fftw_planner_effort;
+  std::string       fftw_wisdom_file;
+
   double start_time;
   int    calculate_every_time_steps;
   double calculate_every_time_interval;
@@ -29,6 +29,37 @@
 
 namespace ExaDG
 {
+/*
+ *  Integrates the force exerted by the fluid, tau = p n - nu (grad(u) + grad(u)^T) n, over one
+ *  batch of boundary faces. The integrators have to be evaluated before. The integrators are not
+ *  modified, since they might be shared with other integrands.
+ */
+template<int dim, typename Number>
+dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+integrate_surface_force(FaceIntegrator<dim, dim, Number> const & integrator_velocity,
+                        FaceIntegrator<dim, 1, Number> const &   integrator_pressure,
+                        double const                             viscosity)
+{
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> force;
+
+  for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
+  {
+    dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
+
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
+      integrator_velocity.get_normal_vector(q);
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
+      integrator_velocity.get_gradient(q);
+
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
+      pressure * normal - viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
+
+    force += tau * integrator_velocity.JxW(q);
+  }
+
+  return force;
+}
+
 template<int dim, typename Number>
 void
   calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force,
@@ -71,24 +102,8 @@ void
     typename std::set<dealii::types::boundary_id>::iterator it = boundary_IDs.find(boundary_id);
     if(it != boundary_IDs.end())
     {
-      for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
-      {
-        dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
-
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
-          integrator_velocity.get_normal_vector(q);
-        dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
-          integrator_velocity.get_gradient(q);
-
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
-          pressure * normal -
-          viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
-
-        integrator_velocity.submit_value(tau, q);
-      }
-
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> Force_local =
-        integrator_velocity.integrate_value();
+        integrate_surface_force(integrator_velocity, integrator_pressure, viscosity);
 
       // sum over all entries of dealii::VectorizedArray
       for(unsigned int d = 0; d < dim; ++d)
@@ -112,18 +127,21 @@ LiftAndDragCalculator<dim, Number>::LiftAndDragCalculator(MPI_Comm const & comm)
     c_L_min(std::numeric_limits<double>::max()),
     c_L_max(-std::numeric_limits<double>::max()),
     c_D_min(std::numeric_limits<double>::max()),
-    c_D_max(-std::numeric_limits<double>::max())
+    c_D_max(-std::numeric_limits<double>::max()),
+    integral_index(0)
 {
 }
 
 template<int dim, typename Number>
 void
-LiftAndDragCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
-                                          dealii::MatrixFree<dim, Number> const & matrix_free_in,
-                                          unsigned int const      dof_index_velocity_in,
-                                          unsigned int const      dof_index_pressure_in,
-                                          unsigned int const      quad_index_in,
-                                          LiftAndDragData const & data_in)
+LiftAndDragCalculator<dim, Number>::setup(
+  dealii::DoFHandler<dim> const &                       dof_handler_velocity_in,
+  dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+  unsigned int const                                    dof_index_velocity_in,
+  unsigned int const                                    dof_index_pressure_in,
+  unsigned int const                                    quad_index_in,
+  LiftAndDragData const &                               data_in,
+  std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in)
 {
   dof_handler_velocity = &dof_handler_velocity_in;
   matrix_free          = &matrix_free_in;
@@ -134,6 +152,26 @@ LiftAndDragCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_ha
 
   if(data.calculate)
     create_directories(data.directory, mpi_comm);
+
+  if(integral_scheduler_in and data.calculate)
+  {
+    integral_scheduler = integral_scheduler_in;
+
+    double const viscosity = data.viscosity;
+
+    integral_index = integral_scheduler->add_boundary_face_integral(
+      data.boundary_IDs,
+      std::vector<ReductionType>(dim, ReductionType::Sum),
+      dealii::EvaluationFlags::gradients,
+      dealii::EvaluationFlags::values,
+      [viscosity](auto & integrator_velocity, auto & integrator_pressure, auto * values) {
+        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const Force_local =
+          integrate_surface_force(integrator_velocity, integrator_pressure, viscosity);
+
+        for(unsigned int d = 0; d < dim; ++d)
+          values[d] += Force_local[d];
+      });
+  }
 }
 
 template<int dim, typename Number>
@@ -144,85 +182,107 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
 {
   if(data.calculate)
   {
-    dealii::Tensor<1, dim, Number> Force;
-
-    calculate_lift_and_drag_force<dim, Number>(Force,
-                                               *matrix_free,
-                                               dof_index_velocity,
-                                               quad_index,
-                                               dof_index_pressure,
-                                               data.boundary_IDs,
-                                               velocity,
-                                               pressure,
-                                               data.viscosity,
-                                               mpi_comm);
-
-    // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
-    double const reference_value = data.reference_value;
-    Force /= reference_value;
-
-    double const drag = Force[0], lift = Force[1];
-    c_D_min = std::min(c_D_min, drag);
-    c_D_max = std::max(c_D_max, drag);
-    c_L_min = std::min(c_L_min, lift);
-    c_L_max = std::max(c_L_max, lift);
-
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    if(integral_scheduler)
+    {
+      integral_scheduler->request(
+        {integral_index}, [this, time](std::vector<double> const & values) {
+          dealii::Tensor<1, dim, Number> Force;
+          for(unsigned int d = 0; d < dim; ++d)
+            Force[d] = values[d];
+
+          write_results(Force, time);
+        });
+    }
+    else
     {
-      std::string filename_drag, filename_lift;
-      filename_drag = data.directory + data.filename_drag;
-      filename_lift = data.directory + data.filename_lift;
+      dealii::Tensor<1, dim, Number> Force;
+
+      calculate_lift_and_drag_force<dim, Number>(Force,
+                                                 *matrix_free,
+                                                 dof_index_velocity,
+                                                 quad_index,
+                                                 dof_index_pressure,
+                                                 data.boundary_IDs,
+                                                 velocity,
+                                                 pressure,
+                                                 data.viscosity,
+                                                 mpi_comm);
+
+      write_results(Force, time);
+    }
+  }
+}
 
-      unsigned int precision = 12;
+template<int dim, typename Number>
+void
+LiftAndDragCalculator<dim, Number>::write_results(dealii::Tensor<1, dim, Number> Force,
+                                                  double const                   time) const
+{
+  // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
+  double const reference_value = data.reference_value;
+  Force /= reference_value;
 
-      std::ofstream f_drag, f_lift;
-      if(clear_files)
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::trunc);
-        f_lift.open(filename_lift.c_str(), std::ios::trunc);
-
-        // clang-format off
-        f_drag << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_D(t)"
-               << std::setw(precision+8) << std::left << "c_D_min"
-               << std::setw(precision+8) << std::left << "c_D_max"
-               << std::endl;
-
-        f_lift << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_L(t)"
-               << std::setw(precision+8) << std::left << "c_L_min"
-               << std::setw(precision+8) << std::left << "c_L_max"
-               << std::endl;
-        // clang-format on
-
-        clear_files = false;
-      }
-      else
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::app);
-        f_lift.open(filename_lift.c_str(), std::ios::app);
-      }
+  double const drag = Force[0], lift = Force[1];
+  c_D_min = std::min(c_D_min, drag);
+  c_D_max = std::max(c_D_max, drag);
+  c_L_min = std::min(c_L_min, lift);
+  c_L_max = std::max(c_L_max, lift);
 
-      // clang-format off
-      f_drag << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << drag
-             << std::setw(precision+8) << std::left << c_D_min
-             << std::setw(precision+8) << std::left << c_D_max
-             << std::endl;
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::string filename_drag, filename_lift;
+    filename_drag = data.directory + data.filename_drag;
+    filename_lift = data.directory + data.filename_lift;
 
-      f_drag.close();
+    unsigned int precision = 12;
 
-      f_lift << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << lift
-             << std::setw(precision+8) << std::left << c_L_min
-             << std::setw(precision+8) << std::left << c_L_max
+    std::ofstream f_drag, f_lift;
+    if(clear_files)
+    {
+      f_drag.open(filename_drag.c_str(), std::ios::trunc);
+      f_lift.open(filename_lift.c_str(), std::ios::trunc);
+
+      // clang-format off
+      f_drag << std::setw(precision+8) << std::left << "time_t"
+             << std::setw(precision+8) << std::left << "c_D(t)"
+             << std::setw(precision+8) << std::left << "c_D_min"
+             << std::setw(precision+8) << std::left << "c_D_max"
              << std::endl;
 
-      f_lift.close();
+      f_lift << std::setw(precision+8) << std::left << "time_t"
+             << std::setw(precision+8) << std::left << "c_L(t)"
+             << std::setw(precision+8) << std::left << "c_L_min"
+             << std::setw(precision+8) << std::left << "c_L_max"
+             << std::endl;
       // clang-format on
+
+      clear_files = false;
     }
+    else
+    {
+      f_drag.open(filename_drag.c_str(), std::ios::app);
+      f_lift.open(filename_lift.c_str(), std::ios::app);
+    }
+
+    // clang-format off
+    f_drag << std::scientific << std::setprecision(precision)
+           << std::setw(precision+8) << std::left << time
+           << std::setw(precision+8) << std::left << drag
+           << std::setw(precision+8) << std::left << c_D_min
+           << std::setw(precision+8) << std::left << c_D_max
+           << std::endl;
+
+    f_drag.close();
+
+    f_lift << std::scientific << std::setprecision(precision)
+           << std::setw(precision+8) << std::left << time
+           << std::setw(precision+8) << std::left << lift
+           << std::setw(precision+8) << std::left << c_L_min
+           << std::setw(precision+8) << std::left << c_L_max
+           << std::endl;
+
+    f_lift.close();
+    // clang-format on
   }
 }
 
@@ -24,6 +24,9 @@
 
 #include <deal.II/matrix_free/matrix_free.h>
 
+// ExaDG
+#include <exadg/postprocessor/integral_scheduler.h>
+
 namespace ExaDG
 {
 struct LiftAndDragData
@@ -76,18 +79,27 @@ public:
 
   LiftAndDragCalculator(MPI_Comm const & comm);
 
+  /*
+   * If an integral scheduler is provided, the forces are evaluated together with the other
+   * integrals of the scheduler, and the results are written once the reduction of the scheduler has
+   * been completed.
+   */
   void
-  setup(dealii::DoFHandler<dim> const &         dof_handler_velocity_in,
-        dealii::MatrixFree<dim, Number> const & matrix_free_in,
-        unsigned int const                      dof_index_velocity_in,
-        unsigned int const                      dof_index_pressure_in,
-        unsigned int const                      quad_index_in,
-        LiftAndDragData const &                 lift_and_drag_data_in);
+  setup(dealii::DoFHandler<dim> const &                       dof_handler_velocity_in,
+        dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+        unsigned int const                                    dof_index_velocity_in,
+        unsigned int const                                    dof_index_pressure_in,
+        unsigned int const                                    quad_index_in,
+        LiftAndDragData const &                               lift_and_drag_data_in,
+        std::shared_ptr<IntegralScheduler<dim, Number>> const integral_scheduler_in = nullptr);
 
   void
   evaluate(VectorType const & velocity, VectorType const & pressure, Number const & time) const;
 
 private:
+  void
+  write_results(dealii::Tensor<1, dim, Number> Force, double const time) const;
+
   MPI_Comm const mpi_comm;
 
   mutable bool clear_files;
@@ -99,6 +111,9 @@ private:
   mutable double c_L_min, c_L_max, c_D_min, c_D_max;
 
   LiftAndDragData data;
+
+  std::shared_ptr<IntegralScheduler<dim, Number>> integral_scheduler;
+  unsigned int                                    integral_index;
 };
 
 } // namespace ExaDG
@@ -0,0 +1,175 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_POINT_EVALUATOR_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_POINT_EVALUATOR_H_
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/numerics/vector_tools_evaluate.h>
+
+namespace ExaDG
+{
+/*
+ *  Evaluates finite element fields in a fixed set of points (probes, points along lines, etc.).
+ *
+ *  Postprocessors register their points via add_points() and share one object of this class. The
+ *  points are located in the mesh only once by dealii::Utilities::MPI::RemotePointEvaluation, and
+ *  again only if the triangulation has changed (e.g. adaptive refinement, which is detected via
+ *  the signals of the triangulation) or if the mesh has been moved, which has to be announced by
+ *  calling invalidate(). A call to evaluate() returns the values of a field in all registered
+ *  points and requires a single round of communication.
+ *
+ *  The points are requested by the root process (rank 0) only, which is the process writing the
+ *  results of the postprocessors. The vector returned by evaluate() is empty on all other
+ *  processes.
+ */
+template<int dim>
+class PointEvaluator
+{
+public:
+  template<typename Number>
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  template<int n_components, typename Number>
+  using value_type = typename dealii::FEPointEvaluation<n_components, dim, dim, Number>::value_type;
+
+  PointEvaluator(MPI_Comm const & comm, double const tolerance = 1.e-10)
+    : mpi_comm(comm),
+      evaluator(tolerance, false, 0, []() { return std::vector<bool>(); }),
+      mapping(nullptr),
+      triangulation(nullptr),
+      needs_update(true)
+  {
+  }
+
+  /*
+   * Registers points to be evaluated and returns the index of the first of these points in the
+   * vector returned by evaluate(). All processes have to register the same points.
+   */
+  unsigned int
+  add_points(std::vector<dealii::Point<dim>> const & points_in)
+  {
+    unsigned int const offset = points.size();
+
+    points.insert(points.end(), points_in.begin(), points_in.end());
+
+    needs_update = true;
+
+    return offset;
+  }
+
+  void
+  reinit(dealii::Mapping<dim> const & mapping_in, dealii::Triangulation<dim> const & tria_in)
+  {
+    mapping       = &mapping_in;
+    triangulation = &tria_in;
+
+    needs_update = true;
+  }
+
+  /*
+   * Forces the points to be located again before the next evaluation, e.g. after mesh motion.
+   */
+  void
+  invalidate()
+  {
+    needs_update = true;
+  }
+
+  std::vector<dealii::Point<dim>> const &
+  get_points() const
+  {
+    return points;
+  }
+
+  template<int n_components, typename Number>
+  std::vector<value_type<n_components, Number>>
+  evaluate(dealii::DoFHandler<dim> const & dof_handler, VectorType<Number> const & vector)
+  {
+    AssertThrow(&dof_handler.get_triangulation() == triangulation,
+                dealii::ExcMessage("DoFHandler does not belong to the triangulation of the "
+                                   "PointEvaluator."));
+
+    if(needs_update or not evaluator.is_ready())
+      locate_points();
+
+    bool const has_ghost_elements = vector.has_ghost_elements();
+
+    if(not has_ghost_elements)
+      vector.update_ghost_values();
+
+    auto const values =
+      dealii::VectorTools::point_values<n_components>(evaluator,
+                                                      dof_handler,
+                                                      vector,
+                                                      dealii::VectorTools::EvaluationFlags::avg);
+
+    if(not has_ghost_elements)
+      vector.zero_out_ghost_values();
+
+    return values;
+  }
+
+private:
+  void
+  locate_points()
+  {
+    AssertThrow(mapping != nullptr and triangulation != nullptr,
+                dealii::ExcMessage("PointEvaluator has not been initialized. Call reinit()."));
+
+    bool const is_root = (dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+    evaluator.reinit(is_root ? points : std::vector<dealii::Point<dim>>(),
+                     *triangulation,
+                     *mapping);
+
+    unsigned int const all_points_found =
+      dealii::Utilities::MPI::min(evaluator.all_points_found() ? 1u : 0u, mpi_comm);
+
+    AssertThrow(all_points_found == 1,
+                dealii::ExcMessage("Not all points have been found by the PointEvaluator."));
+
+    needs_update = false;
+  }
+
+  MPI_Comm const mpi_comm;
+
+  std::vector<dealii::Point<dim>> points;
+
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> evaluator;
+
+  dealii::Mapping<dim> const *       mapping;
+  dealii::Triangulation<dim> const * triangulation;
+
+  bool needs_update;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_POINT_EVALUATOR_H_ */
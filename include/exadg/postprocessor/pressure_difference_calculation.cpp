@@ -25,29 +25,32 @@
 // ExaDG
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 #include <exadg/utilities/create_directories.h>
-#include <exadg/vector_tools/point_value.h>
 
 namespace ExaDG
 {
 template<int dim, typename Number>
 PressureDifferenceCalculator<dim, Number>::PressureDifferenceCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true)
+  : mpi_comm(comm), clear_files(true), index_point_1(0)
 {
 }
 
 template<int dim, typename Number>
 void
 PressureDifferenceCalculator<dim, Number>::setup(
-  dealii::DoFHandler<dim> const &     dof_handler_pressure_in,
-  dealii::Mapping<dim> const &        mapping_in,
-  PressureDifferenceData<dim> const & data_in)
+  dealii::DoFHandler<dim> const &      dof_handler_pressure_in,
+  std::shared_ptr<PointEvaluator<dim>> point_evaluator_in,
+  PressureDifferenceData<dim> const &  data_in)
 {
   dof_handler_pressure = &dof_handler_pressure_in;
-  mapping              = &mapping_in;
+  point_evaluator      = point_evaluator_in;
   data                 = data_in;
 
   if(data.calculate)
+  {
     create_directories(data.directory, mpi_comm);
+
+    index_point_1 = point_evaluator->add_points({data.point_1, data.point_2});
+  }
 }
 
 template<int dim, typename Number>
@@ -57,21 +60,14 @@ PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
 {
   if(data.calculate)
   {
-    Number pressure_1 = 0.0, pressure_2 = 0.0;
-
-    dealii::Point<dim> point_1, point_2;
-    point_1 = data.point_1;
-    point_2 = data.point_2;
-
-    evaluate_scalar_quantity_in_point(
-      pressure_1, *dof_handler_pressure, *mapping, pressure, point_1, mpi_comm);
-    evaluate_scalar_quantity_in_point(
-      pressure_2, *dof_handler_pressure, *mapping, pressure, point_2, mpi_comm);
-
-    Number const pressure_difference = pressure_1 - pressure_2;
+    // values are only available on the root process
+    auto const values =
+      point_evaluator->template evaluate<1, Number>(*dof_handler_pressure, pressure);
 
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
     {
+      Number const pressure_difference = values[index_point_1] - values[index_point_1 + 1];
+
       std::string filename = data.directory + data.filename;
 
       unsigned int precision = 12;
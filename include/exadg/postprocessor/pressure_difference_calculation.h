@@ -28,6 +28,9 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/postprocessor/point_evaluator.h>
+
 namespace ExaDG
 {
 template<int dim>
@@ -65,9 +68,9 @@ public:
   PressureDifferenceCalculator(MPI_Comm const & comm);
 
   void
-  setup(dealii::DoFHandler<dim> const &     dof_handler_pressure_in,
-        dealii::Mapping<dim> const &        mapping_in,
-        PressureDifferenceData<dim> const & pressure_difference_data_in);
+  setup(dealii::DoFHandler<dim> const &      dof_handler_pressure_in,
+        std::shared_ptr<PointEvaluator<dim>> point_evaluator_in,
+        PressureDifferenceData<dim> const &  pressure_difference_data_in);
 
   void
   evaluate(VectorType const & pressure, double const & time) const;
@@ -78,7 +81,12 @@ private:
   mutable bool clear_files;
 
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
-  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  // shared with other postprocessors evaluating quantities in points
+  std::shared_ptr<PointEvaluator<dim>> point_evaluator;
+
+  // index of point_1 in the points of the point evaluator (point_2 follows point_1)
+  unsigned int index_point_1;
 
   PressureDifferenceData<dim> data;
 };
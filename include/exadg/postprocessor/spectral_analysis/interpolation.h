@@ -31,6 +31,7 @@
 #include <deal.II/base/point.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/matrix_free/evaluation_kernels.h>
@@ -44,7 +45,8 @@ namespace dealspectrum
 {
 /**
  * Class which loops over all cells and performs interpolation of every velocity
- * component (without using Matrix-Free).
+ * component (without using Matrix-Free). The interpolation is done with sum
+ * factorization and is vectorized over velocity components and cells.
  */
 class Interpolator
 {
@@ -197,47 +199,78 @@ public:
   void
   interpolate(double const *& src)
   {
-    // allocate dst- and src-vector
-    dealii::AlignedVector<double> temp1(MAX(dofs_source, dofs_target));
-    dealii::AlignedVector<double> temp2(MAX(dofs_source, dofs_target));
+    if(DIM == 2)
+      do_interpolate<2>(src);
+    else if(DIM == 3)
+      do_interpolate<3>(src);
+    else
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
 
-    // get start point of arrays
-    double const * src_ = src;
-    double *       dst_ = dst;
-    // loop over all cells
-    for(int c = 0; c < cells; c++)
+  /**
+   * Sum-factorized interpolation of all fields, i.e., velocity components of
+   * all cells. Since the fields are independent and stored contiguously in the
+   * source vector, they are processed in batches of the SIMD width.
+   *
+   * @params src      source vector (vector to be interpolated)
+   */
+  template<int dim>
+  void
+  do_interpolate(double const * src)
+  {
+    typedef dealii::VectorizedArray<double> VectorizedArrayType;
+    unsigned int constexpr n_lanes = VectorizedArrayType::size();
+
+    dealii::internal::EvaluatorTensorProduct<dealii::internal::evaluate_general,
+                                             dim,
+                                             0,
+                                             0,
+                                             VectorizedArrayType,
+                                             double>
+      eval_val(shape_values, shape_values, shape_values, points_source, points_target);
+
+    dealii::AlignedVector<VectorizedArrayType> temp1(MAX(dofs_source, dofs_target));
+    dealii::AlignedVector<VectorizedArrayType> temp2(MAX(dofs_source, dofs_target));
+
+    unsigned int const n_fields = cells * DIM;
+
+    for(unsigned int field = 0; field < n_fields; field += n_lanes)
     {
-      // loop over all velocity directions
-      for(int d = 0; d < DIM; d++)
+      unsigned int const n_filled = std::min(n_lanes, n_fields - field);
+
+      // gather values of n_filled fields (unused lanes are zero)
+      for(int i = 0; i < dofs_source; ++i)
+      {
+        temp1[i] = 0.0;
+        for(unsigned int v = 0; v < n_filled; ++v)
+          temp1[i][v] = src[(field + v) * dofs_source + i];
+      }
+
+      // perform interpolation direction by direction, result is in temp1
+      if(dim == 2)
+      {
+        eval_val.template values<0, true, false>(temp1.begin(), temp2.begin());
+        eval_val.template values<1, true, false>(temp2.begin(), temp1.begin());
+      }
+      else
       {
-        // perform interpolation
-        if(DIM == 2)
-        {
-          // ... 2D
-          dealii::internal::
-            EvaluatorTensorProduct<dealii::internal::evaluate_general, 2, 0, 0, double>
-              eval_val(shape_values, shape_values, shape_values, points_source, points_target);
-          eval_val.template values<0, true, false>(src_, temp2.begin());
-          eval_val.template values<1, true, false>(temp2.begin(), temp1.begin());
-        }
-        else
-        {
-          // ... 3D
-          dealii::internal::
-            EvaluatorTensorProduct<dealii::internal::evaluate_general, 3, 0, 0, double>
-              eval_val(shape_values, shape_values, shape_values, points_source, points_target);
-          eval_val.template values<0, true, false>(src_, temp1.begin());
-          eval_val.template values<1, true, false>(temp1.begin(), temp2.begin());
-          eval_val.template values<2, true, false>(temp2.begin(), temp1.begin());
-        }
-        // write interpolated data permuted into destination vector
+        eval_val.template values<0, true, false>(temp1.begin(), temp2.begin());
+        eval_val.template values<1, true, false>(temp2.begin(), temp1.begin());
+        eval_val.template values<2, true, false>(temp1.begin(), temp2.begin());
+        std::swap(temp1, temp2);
+      }
+
+      // write interpolated data permuted into destination vector such that
+      // u, v, and w for each point are grouped together
+      for(unsigned int v = 0; v < n_filled; ++v)
+      {
+        unsigned int const cell = (field + v) / DIM;
+        unsigned int const d    = (field + v) % DIM;
+
+        double * dst_ = dst + cell * dofs_target * DIM;
         for(int i = 0; i < dofs_target; i++)
-          dst_[i * DIM + d] = temp1[i];
-        // go to next dimension
-        src_ += dofs_source;
+          dst_[i * DIM + d] = temp1[i][v];
       }
-      // go to next cell
-      dst_ += dofs_target * DIM;
     }
   }
 
@@ -25,21 +25,25 @@
 #include <fftw3-mpi.h>
 #include <mpi.h>
 #include <cmath>
+#include <string>
 
 // ExaDG
 #include <exadg/postprocessor/spectral_analysis/setup.h>
 
-// shortcuts for accessing linearized arrays
-#define u_comp2(i, j) u_comp[(j - local_start) * (N / 2 + 1) + i]
-#define v_comp2(i, j) v_comp[(j - local_start) * (N / 2 + 1) + i]
-#define u_comp3(i, j, k) u_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define v_comp3(i, j, k) v_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define w_comp3(i, j, k) w_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
+// shortcuts for accessing linearized arrays (velocity components are interleaved)
+#define u_comp2(i, j) comp[((j - local_start) * (N / 2 + 1) + i) * dim + 0]
+#define v_comp2(i, j) comp[((j - local_start) * (N / 2 + 1) + i) * dim + 1]
+#define u_comp3(i, j, k) comp[(((k - local_start) * N + j) * (N / 2 + 1) + i) * dim + 0]
+#define v_comp3(i, j, k) comp[(((k - local_start) * N + j) * (N / 2 + 1) + i) * dim + 1]
+#define w_comp3(i, j, k) comp[(((k - local_start) * N + j) * (N / 2 + 1) + i) * dim + 2]
 
 namespace dealspectrum
 {
 /**
  * Class wrapping FFTW and performing energy spectral analysis.
+ *
+ * All velocity components are stored interleaved and transformed by a single batched FFT. The
+ * FFTW plan is created once and kept for the lifetime of this object.
  */
 class SpectralAnalysis
 {
@@ -49,6 +53,8 @@ class SpectralAnalysis
   Setup & s;
   // is initialized?
   bool initialized;
+  // FFTW plan (created once and reused for every execution)
+  fftw_plan plan;
   // rank of process which owns row
   int * _indices_proc_rows;
 
@@ -57,7 +63,8 @@ public:
    * Constructor
    * @param s DEAL.SPECTRUM setup
    */
-  SpectralAnalysis(MPI_Comm const & comm, Setup & s) : comm(comm), s(s), initialized(false)
+  SpectralAnalysis(MPI_Comm const & comm, Setup & s)
+    : comm(comm), s(s), initialized(false), plan(nullptr)
   {
   }
 
@@ -104,16 +111,25 @@ public:
     this->size = s.size;
     this->bins = s.bins;
 
+    // FFTW requires its MPI interface to be initialized once
+    static bool fftw_mpi_initialized = false;
+    if(not fftw_mpi_initialized)
+    {
+      fftw_mpi_init();
+      fftw_mpi_initialized = true;
+    }
+
     // setup global size of output arrays...
     n = new ptrdiff_t[dim];
     for(int i = 0; i < dim - 1; i++)
       n[i] = N;
     n[dim - 1] = N / 2 + 1;
 
-    // ...get local size of local output arrays
+    // ...get local size of local output arrays (for all dim velocity components)
     ptrdiff_t local_elements = 0;
-    alloc_local              = fftw_mpi_local_size(dim, n, comm, &local_elements, &local_start);
-    local_end                = local_start + local_elements;
+    alloc_local              = fftw_mpi_local_size_many(
+      dim, n, dim, FFTW_MPI_DEFAULT_BLOCK, comm, &local_elements, &local_start);
+    local_end = local_start + local_elements;
 
     // determine how many rows each process has
     int * global_elements = new int[size];
@@ -133,28 +149,17 @@ public:
     n[dim - 1] = N;
 
     // allocate memory
-    // ... for input array (real) - allocated together for all directions
-    u_real = fftw_alloc_real(2 * alloc_local * dim);
+    // ... for input array (real) - velocity components are interleaved
+    u_real = fftw_alloc_real(2 * alloc_local);
     // ... and save required size
     this->bsize = 2 * alloc_local;
 
-    // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-      u_real[i] = 0;
-
-    // set pointer for v input field
-    v_real = u_real + 2 * alloc_local;
-
     // allocate memory for output array (complex)
-    u_comp = fftw_alloc_complex(alloc_local);
-    v_comp = fftw_alloc_complex(alloc_local);
+    comp = fftw_alloc_complex(alloc_local);
 
-    // do the same for 3D
-    if(dim == 3)
-    {
-      w_real = v_real + 2 * alloc_local;
-      w_comp = fftw_alloc_complex(alloc_local);
-    }
+    // initialize input array with zero (not needed: only useful for IO -> hard zero)
+    for(int i = 0; i < 2 * alloc_local; i++)
+      u_real[i] = 0;
 
     // allocate memory and ...
     this->e = new double[N];
@@ -174,25 +179,71 @@ public:
     if(!initialized)
       return;
 
+    if(plan != nullptr)
+      fftw_destroy_plan(plan);
+
     // free data structures
     delete[] _indices_proc_rows;
 
-    free(n);
-    fftw_free(u_comp);
-    fftw_free(v_comp);
-    free(u_real);
+    delete[] n;
+    fftw_free(comp);
+    fftw_free(u_real);
+
+    delete[] e;
+    delete[] E;
+    delete[] k;
+    delete[] K;
+    delete[] c;
+    delete[] C;
+  }
 
-    if(dim == 3)
+  /**
+   * Create the batched FFTW plan transforming all velocity components at once. Since planning
+   * with FFTW_MEASURE or FFTW_PATIENT overwrites the arrays, this function has to be called
+   * before the input array is filled.
+   *
+   * @param planner_flags   FFTW planner flags (FFTW_ESTIMATE, FFTW_MEASURE, FFTW_PATIENT)
+   * @param wisdom_file     file to import FFTW wisdom from and to export it to (if not empty)
+   */
+  void
+  create_plan(unsigned int const planner_flags, std::string const & wisdom_file)
+  {
+    AssertThrow(initialized, dealii::ExcMessage("SpectralAnalysis has not been initialized."));
+
+    // plan only once
+    if(plan != nullptr)
+      return;
+
+    if(not wisdom_file.empty())
+    {
+      // a missing wisdom file is not an error, it is created below
+      if(rank == 0)
+        fftw_import_wisdom_from_filename(wisdom_file.c_str());
+      fftw_mpi_broadcast_wisdom(comm);
+    }
+
+    plan = fftw_mpi_plan_many_dft_r2c(dim,
+                                      n,
+                                      dim,
+                                      FFTW_MPI_DEFAULT_BLOCK,
+                                      FFTW_MPI_DEFAULT_BLOCK,
+                                      u_real,
+                                      comp,
+                                      comm,
+                                      planner_flags);
+
+    AssertThrow(plan != nullptr, dealii::ExcMessage("Could not create FFTW plan."));
+
+    if(not wisdom_file.empty())
     {
-      fftw_free(w_comp);
+      fftw_mpi_gather_wisdom(comm);
+      if(rank == 0)
+        fftw_export_wisdom_to_filename(wisdom_file.c_str());
     }
 
-    delete e;
-    delete E;
-    delete k;
-    delete K;
-    delete c;
-    delete C;
+    // planning might have overwritten the input array
+    for(int i = 0; i < 2 * alloc_local; i++)
+      u_real[i] = 0;
   }
 
   /**
@@ -201,35 +252,30 @@ public:
   void
   execute()
   {
-    // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
-
-    // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
-
-    // ... for w
-    if(dim == 3)
+    AssertThrow(plan != nullptr, dealii::ExcMessage("FFTW plan has not been created."));
+
+    // The energy in physical space has to be computed before the transform, since multi-
+    // dimensional r2c transforms do not preserve their input. The padding of the last
+    // dimension, i >= N, is skipped.
+    int const n_rows     = (local_end - local_start) * dealii::Utilities::pow(N, dim - 2);
+    int const row_length = 2 * (N / 2 + 1) * dim;
+
+    e_physical_local = 0.0;
+    for(int row = 0; row < n_rows; row++)
     {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
+      for(int i = row * row_length; i < row * row_length + N * dim; i++)
+        e_physical_local += u_real[i] * u_real[i];
     }
+
+    // perform FFT for all velocity components
+    fftw_execute(plan);
   }
 
   void
   calculate_energy()
   {
     double scaling    = pow(N, dim);
-    double e_physical = 0.0, e_spectral = 0.0;
-
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-    {
-      e_physical += u_real[i] * u_real[i];
-    }
+    double e_physical = e_physical_local, e_spectral = 0.0;
 
     // scale: integrate cell wise...
     e_physical /= pow(N, dim);
@@ -401,25 +447,19 @@ public:
     int        dofs = (end - start) * delta;
     MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
 
-    // create view
+    // create view: velocity components are interleaved in memory
     MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
+    MPI_Type_vector(dofs, 1, dim, MPI_DOUBLE, &stype);
     MPI_Type_commit(&stype);
 
     // read file
     MPI_File fh;
     MPI_File_open(comm, filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    if(dim == 3)
+    for(int d = 0; d < dim; d++)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_write_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      MPI_File_set_view(fh, disp + delta_all * d, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
+      MPI_File_write_all(fh, u_real + d, 1, stype, MPI_STATUSES_IGNORE);
     }
 
     MPI_File_close(&fh);
@@ -443,25 +483,19 @@ public:
     int        dofs = (end - start) * delta;
     MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
 
-    // create view
+    // create view: velocity components are interleaved in memory
     MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
+    MPI_Type_vector(dofs, 1, dim, MPI_DOUBLE, &stype);
     MPI_Type_commit(&stype);
 
     // read file
     MPI_File fh;
     MPI_File_open(comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    if(dim == 3)
+    for(int d = 0; d < dim; d++)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_read_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      MPI_File_set_view(fh, disp + delta_all * d, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
+      MPI_File_read_all(fh, u_real + d, 1, stype, MPI_STATUSES_IGNORE);
     }
 
     MPI_File_close(&fh);
@@ -488,22 +522,16 @@ private:
   ptrdiff_t alloc_local;
 
 public:
-  // size of each real field
+  // size of the real field
   int bsize;
-  // real field for u
+  // real field for all velocity components (interleaved)
   double * u_real;
 
 private:
-  // ... for v
-  double * v_real;
-  // ... for w
-  double * w_real;
-  // complex field for u
-  fftw_complex * u_comp;
-  // ... for v
-  fftw_complex * v_comp;
-  // ... for w
-  fftw_complex * w_comp;
+  // complex field for all velocity components (interleaved)
+  fftw_complex * comp;
+  // energy in physical space (process-local, computed before the transform)
+  double e_physical_local;
 
 private:
   // array for locally collecting energy
@@ -25,9 +25,11 @@
 // deal.II
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/distributed/tria_base.h>
+#include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_values.h>
 
 // ExaDG
+#include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/statistics_manager.h>
 #include <exadg/utilities/create_directories.h>
 
@@ -40,6 +42,8 @@ StatisticsManager<dim, Number>::StatisticsManager(
   dealii::DoFHandler<dim> const & dof_handler_velocity,
   dealii::Mapping<dim> const &    mapping_in)
   : n_points_y_per_cell(0),
+    matrix_free(nullptr),
+    dof_index_velocity(0),
     dof_handler(dof_handler_velocity),
     mapping(mapping_in),
     mpi_comm(dof_handler_velocity.get_communicator()),
@@ -49,6 +53,23 @@ StatisticsManager<dim, Number>::StatisticsManager(
 {
 }
 
+template<int dim, typename Number>
+StatisticsManager<dim, Number>::StatisticsManager(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_velocity_in,
+  dealii::Mapping<dim> const &            mapping_in)
+  : n_points_y_per_cell(0),
+    matrix_free(&matrix_free_in),
+    dof_index_velocity(dof_index_velocity_in),
+    dof_handler(matrix_free_in.get_dof_handler(dof_index_velocity_in)),
+    mapping(mapping_in),
+    mpi_comm(dof_handler.get_communicator()),
+    number_of_samples(0),
+    write_final_output(true),
+    data(TurbulentChannelData())
+{
+}
+
 
 template<int dim, typename Number>
 void
@@ -285,10 +306,149 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
+    if(matrix_free != nullptr)
+      setup_matrix_free_evaluation();
+
     create_directories(data.directory, mpi_comm);
   }
 }
 
+template<int dim, typename Number>
+unsigned int
+StatisticsManager<dim, Number>::get_index_y_glob(double const y) const
+{
+  // find index within the y-values: first do a binary search to find
+  // the next larger value of y in the list...
+  // std::lower_bound: returns iterator to first element that is >= y.
+  // Note that the vector y_glob has to be sorted. As a result, the
+  // index might be too large.
+  unsigned int idx =
+    std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
+
+  // make sure that the index does not exceed the array bounds in case of round-off errors
+  if(idx == y_glob.size())
+    idx--;
+
+  // reduce index by 1 in case that the previous point is closer to y than
+  // the next point
+  if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
+    idx--;
+
+  AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
+              dealii::ExcMessage("Could not locate " + std::to_string(y) +
+                                 " among pre-evaluated points. Closest point is " +
+                                 std::to_string(y_glob[idx]) + " at distance " +
+                                 std::to_string(std::abs(y_glob[idx] - y)) +
+                                 ". Check transform() function given to constructor."));
+
+  return idx;
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::setup_matrix_free_evaluation()
+{
+  dealii::FiniteElement<dim> const & fe = dof_handler.get_fe().base_element(0);
+
+  AssertThrow(dynamic_cast<dealii::FE_DGQ<dim> const *>(&fe) != nullptr and
+                fe.has_support_points() and dof_handler.get_fe().element_multiplicity(0) >= dim,
+              dealii::ExcMessage("The matrix-free evaluation of turbulent channel statistics "
+                                 "requires a vector-valued, nodal FE_DGQ-type velocity space."));
+
+  unsigned int const n_dofs_1d = fe.degree + 1;
+  unsigned int const n_q_1d    = fe.degree + 1;
+
+  // The shape functions are tensor products of 1d polynomials and the first support point
+  // is a node of the first 1d polynomial in every direction. Hence, the 1d shape values
+  // can be obtained by evaluating the first row of shape functions along a line through this
+  // point.
+  dealii::Point<dim> const support_point = fe.get_unit_support_points()[0];
+  auto const evaluate_1d = [&](unsigned int const i, double const x) {
+    dealii::Point<dim> point = support_point;
+    point[0]                 = x;
+    return fe.shape_value(i, point);
+  };
+
+  dealii::QGauss<1> const gauss_1d(n_q_1d);
+  shape_values_xz.resize(n_q_1d * n_dofs_1d);
+  for(unsigned int q = 0; q < n_q_1d; ++q)
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      shape_values_xz[q * n_dofs_1d + i] = evaluate_1d(i, gauss_1d.point(q)[0]);
+
+  shape_values_y.resize(n_points_y_per_cell * n_dofs_1d);
+  for(unsigned int p = 0; p < n_points_y_per_cell; ++p)
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      shape_values_y[p * n_dofs_1d + i] = evaluate_1d(i, (double)p / (n_points_y_per_cell - 1));
+
+  // precompute the geometry of the sampling planes with dealii::FEValues (once)
+  dealii::QGauss<dim - 1> gauss_2d(n_q_1d);
+
+  std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    std::vector<dealii::Point<dim>> points(gauss_2d.size());
+    std::vector<double>             weights(gauss_2d.size());
+    for(unsigned int j = 0; j < gauss_2d.size(); ++j)
+    {
+      points[j][0] = gauss_2d.point(j)[0];
+      if(dim == 3)
+        points[j][2] = gauss_2d.point(j)[1];
+      points[j][1] = (double)i / (n_points_y_per_cell - 1);
+      weights[j]   = gauss_2d.weight(j);
+    }
+    fe_values[i].reset(new dealii::FEValues<dim>(mapping,
+                                                 fe,
+                                                 dealii::Quadrature<dim>(points, weights),
+                                                 dealii::update_jacobians |
+                                                   dealii::update_quadrature_points));
+  }
+
+  unsigned int const n_lanes         = dealii::VectorizedArray<Number>::size();
+  unsigned int const n_cell_batches  = matrix_free->n_cell_batches();
+  unsigned int const n_points_planes = n_points_y_per_cell * gauss_2d.size();
+
+  area_elements.resize(n_cell_batches * n_points_planes);
+  index_y_glob.resize(n_cell_batches * n_lanes * n_points_y_per_cell,
+                      dealii::numbers::invalid_unsigned_int);
+
+  for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      auto const cell_it = matrix_free->get_cell_iterator(cell, v, dof_index_velocity);
+
+      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+      {
+        fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell_it));
+
+        for(unsigned int q = 0; q < gauss_2d.size(); ++q)
+        {
+          double det = 0.;
+          if(dim == 3)
+          {
+            dealii::Tensor<2, 2> reduced_jacobian;
+            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
+            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
+            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
+            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
+            det                    = determinant(reduced_jacobian);
+          }
+          else
+          {
+            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
+          }
+
+          area_elements[(cell * n_points_y_per_cell + i) * gauss_2d.size() + q][v] =
+            det * gauss_2d.weight(q);
+        }
+
+        index_y_glob[(cell * n_lanes + v) * n_points_y_per_cell + i] =
+          get_index_y_glob(fe_values[i]->quadrature_point(0)[1]);
+      }
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::evaluate(VectorType const &   velocity,
@@ -441,6 +601,12 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
 {
+  if(matrix_free != nullptr and velocity.size() == 1)
+  {
+    do_evaluate_matrix_free(*velocity[0]);
+    return;
+  }
+
   // Use local vectors xxx_loc in order to average/integrate over all
   // locally owned cells of current processor.
   std::vector<double> area_loc(vel_glob[0].size());
@@ -561,31 +727,7 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
         }
 
         // Tranform cell index 'i' to global index 'idx' of y_glob-vector
-
-        // find index within the y-values: first do a binary search to find
-        // the next larger value of y in the list...
-        double const y = fe_values[i]->quadrature_point(0)[1];
-        // std::lower_bound: returns iterator to first element that is >= y.
-        // Note that the vector y_glob has to be sorted. As a result, the
-        // index might be too large.
-        unsigned int idx =
-          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-        // make sure that the index does not exceed the array bounds in case of round-off errors
-        if(idx == y_glob.size())
-          idx--;
-
-        // reduce index by 1 in case that the previous point is closer to y than
-        // the next point
-        if(idx > 0 && std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-          idx--;
-
-        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
-                    dealii::ExcMessage("Could not locate " + std::to_string(y) +
-                                       " among pre-evaluated points. Closest point is " +
-                                       std::to_string(y_glob[idx]) + " at distance " +
-                                       std::to_string(std::abs(y_glob[idx] - y)) +
-                                       ". Check transform() function given to constructor."));
+        unsigned int const idx = get_index_y_glob(fe_values[i]->quadrature_point(0)[1]);
 
         // Add results of cellwise integral to xxx_loc vectors since we want
         // to average/integrate over all locally owned cells.
@@ -631,6 +773,138 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
   number_of_samples++;
 }
 
+/*
+ *  Same as do_evaluate(), but the velocity is evaluated at the sampling planes via sum
+ *  factorization for all cells of a cell batch at once. The per-plane sums of all moments
+ *  are accumulated in a single vector which is reduced over all processes at once.
+ */
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::do_evaluate_matrix_free(VectorType const & velocity)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  unsigned int const n_lanes   = scalar::size();
+  unsigned int const n_dofs_1d = dof_handler.get_fe().degree + 1;
+  unsigned int const n_q_1d    = n_dofs_1d;
+  unsigned int const n_planes  = n_points_y_per_cell;
+  // number of points within a plane
+  unsigned int const n_q_plane = dealii::Utilities::pow(n_q_1d, dim - 1);
+  unsigned int const n_y       = y_glob.size();
+
+  // moments: <u_i> (i=1,...,dim), <u_i²> (i=1,...,dim), <u*v>, and area
+  unsigned int const  n_moments = 2 * dim + 2;
+  std::vector<double> moments_loc(n_moments * n_y, 0.0);
+
+  CellIntegrator<dim, dim, Number> integrator(*matrix_free, dof_index_velocity, 0);
+
+  unsigned int const n_dofs_component = integrator.dofs_per_component;
+
+  dealii::AlignedVector<scalar> tmp1(n_q_1d * dealii::Utilities::pow(n_dofs_1d, dim - 1));
+  dealii::AlignedVector<scalar> tmp2(n_q_plane * n_dofs_1d);
+  dealii::AlignedVector<scalar> values(dim * n_planes * n_q_plane);
+  std::vector<scalar>           sums(n_moments);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(velocity);
+
+    // interpolate each velocity component to the points of all planes (sum factorization):
+    // x-direction and z-direction at Gauss points, y-direction at the sampling planes
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      scalar const * dof_values = integrator.begin_dof_values() + d * n_dofs_component;
+      scalar *       out        = values.begin() + d * n_planes * n_q_plane;
+
+      // x-direction: tmp1[(k * n + j) * n_q + qx]
+      for(unsigned int kj = 0; kj < n_dofs_component / n_dofs_1d; ++kj)
+        for(unsigned int qx = 0; qx < n_q_1d; ++qx)
+        {
+          scalar sum = scalar();
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+            sum += shape_values_xz[qx * n_dofs_1d + i] * dof_values[kj * n_dofs_1d + i];
+          tmp1[kj * n_q_1d + qx] = sum;
+        }
+
+      // z-direction: tmp2[(qz * n + j) * n_q + qx]
+      scalar const * in_y = tmp1.begin();
+      if(dim == 3)
+      {
+        for(unsigned int qz = 0; qz < n_q_1d; ++qz)
+          for(unsigned int j = 0; j < n_dofs_1d; ++j)
+            for(unsigned int qx = 0; qx < n_q_1d; ++qx)
+            {
+              scalar sum = scalar();
+              for(unsigned int k = 0; k < n_dofs_1d; ++k)
+                sum += shape_values_xz[qz * n_dofs_1d + k] *
+                     tmp1[(k * n_dofs_1d + j) * n_q_1d + qx];
+              tmp2[(qz * n_dofs_1d + j) * n_q_1d + qx] = sum;
+            }
+        in_y = tmp2.begin();
+      }
+
+      // y-direction: out[p * n_q_plane + qz * n_q + qx]
+      for(unsigned int p = 0; p < n_planes; ++p)
+        for(unsigned int qz = 0; qz < n_q_plane / n_q_1d; ++qz)
+          for(unsigned int qx = 0; qx < n_q_1d; ++qx)
+          {
+            scalar sum = scalar();
+            for(unsigned int j = 0; j < n_dofs_1d; ++j)
+              sum += shape_values_y[p * n_dofs_1d + j] * in_y[(qz * n_dofs_1d + j) * n_q_1d + qx];
+            out[p * n_q_plane + qz * n_q_1d + qx] = sum;
+          }
+    }
+
+    // integrate over the planes of all cells of the cell batch
+    for(unsigned int p = 0; p < n_planes; ++p)
+    {
+      std::fill(sums.begin(), sums.end(), scalar());
+
+      for(unsigned int q = 0; q < n_q_plane; ++q)
+      {
+        scalar const area_ele = area_elements[(cell * n_planes + p) * n_q_plane + q];
+
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          scalar const u = values[(d * n_planes + p) * n_q_plane + q];
+          sums[d] += u * area_ele;
+          sums[dim + d] += u * u * area_ele;
+        }
+        sums[2 * dim] += values[p * n_q_plane + q] * values[(n_planes + p) * n_q_plane + q] *
+                         area_ele;
+        sums[2 * dim + 1] += area_ele;
+      }
+
+      for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      {
+        unsigned int const idx = index_y_glob[(cell * n_lanes + v) * n_planes + p];
+        for(unsigned int m = 0; m < n_moments; ++m)
+          moments_loc[m * n_y + idx] += sums[m][v];
+      }
+    }
+  }
+
+  // accumulate data over all processors with a single reduction
+  dealii::Utilities::MPI::sum(moments_loc, mpi_comm, moments_loc);
+
+  // Add values averaged over global x-z-planes to xxx_glob vectors.
+  // Averaging over time-samples is performed when writing the output.
+  double const * area_glob = &moments_loc[(2 * dim + 1) * n_y];
+  for(unsigned int idx = 0; idx < n_y; idx++)
+  {
+    for(unsigned int i = 0; i < dim; i++)
+      vel_glob[i].at(idx) += moments_loc[i * n_y + idx] / area_glob[idx];
+
+    for(unsigned int i = 0; i < dim; i++)
+      velsq_glob[i].at(idx) += moments_loc[(dim + i) * n_y + idx] / area_glob[idx];
+
+    veluv_glob.at(idx) += moments_loc[2 * dim * n_y + idx] / area_glob[idx];
+  }
+
+  // increment number of samples
+  number_of_samples++;
+}
 
 template class StatisticsManager<2, float>;
 template class StatisticsManager<3, float>;
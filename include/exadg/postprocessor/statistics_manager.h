@@ -25,6 +25,7 @@
 // deal.II
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
 #include <exadg/utilities/print_functions.h>
@@ -101,6 +102,16 @@ public:
   StatisticsManager(dealii::DoFHandler<dim> const & dof_handler_velocity,
                     dealii::Mapping<dim> const &    mapping);
 
+  /*
+   * Statistics are evaluated via sum factorization on the cell batches of the given MatrixFree
+   * object (vectorized over cells), instead of using dealii::FEValues cell by cell. This
+   * requires a nodal FE_DGQ-type velocity space and that the mesh does not change over time,
+   * since the geometry of the sampling planes is precomputed in setup().
+   */
+  StatisticsManager(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    unsigned int const                      dof_index_velocity,
+                    dealii::Mapping<dim> const &            mapping);
+
   // The argument grid_transform indicates how the y-direction that is initially distributed from
   // [0,1] is mapped to the actual grid. This must match the transformation applied to the
   // triangulation, otherwise the identification of data will fail
@@ -130,6 +141,31 @@ private:
   void
   do_evaluate(const std::vector<VectorType const *> & velocity);
 
+  // returns the index of the y-coordinate y in y_glob
+  unsigned int
+  get_index_y_glob(double const y) const;
+
+  void
+  setup_matrix_free_evaluation();
+
+  void
+  do_evaluate_matrix_free(VectorType const & velocity);
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+  unsigned int const                      dof_index_velocity;
+
+  // matrix-free evaluation: 1d shape values in x/z-direction (at Gauss points) and in
+  // y-direction (at the sampling planes)
+  dealii::AlignedVector<Number> shape_values_xz;
+  dealii::AlignedVector<Number> shape_values_y;
+
+  // matrix-free evaluation: area elements (Jacobian determinant times quadrature weight) for
+  // all cell batches, sampling planes, and points within a plane
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> area_elements;
+
+  // matrix-free evaluation: index in y_glob for all cell batches, lanes, and sampling planes
+  std::vector<unsigned int> index_y_glob;
+
   dealii::DoFHandler<dim> const & dof_handler;
   dealii::Mapping<dim> const &    mapping;
   MPI_Comm                        mpi_comm;
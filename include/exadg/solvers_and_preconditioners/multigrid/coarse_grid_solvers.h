@@ -183,16 +183,22 @@ public:
       if(additional_data.amg_data.amg_type == AMGType::ML)
       {
 #ifdef DEAL_II_WITH_TRILINOS
-        // create temporal vectors of type NumberAMG (double)
-        VectorTypeAMG dst_tri;
-        dst_tri.reinit(dst, false);
-        VectorTypeAMG src_tri;
-        src_tri.reinit(r, true);
-        src_tri.copy_locally_owned_data_from(r);
-
         std::shared_ptr<PreconditionerML<Operator, NumberAMG>> coarse_operator =
           std::dynamic_pointer_cast<PreconditionerML<Operator, NumberAMG>>(preconditioner_amg);
 
+        // The system matrix lives on the sub-communicator of the MPI processes that own part
+        // of the coarse grid, and only these processes participate in the solution of the
+        // coarse-grid problem.
+        if(coarse_operator->system_matrix.m() == 0)
+          return;
+
+        MPI_Comm const sub_comm = coarse_operator->system_matrix.get_mpi_communicator();
+
+        // create temporal vectors of type NumberAMG (double) on the sub-communicator
+        VectorTypeAMG dst_tri(dst.locally_owned_elements(), sub_comm);
+        VectorTypeAMG src_tri(r.locally_owned_elements(), sub_comm);
+        src_tri.copy_locally_owned_data_from(r);
+
         dealii::ReductionControl solver_control(additional_data.solver_data.max_iter,
                                                 additional_data.solver_data.abs_tol,
                                                 additional_data.solver_data.rel_tol);
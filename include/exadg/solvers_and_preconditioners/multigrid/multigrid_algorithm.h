@@ -32,7 +32,9 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
+#include <exadg/utilities/profiler.h>
 #include <exadg/utilities/timer_tree.h>
 
 /*
@@ -47,8 +49,9 @@
 namespace ExaDG
 {
 /*
- * Re-implementation of multigrid preconditioner (V-cycle) in order to have more direct control over
- * its individual components and avoid inner products and other expensive stuff.
+ * Re-implementation of multigrid preconditioner (V-, W-, F-cycle, and full multigrid) in order to
+ * have more direct control over its individual components and avoid inner products and other
+ * expensive stuff.
  */
 template<typename VectorType, typename MatrixType, typename SmootherType>
 class MultigridAlgorithm
@@ -59,7 +62,9 @@ public:
                      MGTransfer<VectorType> const &                               transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     std::string const &  name           = "Multigrid",
+                     MultigridCycle const cycle_type     = MultigridCycle::V,
+                     bool const           full_multigrid = false)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,10 +75,9 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      cycle_type(cycle_type),
+      full_multigrid(full_multigrid)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
-
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
       matrix[level]->initialize_dof_vector(solution[level]);
@@ -82,6 +86,26 @@ public:
     }
 
     timer_tree = std::make_shared<TimerTree>();
+
+    Profiler & profiler = Profiler::instance();
+
+    // several multigrid preconditioners are measured separately
+    region_multigrid = profiler.register_unique_region(name);
+    for(unsigned int level = minlevel; level <= maxlevel; ++level)
+    {
+      Profiler::RegionID const region_level =
+        profiler.register_region("Level " + std::to_string(level), region_multigrid);
+
+      if(level == minlevel)
+      {
+        region_coarse = profiler.register_region("Coarse-grid solver", region_level);
+      }
+      else
+      {
+        regions_smoothing.push_back(profiler.register_region("Smoothing", region_level));
+        regions_transfer.push_back(profiler.register_region("Transfer", region_level));
+      }
+    }
   }
 
   template<class OtherVectorType>
@@ -92,13 +116,14 @@ public:
     dealii::Timer timer;
 #endif
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
+    Profiler::Scope scope(region_multigrid);
+
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    if(full_multigrid)
+      fmg_cycle();
+    else
+      cycle(maxlevel, cycle_type, true);
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
@@ -111,6 +136,8 @@ public:
   unsigned int
   solve(OtherVectorType & dst, OtherVectorType const & src) const
   {
+    Profiler::Scope scope(region_multigrid);
+
     defect[maxlevel].copy_locally_owned_data_from(src);
 
     solution[maxlevel].copy_locally_owned_data_from(dst);
@@ -130,12 +157,26 @@ public:
     bool converged = norm_r_0 < abstol;
     while(!converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
+      if(full_multigrid && n_iter == 0)
       {
-        defect[i] = 0.0;
-      }
+        // The full multigrid cycle computes a correction for the current residual, starting from
+        // a zero initial guess on the coarsest level.
+        VectorType rhs, solution_0;
+        rhs.swap(defect[maxlevel]);
+        solution_0.swap(solution[maxlevel]);
+
+        defect[maxlevel] = residual;
+        solution[maxlevel].reinit(defect[maxlevel]);
+
+        fmg_cycle();
 
-      v_cycle(maxlevel, true);
+        solution[maxlevel] += solution_0;
+        defect[maxlevel].swap(rhs);
+      }
+      else
+      {
+        cycle(maxlevel, cycle_type, false);
+      }
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -167,10 +208,12 @@ public:
 
 private:
   /**
-   * Implements the V-cycle
+   * Implements the V-, W-, and F-cycle. The parameter initial_guess_is_zero specifies whether
+   * solution[level] may be assumed to be zero when entering this function, which allows to skip
+   * the residual evaluation in the first iteration of the pre-smoother.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  cycle(unsigned int const level, MultigridCycle const type, bool const initial_guess_is_zero) const
   {
 #if ENABLE_TIMING
     dealii::Timer timer;
@@ -183,6 +226,8 @@ private:
       timer.restart();
 #endif
 
+      Profiler::Scope scope(region_coarse);
+
       (*coarse)(level, solution[level], defect[level]);
 
 #if ENABLE_TIMING
@@ -196,42 +241,70 @@ private:
 #endif
 
       // pre-smoothing
-      if(multigrid_is_a_solver)
       {
-        // One has to take into account the initial guess of the solution when used as a solver
-        // and, therefore, call the function step().
-        (*smoother)[level]->step(solution[level], defect[level]);
-      }
-      else
-      {
-        // We can assume that solution[level] = 0 when used as a preconditioner
-        // and, therefore, call the function vmult(), which makes use of this assumption
-        // in order to apply optimizations (e.g., one does not need to evaluate the residual in
-        // the first iteration of the smoother).
-        (*smoother)[level]->vmult(solution[level], defect[level]);
+        Profiler::Scope scope(regions_smoothing[level - minlevel - 1]);
+
+        if(initial_guess_is_zero)
+        {
+          // We can assume that solution[level] = 0 and, therefore, call the function vmult(),
+          // which makes use of this assumption in order to apply optimizations (e.g., one does
+          // not need to evaluate the residual in the first iteration of the smoother).
+          (*smoother)[level]->vmult(solution[level], defect[level]);
+        }
+        else
+        {
+          // One has to take into account the initial guess of the solution (e.g. when used as a
+          // solver or when a level is visited repeatedly within W- and F-cycles) and, therefore,
+          // call the function step().
+          (*smoother)[level]->step(solution[level], defect[level]);
+        }
       }
 
       // restriction
-      (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
-      t[level].sadd(-1.0, 1.0, defect[level]);
-      transfer.restrict_and_add(level, defect[level - 1], t[level]);
+      {
+        Profiler::Scope scope(regions_transfer[level - minlevel - 1]);
+
+        (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
+        t[level].sadd(-1.0, 1.0, defect[level]);
+        defect[level - 1] = 0.0;
+        transfer.restrict_and_add(level, defect[level - 1], t[level]);
+      }
 
 #if ENABLE_TIMING
       timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
 #endif
 
       // coarse grid correction
-      v_cycle(level - 1, false);
+      cycle(level - 1, type, true);
+
+      // W- and F-cycles visit the next coarser level a second time, using the result of the
+      // first visit as initial guess. This is not necessary if the next coarser level is the
+      // coarsest level, since the coarse-grid problem is solved by the coarse-grid solver.
+      if(level - 1 > minlevel)
+      {
+        if(type == MultigridCycle::W)
+          cycle(level - 1, MultigridCycle::W, false);
+        else if(type == MultigridCycle::F)
+          cycle(level - 1, MultigridCycle::V, false);
+      }
 
 #if ENABLE_TIMING
       timer.restart();
 #endif
 
       // prolongation
-      transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
+      {
+        Profiler::Scope scope(regions_transfer[level - minlevel - 1]);
+
+        transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
+      }
 
       // post-smoothing
-      (*smoother)[level]->step(solution[level], defect[level]);
+      {
+        Profiler::Scope scope(regions_smoothing[level - minlevel - 1]);
+
+        (*smoother)[level]->step(solution[level], defect[level]);
+      }
 
 #if ENABLE_TIMING
       timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
@@ -239,6 +312,60 @@ private:
     }
   }
 
+  /**
+   * Implements full multigrid (FMG): The right-hand side defect[maxlevel] is restricted to all
+   * levels, the coarse-grid problem is solved, and the solution is then prolongated level by level
+   * serving as initial guess for one multigrid cycle on each level.
+   */
+  void
+  fmg_cycle() const
+  {
+#if ENABLE_TIMING
+    dealii::Timer timer;
+#endif
+
+    // restrict right-hand side to all levels
+    for(unsigned int level = maxlevel; level > minlevel; --level)
+    {
+#if ENABLE_TIMING
+      timer.restart();
+#endif
+
+      Profiler::Scope scope(regions_transfer[level - minlevel - 1]);
+
+      defect[level - 1] = 0.0;
+      transfer.restrict_and_add(level, defect[level - 1], defect[level]);
+
+#if ENABLE_TIMING
+      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+#endif
+    }
+
+    // solve coarse-grid problem
+    cycle(minlevel, cycle_type, true);
+
+    // nested iteration from coarse to fine levels
+    for(unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+#if ENABLE_TIMING
+      timer.restart();
+#endif
+
+      {
+        Profiler::Scope scope(regions_transfer[level - minlevel - 1]);
+
+        solution[level] = 0.0;
+        transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
+      }
+
+#if ENABLE_TIMING
+      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+#endif
+
+      cycle(level, cycle_type, false);
+    }
+  }
+
   /**
    * Coarsest level.
    */
@@ -287,9 +414,24 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  /**
+   * Type of multigrid cycle.
+   */
+  MultigridCycle const cycle_type;
+
+  /**
+   * Use full multigrid (FMG).
+   */
+  bool const full_multigrid;
 
   std::shared_ptr<TimerTree> timer_tree;
+
+  /**
+   * Profiler regions: the whole preconditioner, the coarse-grid solver, and smoothing and grid
+   * transfer of levels minlevel+1,...,maxlevel.
+   */
+  Profiler::RegionID              region_multigrid, region_coarse;
+  std::vector<Profiler::RegionID> regions_smoothing, regions_transfer;
 };
 
 } // namespace ExaDG
@@ -71,6 +71,16 @@ enum class PSequenceType
 std::string
 enum_to_string(PSequenceType const enum_type);
 
+enum class MultigridCycle
+{
+  V,
+  W,
+  F
+};
+
+std::string
+enum_to_string(MultigridCycle const enum_type);
+
 enum class MultigridSmoother
 {
   Chebyshev,
@@ -197,7 +207,10 @@ struct SmootherData
       iterations(5),
       relaxation_factor(0.8),
       smoothing_range(20),
-      iterations_eigenvalue_estimation(20)
+      iterations_eigenvalue_estimation(20),
+      reuse_eigenvalue_estimate(false),
+      iterations_eigenvalue_check(5),
+      tolerance_eigenvalue_check(0.05)
   {
   }
 
@@ -217,6 +230,13 @@ struct SmootherData
     {
       print_parameter(pcout, "Smoothing range", smoothing_range);
       print_parameter(pcout, "Iterations eigenvalue estimation", iterations_eigenvalue_estimation);
+      print_parameter(pcout, "Reuse eigenvalue estimate", reuse_eigenvalue_estimate);
+
+      if(reuse_eigenvalue_estimate)
+      {
+        print_parameter(pcout, "Iterations eigenvalue check", iterations_eigenvalue_check);
+        print_parameter(pcout, "Tolerance eigenvalue check", tolerance_eigenvalue_check);
+      }
     }
   }
 
@@ -237,6 +257,17 @@ struct SmootherData
 
   // number of CG iterations for estimation of eigenvalues
   unsigned int iterations_eigenvalue_estimation;
+
+  // Chebyshev smoother and Chebyshev coarse-grid solver: reuse the eigenvalue estimates of the
+  // previous setup when the multigrid preconditioner is updated, unless a power iteration
+  // warm-started from the previous eigenvector shows that the largest eigenvalue has changed
+  bool reuse_eigenvalue_estimate;
+
+  // number of power iterations to check whether the largest eigenvalue has changed
+  unsigned int iterations_eigenvalue_check;
+
+  // relative change of the largest eigenvalue above which the eigenvalues are estimated again
+  double tolerance_eigenvalue_check;
 };
 
 struct CoarseGridData
@@ -284,6 +315,9 @@ struct MultigridData
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
       use_global_coarsening(false),
+      coarse_level_grain_size(200),
+      cycle(MultigridCycle::V),
+      full_multigrid(false),
       smoother_data(SmootherData()),
       coarse_problem(CoarseGridData())
   {
@@ -301,6 +335,14 @@ struct MultigridData
 
     print_parameter(pcout, "Global coarsening", use_global_coarsening);
 
+    if(use_global_coarsening and involves_h_transfer())
+    {
+      print_parameter(pcout, "Grain size coarse h-levels", coarse_level_grain_size);
+    }
+
+    print_parameter(pcout, "Multigrid cycle", enum_to_string(cycle));
+    print_parameter(pcout, "Full multigrid (FMG)", full_multigrid);
+
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
@@ -325,6 +367,24 @@ struct MultigridData
   // hanging nodes
   bool use_global_coarsening;
 
+  // Only relevant for use_global_coarsening in combination with h-transfer: the coarse h-levels
+  // are repartitioned onto a decreasing subset of MPI processes (agglomeration) such that every
+  // process owning cells owns at least the given number of cells on that level. Processes that
+  // do not own cells on the coarsest level do not participate in AMG-based coarse-grid solvers.
+  // A value of 0 disables the repartitioning, i.e., the coarse levels inherit the partitioning
+  // of the fine level.
+  unsigned int coarse_level_grain_size;
+
+  // Type of multigrid cycle: V-cycle, W-cycle, or F-cycle. W- and F-cycles visit the coarser
+  // levels more often, which makes a single application of the preconditioner more expensive,
+  // but typically reduces the number of iterations of the outer Krylov solver.
+  MultigridCycle cycle;
+
+  // Full multigrid (FMG): the right-hand side is restricted to the coarsest level first, and the
+  // solution is then built up level by level, performing one multigrid cycle of type "cycle" on
+  // each level using the prolongated solution from the next coarser level as initial guess.
+  bool full_multigrid;
+
   // Smoother data
   SmootherData smoother_data;
 
@@ -48,8 +48,9 @@
 namespace ExaDG
 {
 template<int dim, typename Number>
-MultigridPreconditionerBase<dim, Number>::MultigridPreconditionerBase(MPI_Comm const & comm)
-  : n_levels(1), coarse_level(0), fine_level(0), mpi_comm(comm), triangulation(nullptr)
+MultigridPreconditionerBase<dim, Number>::MultigridPreconditionerBase(MPI_Comm const &    comm,
+                                                                      std::string const & name)
+  : n_levels(1), coarse_level(0), fine_level(0), mpi_comm(comm), name(name), triangulation(nullptr)
 {
 }
 
@@ -328,8 +329,9 @@ class BalancedGranularityPartitionPolicy
   : public dealii::RepartitioningPolicyTools::Base<dim, spacedim>
 {
 public:
-  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes)
-    : n_mpi_processes_per_level{n_mpi_processes}
+  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes,
+                                     unsigned int const grain_size)
+    : n_mpi_processes_per_level{n_mpi_processes}, grain_size(grain_size)
   {
   }
 
@@ -338,14 +340,14 @@ public:
   {
     dealii::types::global_cell_index const n_cells = tria_coarse_in.n_global_active_cells();
 
-    // TODO: We hard-code a grain-size limit of 200 cells per processor
-    // (assuming linear finite elements and typical behavior of
+    // We aim at a grain size of cells per processor given by the multigrid data (the
+    // default of 200 assumes linear finite elements and typical behavior of
     // supercomputers). In case we have fewer cells on the fine level, we do
-    // not immediately go to 200 cells per rank, but limit the growth by a
-    // factor of 8, which limits makes sure that we do not create too many
+    // not immediately go to this grain size, but limit the growth by a
+    // factor of 8, which makes sure that we do not create too many
     // messages for individual MPI processes.
     unsigned int const grain_size_limit =
-      std::min<unsigned int>(200, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
+      std::min<unsigned int>(grain_size, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
 
     dealii::RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim> partitioning_policy(
       grain_size_limit);
@@ -360,22 +362,35 @@ public:
 
 private:
   mutable std::vector<unsigned int> n_mpi_processes_per_level;
+
+  unsigned int const grain_size;
 };
 
 /**
  * Similar to dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence
  * with the difference that the (coarse-grid) p:d:T is converted to a p:f:T
- * right away.
+ * right away. For grain_size > 0, the coarse levels are agglomerated onto fewer
+ * MPI processes, otherwise they inherit the partitioning of the fine level.
  */
 template<int dim, int spacedim>
 std::vector<std::shared_ptr<dealii::Triangulation<dim, spacedim> const>>
 create_geometric_coarsening_sequence(
-  dealii::Triangulation<dim, spacedim> const & fine_triangulation_in)
+  dealii::Triangulation<dim, spacedim> const & fine_triangulation_in,
+  unsigned int const                           grain_size)
 {
-  return dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
-    fine_triangulation_in,
-    BalancedGranularityPartitionPolicy<dim>(
-      dealii::Utilities::MPI::n_mpi_processes(fine_triangulation_in.get_communicator())));
+  if(grain_size > 0)
+  {
+    return dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      fine_triangulation_in,
+      BalancedGranularityPartitionPolicy<dim>(
+        dealii::Utilities::MPI::n_mpi_processes(fine_triangulation_in.get_communicator()),
+        grain_size));
+  }
+  else
+  {
+    return dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      fine_triangulation_in, dealii::RepartitioningPolicyTools::DefaultPolicy<dim, spacedim>());
+  }
 }
 
 template<int dim, typename Number>
@@ -400,7 +415,8 @@ MultigridPreconditionerBase<dim, Number>::initialize_coarse_grid_triangulations(
           "without refinements, a dealii::parallel::distributed::Triangulation, or a "
           "MultigridType without h-transfer."));
 
-      coarse_grid_triangulations = create_geometric_coarsening_sequence(*tria);
+      coarse_grid_triangulations =
+        create_geometric_coarsening_sequence(*tria, data.coarse_level_grain_size);
     }
   }
 }
@@ -842,6 +858,8 @@ MultigridPreconditionerBase<dim, Number>::update_smoother(unsigned int level)
               dealii::ExcMessage(
                 "Multigrid level is invalid when initializing multigrid smoother!"));
 
+  dealii::Timer timer;
+
   switch(data.smoother_data.smoother)
   {
     case MultigridSmoother::Chebyshev:
@@ -878,12 +896,19 @@ MultigridPreconditionerBase<dim, Number>::update_smoother(unsigned int level)
       AssertThrow(false, dealii::ExcMessage("Specified MultigridSmoother not implemented!"));
     }
   }
+
+  multigrid_algorithm->get_timings()->insert({"Multigrid",
+                                              "Update",
+                                              "Smoother level " + std::to_string(level)},
+                                             timer.wall_time());
 }
 
 template<int dim, typename Number>
 void
 MultigridPreconditionerBase<dim, Number>::update_coarse_solver(bool const operator_is_singular)
 {
+  dealii::Timer timer;
+
   switch(data.coarse_problem.solver)
   {
     case MultigridCoarseGridSolver::Chebyshev:
@@ -923,6 +948,9 @@ MultigridPreconditionerBase<dim, Number>::update_coarse_solver(bool const operat
       AssertThrow(false, dealii::ExcMessage("Unknown coarse-grid solver given"));
     }
   }
+
+  multigrid_algorithm->get_timings()->insert({"Multigrid", "Update", "Coarse-grid solver"},
+                                             timer.wall_time());
 }
 
 template<int dim, typename Number>
@@ -1037,7 +1065,14 @@ MultigridPreconditionerBase<dim, Number>::initialize_multigrid_algorithm()
 {
   this
     ->multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    this->operators, *this->coarse_grid_solver, *this->transfers, this->smoothers, this->mpi_comm);
+    this->operators,
+    *this->coarse_grid_solver,
+    *this->transfers,
+    this->smoothers,
+    this->mpi_comm,
+    name,
+    data.cycle,
+    data.full_multigrid);
 }
 
 template<int dim, typename Number>
@@ -1061,7 +1096,39 @@ MultigridPreconditionerBase<dim, Number>::initialize_chebyshev_smoother(Operator
   smoother_data.eig_cg_n_iterations = data.smoother_data.iterations_eigenvalue_estimation;
 
   std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
-  smoother->initialize(mg_operator, smoother_data);
+
+  if(data.smoother_data.reuse_eigenvalue_estimate)
+  {
+    EigenvalueCache<VectorTypeMG> & cache = eigenvalue_caches[level];
+
+    std::pair<double, double> eigenvalues;
+    if(cache.reuse(eigenvalues,
+                   mg_operator,
+                   diagonal_vector,
+                   data.smoother_data.iterations_eigenvalue_check,
+                   data.smoother_data.tolerance_eigenvalue_check))
+    {
+      // skip the CG-based eigenvalue estimation of dealii::PreconditionChebyshev
+      smoother_data.max_eigenvalue      = eigenvalues.second;
+      smoother_data.eig_cg_n_iterations = 0;
+
+      smoother->initialize(mg_operator, smoother_data);
+    }
+    else
+    {
+      smoother->initialize(mg_operator, smoother_data);
+
+      eigenvalues = smoother->estimate_eigenvalues(diagonal_vector);
+      cache.store(eigenvalues,
+                  mg_operator,
+                  diagonal_vector,
+                  data.smoother_data.iterations_eigenvalue_check);
+    }
+  }
+  else
+  {
+    smoother->initialize(mg_operator, smoother_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -1082,8 +1149,25 @@ MultigridPreconditionerBase<dim, Number>::initialize_chebyshev_smoother_coarse_g
   coarse_operator.initialize_dof_vector(diagonal_vector);
   coarse_operator.calculate_inverse_diagonal(diagonal_vector);
 
-  std::pair<double, double> eigenvalues =
-    compute_eigenvalues(coarse_operator, diagonal_vector, operator_is_singular);
+  bool const reuse_eigenvalues = data.smoother_data.reuse_eigenvalue_estimate;
+
+  EigenvalueCache<VectorTypeMG> & cache = eigenvalue_caches[0];
+
+  std::pair<double, double> eigenvalues;
+  if(not(reuse_eigenvalues and cache.reuse(eigenvalues,
+                                           coarse_operator,
+                                           diagonal_vector,
+                                           data.smoother_data.iterations_eigenvalue_check,
+                                           data.smoother_data.tolerance_eigenvalue_check)))
+  {
+    eigenvalues = compute_eigenvalues(coarse_operator, diagonal_vector, operator_is_singular);
+
+    if(reuse_eigenvalues)
+      cache.store(eigenvalues,
+                  coarse_operator,
+                  diagonal_vector,
+                  data.smoother_data.iterations_eigenvalue_check);
+  }
 
   double const factor = 1.1;
 
@@ -35,6 +35,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/utilities/eigenvalue_cache.h>
 
 // forward declarations
 namespace ExaDG
@@ -78,9 +79,9 @@ private:
 
 public:
   /*
-   * Constructor.
+   * Constructor. The name identifies the multigrid preconditioner in the profiler.
    */
-  MultigridPreconditionerBase(MPI_Comm const & comm);
+  MultigridPreconditionerBase(MPI_Comm const & comm, std::string const & name = "Multigrid");
 
   /*
    * Destructor.
@@ -313,6 +314,8 @@ private:
 
   MPI_Comm const mpi_comm;
 
+  std::string const name;
+
   MultigridData data;
 
   dealii::Triangulation<dim> const * triangulation;
@@ -336,6 +339,10 @@ private:
 
   std::shared_ptr<dealii::MGCoarseGridBase<VectorTypeMG>> coarse_grid_solver;
 
+  // eigenvalue estimates of the Chebyshev smoothers (and the Chebyshev coarse-grid solver on
+  // level 0) that can be reused when the preconditioner is updated
+  std::map<unsigned int, EigenvalueCache<VectorTypeMG>> eigenvalue_caches;
+
   std::shared_ptr<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>> multigrid_algorithm;
 };
 } // namespace ExaDG
@@ -59,6 +59,18 @@ public:
     smoother_object.initialize(matrix, additional_data);
   }
 
+  /*
+   * Estimates the eigenvalues (min, max) of the preconditioned operator as done by
+   * dealii::PreconditionChebyshev when applied the first time, and returns these estimates.
+   */
+  std::pair<double, double>
+  estimate_eigenvalues(VectorType const & src) const
+  {
+    auto const info = smoother_object.estimate_eigenvalues(src);
+
+    return std::make_pair(info.min_eigenvalue_estimate, info.max_eigenvalue_estimate);
+  }
+
 private:
   dealii::PreconditionChebyshev<Operator, VectorType> smoother_object;
 };
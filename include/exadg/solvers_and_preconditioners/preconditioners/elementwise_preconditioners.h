@@ -22,7 +22,13 @@
 #ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONER_ELEMENTWISE_PRECONDITIONERS_H_
 #define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONER_ELEMENTWISE_PRECONDITIONERS_H_
 
+// C/C++
+#include <cmath>
+
 // deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/table.h>
+#include <deal.II/lac/tensor_product_matrix.h>
 #include <deal.II/matrix_free/operators.h>
 
 // ExaDG
@@ -54,6 +60,16 @@ public:
   virtual void
   vmult(Number * dst, Number const * src) const = 0;
 
+  /*
+   * Returns true if vmult() applies the exact inverse of the block of the current cell, in which
+   * case the elementwise iterative solver can be skipped for this cell.
+   */
+  virtual bool
+  is_exact_inverse() const
+  {
+    return false;
+  }
+
 private:
 };
 
@@ -124,6 +140,266 @@ private:
   std::shared_ptr<CellwiseInverseMass> inverse;
 };
 
+/*
+ * Block Jacobi preconditioner based on the fast diagonalization method.
+ *
+ * The block A of a cell is written as a sum of Kronecker products of 1D matrices,
+ *
+ *   A = sum_d M x ... x K_d x ... x M ,
+ *
+ * where M is the 1D mass matrix of the reference element and K_d the 1D operator in direction d.
+ * This representation is exact for mass, Laplace, and Helmholtz-type operators with constant
+ * coefficients on affine, axis-aligned cells. The matrices K_d are not assembled from the
+ * coefficients of a specific operator, but are extracted from the columns of A belonging to the
+ * dofs on the lines through the first dof of the cell, which are computed by matrix-free operator
+ * evaluation. Afterwards, the inverse of A is applied in O(p^(d+1)) operations using the
+ * eigendecompositions of the 1D generalized eigenvalue problems K_d v = lambda M v, see
+ * dealii::TensorProductMatrixSymmetricSum. The vector components are treated separately with the
+ * same 1D matrices.
+ *
+ * Whether the inverse is sufficiently accurate is tested for each cell by applying it to the
+ * operator applied to a given vector. If the relative error exceeds the tolerance (e.g. for curved
+ * cells, variable coefficients, or convective terms), the elementwise iterative solver is used for
+ * this cell with the inverse mass matrix as preconditioner.
+ */
+template<int dim, int n_components, typename Number, typename Operator>
+class FastDiagonalizationPreconditioner
+  : public Elementwise::PreconditionerBase<dealii::VectorizedArray<Number>>
+{
+public:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef dealii::TensorProductMatrixSymmetricSum<dim, scalar> TensorProductMatrix;
+
+  FastDiagonalizationPreconditioner(Operator & operator_in, double const tolerance_in)
+    : op(operator_in),
+      tolerance(tolerance_in),
+      fallback(operator_in.get_matrix_free(),
+               operator_in.get_dof_index(),
+               operator_in.get_quad_index()),
+      current_cell(0)
+  {
+    dealii::internal::MatrixFreeFunctions::ShapeInfo<scalar> const & shape_info =
+      op.get_matrix_free().get_shape_info(op.get_dof_index(), op.get_quad_index());
+
+    n_dofs_1d = shape_info.data[0].fe_degree + 1;
+
+    dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+
+    AssertThrow(shape_info.dofs_per_component_on_cell == dofs_per_component,
+                dealii::ExcMessage("The fast diagonalization method requires a tensor-product "
+                                   "finite element."));
+
+    // mass matrix of the 1D reference element computed with the quadrature rule of the operator
+    unsigned int const n_q_points_1d = shape_info.data[0].n_q_points_1d;
+
+    mass_matrix.reinit(n_dofs_1d, n_dofs_1d);
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+    {
+      for(unsigned int j = 0; j < n_dofs_1d; ++j)
+      {
+        Number sum = 0.0;
+        for(unsigned int q = 0; q < n_q_points_1d; ++q)
+          sum += shape_info.data[0].shape_values[i * n_q_points_1d + q][0] *
+                 shape_info.data[0].shape_values[j * n_q_points_1d + q][0] *
+                 shape_info.data[0].quadrature.weight(q);
+
+        mass_matrix(i, j) = sum;
+      }
+    }
+  }
+
+  /*
+   * Computes the 1D matrices and their eigendecompositions for all cells. This function has to be
+   * called whenever the operator changes.
+   */
+  void
+  update()
+  {
+    dealii::MatrixFree<dim, Number> const & matrix_free = op.get_matrix_free();
+
+    unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+    unsigned int const dofs_per_cell  = dofs_per_component * n_components;
+
+    matrices.resize(n_cell_batches);
+    is_exact.resize(n_cell_batches);
+
+    dealii::AlignedVector<scalar> src(dofs_per_cell), dst(dofs_per_cell);
+
+    std::array<dealii::Table<2, scalar>, dim> mass_matrices, derivative_matrices;
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      mass_matrices[d] = mass_matrix;
+      derivative_matrices[d].reinit(n_dofs_1d, n_dofs_1d);
+    }
+
+    // scaling of the columns of A by the mass matrix entries of the remaining directions
+    scalar const mass_00       = mass_matrix(0, 0);
+    scalar       scaling_other = 1.0;
+    for(unsigned int d = 1; d < dim; ++d)
+      scaling_other *= mass_00;
+
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      op.setup(cell, dofs_per_cell);
+
+      // Extract K_d + beta_d M from the columns of the dofs on the line in direction d through the
+      // first dof of the cell, where the constants beta_d originate from the 1D operators of the
+      // other directions.
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        unsigned int const stride = dealii::Utilities::pow(n_dofs_1d, d);
+
+        for(unsigned int j = 0; j < n_dofs_1d; ++j)
+        {
+          Elementwise::vector_init(src.begin(), dofs_per_cell);
+          src[j * stride] = 1.0;
+
+          op.vmult(dst.begin(), src.begin());
+
+          for(unsigned int i = 0; i < n_dofs_1d; ++i)
+            derivative_matrices[d](i, j) = dst[i * stride] / scaling_other;
+        }
+      }
+
+      // The sum over all directions contains the mass term with coefficient sum_d beta_d, which
+      // equals (dim-1) times the (0,0)-entry of any of the extracted matrices divided by the
+      // (0,0)-entry of the mass matrix. This term is subtracted from the first direction.
+      scalar const shift = Number(dim - 1) * derivative_matrices[0](0, 0) / mass_00;
+      for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        for(unsigned int j = 0; j < n_dofs_1d; ++j)
+          derivative_matrices[0](i, j) -= shift * mass_matrix(i, j);
+
+      // The fast diagonalization method requires symmetric matrices. The filled lanes of
+      // incomplete cell batches are overwritten by the first lane.
+      unsigned int const n_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for(unsigned int j = i; j < n_dofs_1d; ++j)
+          {
+            scalar const value =
+              0.5 * (derivative_matrices[d](i, j) + derivative_matrices[d](j, i));
+            derivative_matrices[d](i, j) = value;
+            derivative_matrices[d](j, i) = value;
+
+            for(unsigned int v = n_lanes; v < scalar::size(); ++v)
+            {
+              derivative_matrices[d](i, j)[v] = value[0];
+              derivative_matrices[d](j, i)[v] = value[0];
+            }
+          }
+        }
+      }
+
+      matrices[cell].reinit(mass_matrices, derivative_matrices);
+
+      is_exact[cell] = check_inverse(cell, n_lanes);
+    }
+  }
+
+  void
+  setup(unsigned int const cell)
+  {
+    AssertThrow(cell < is_exact.size(),
+                dealii::ExcMessage("Fast diagonalization has not been updated."));
+
+    current_cell = cell;
+
+    if(not is_exact[cell])
+      fallback.setup(cell);
+  }
+
+  bool
+  is_exact_inverse() const
+  {
+    return is_exact[current_cell];
+  }
+
+  void
+  vmult(scalar * dst, scalar const * src) const
+  {
+    if(is_exact[current_cell])
+      apply_inverse(current_cell, dst, src);
+    else
+      fallback.vmult(dst, src);
+  }
+
+private:
+  void
+  apply_inverse(unsigned int const cell, scalar * dst, scalar const * src) const
+  {
+    for(unsigned int c = 0; c < n_components; ++c)
+      matrices[cell].apply_inverse(
+        dealii::ArrayView<scalar>(dst + c * dofs_per_component, dofs_per_component),
+        dealii::ArrayView<scalar const>(src + c * dofs_per_component, dofs_per_component));
+  }
+
+  /*
+   * Applies the inverse to the operator applied to given vectors and returns whether the relative
+   * error is below the tolerance for all cells of the batch. Two linearly independent vectors are
+   * used, a smooth one and an oscillating one, since a single vector might happen to lie in a
+   * subspace on which the inverse is exact although it is not exact in general.
+   */
+  bool
+  check_inverse(unsigned int const cell, unsigned int const n_lanes)
+  {
+    unsigned int const dofs_per_cell = dofs_per_component * n_components;
+
+    dealii::AlignedVector<scalar> src(dofs_per_cell), dst(dofs_per_cell), solution(dofs_per_cell);
+
+    op.setup(cell, dofs_per_cell);
+
+    for(unsigned int test = 0; test < 2; ++test)
+    {
+      for(unsigned int i = 0; i < dofs_per_cell; ++i)
+      {
+        double const x = static_cast<double>(i + 1);
+        if(test == 0)
+          src[i] = 1.0 + 0.5 * std::sin(x);
+        else
+          src[i] = (i % 2 == 0 ? 1.0 : -1.0) * std::cos(0.7 * x);
+      }
+
+      op.vmult(dst.begin(), src.begin());
+
+      apply_inverse(cell, solution.begin(), dst.begin());
+
+      scalar const minus_one = -1.0;
+      Elementwise::add(solution.begin(), minus_one, src.begin(), dofs_per_cell);
+
+      scalar const error = Elementwise::l2_norm(solution.begin(), dofs_per_cell) /
+                           Elementwise::l2_norm(src.begin(), dofs_per_cell);
+
+      // also fails for non-finite values
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        if(not(error[v] <= tolerance))
+          return false;
+    }
+
+    return true;
+  }
+
+  Operator & op;
+
+  // tolerance for the relative error of the inverse, above which the fallback is used
+  double const tolerance;
+
+  InverseMassPreconditioner<dim, n_components, Number> fallback;
+
+  unsigned int n_dofs_1d;
+  unsigned int dofs_per_component;
+
+  dealii::Table<2, scalar> mass_matrix;
+
+  std::vector<TensorProductMatrix> matrices;
+
+  std::vector<bool> is_exact;
+
+  unsigned int current_cell;
+};
+
 } // namespace Elementwise
 } // namespace ExaDG
 
@@ -45,6 +45,9 @@ enum_to_string(Preconditioner const enum_type)
     case Preconditioner::InverseMassMatrix:
       string_type = "InverseMassMatrix";
       break;
+    case Preconditioner::FastDiagonalization:
+      string_type = "FastDiagonalization";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -31,12 +31,18 @@ namespace Elementwise
 /*
  * Elementwise preconditioner for block Jacobi preconditioner (only relevant for
  * elementwise iterative solution procedure)
+ *
+ * FastDiagonalization: The block of a cell is inverted directly by the fast diagonalization
+ * method if it can be represented as a sum of Kronecker products of 1D matrices (mass, Laplace, and
+ * Helmholtz-type operators on affine, axis-aligned cells). On all other cells, the elementwise
+ * iterative solver is used with the inverse mass matrix as preconditioner.
  */
 enum class Preconditioner
 {
   Undefined,
   None,
-  InverseMassMatrix
+  InverseMassMatrix,
+  FastDiagonalization
 };
 
 std::string
@@ -86,6 +86,10 @@ private:
 
   typedef dealii::TrilinosWrappers::PreconditionAMG::AdditionalData MLData;
 
+  // subcommunicator; declared before the matrix to ensure that it gets
+  // deleted after the matrix and preconditioner depending on it
+  std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)> subcommunicator;
+
 public:
   // distributed sparse system matrix
   dealii::TrilinosWrappers::SparseMatrix system_matrix;
@@ -95,17 +99,15 @@ private:
 
 public:
   PreconditionerML(Operator const & op, MLData ml_data = MLData())
-    : pde_operator(op), ml_data(ml_data)
+    : subcommunicator(
+        create_subcommunicator(op.get_matrix_free().get_dof_handler(op.get_dof_index()))),
+      pde_operator(op),
+      ml_data(ml_data)
   {
     // initialize system matrix
-    pde_operator.init_system_matrix(system_matrix,
-                                    op.get_matrix_free().get_dof_handler().get_communicator());
-
-    // calculate_matrix
-    pde_operator.calculate_system_matrix(system_matrix);
+    pde_operator.init_system_matrix(system_matrix, *subcommunicator);
 
-    // initialize Trilinos' AMG
-    amg.initialize(system_matrix, ml_data);
+    calculate_preconditioner();
   }
 
   dealii::TrilinosWrappers::SparseMatrix const &
@@ -117,23 +119,36 @@ public:
   void
   update() override
   {
-    // clear content of matrix since the next calculate_system_matrix-commands add their result
-    system_matrix *= 0.0;
-
-    // re-calculate matrix
-    pde_operator.calculate_system_matrix(system_matrix);
+    // clear content of matrix since the next calculate_system_matrix-commands add their result;
+    // since we might run this on a sub-communicator, we skip the processes that do not
+    // participate in the matrix and have size zero
+    if(system_matrix.m() > 0)
+      system_matrix *= 0.0;
 
-    // initialize Trilinos' AMG
-    amg.initialize(system_matrix, ml_data);
+    calculate_preconditioner();
   }
 
   void
   vmult(VectorType & dst, VectorType const & src) const override
   {
-    amg.vmult(dst, src);
+    if(system_matrix.m() > 0)
+      amg.vmult(dst, src);
   }
 
 private:
+  void
+  calculate_preconditioner()
+  {
+    // calculate_matrix in case the current MPI rank participates in the Trilinos communicator
+    if(system_matrix.m() > 0)
+    {
+      pde_operator.calculate_system_matrix(system_matrix);
+
+      // initialize Trilinos' AMG
+      amg.initialize(system_matrix, ml_data);
+    }
+  }
+
   // reference to matrix-free operator
   Operator const & pde_operator;
 
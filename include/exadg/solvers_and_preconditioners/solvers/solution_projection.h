@@ -0,0 +1,208 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_PROJECTION_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_PROJECTION_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ExaDG
+{
+/*
+ * Computes initial guesses for a sequence of linear systems A x = b with slowly varying
+ * right-hand sides (typically one linear system per time step) by projecting the new
+ * right-hand side onto the space spanned by the previous solutions (successive solution
+ * projection according to Fischer, Comput. Methods Appl. Mech. Engrg. 163, 1998).
+ *
+ * For symmetric positive definite matrices, the basis x_i is A-orthonormal and the initial
+ * guess is the best approximation of the solution in the energy norm. Otherwise, the images
+ * A x_i of the basis vectors are orthonormal and the initial guess minimizes the residual.
+ * To avoid additional operator evaluations, the images are approximated by the right-hand
+ * sides of the linear systems that have been solved, i.e., A x_i = b_i holds up to the solver
+ * tolerance. This requires that all linear systems share the same matrix, which is why the
+ * basis is cleared whenever the matrix changes, see set_matrix().
+ *
+ * Once the basis contains max_dimension vectors, it is restarted from the latest solution.
+ * A value of max_dimension = 0 disables the projection.
+ */
+template<typename VectorType>
+class SolutionProjection
+{
+public:
+  SolutionProjection(unsigned int const max_dimension_in, bool const symmetric_in)
+    : max_dimension(max_dimension_in),
+      symmetric(symmetric_in),
+      mass_scaling_factor(0.0),
+      n_guesses(0),
+      sum_digits(0.0)
+  {
+  }
+
+  /*
+   * Describes the matrix of the next linear system and has to be called before
+   * compute_initial_guess(). The basis is cleared if the scaling factor of the mass matrix
+   * (e.g. gamma0/dt for BDF schemes) differs from the one of the previous linear system, or if
+   * the matrix has changed otherwise (e.g. for moving meshes or a variable viscosity).
+   */
+  void
+  set_matrix(double const mass_scaling_factor_in, bool const matrix_has_changed)
+  {
+    if(matrix_has_changed or mass_scaling_factor_in != mass_scaling_factor)
+      clear();
+
+    mass_scaling_factor = mass_scaling_factor_in;
+  }
+
+  /*
+   * Computes the initial guess for the right-hand side rhs. Returns false and leaves dst
+   * unchanged if no previous solutions are available.
+   */
+  bool
+  compute_initial_guess(VectorType & dst, VectorType const & rhs) const
+  {
+    if(solutions.empty())
+      return false;
+
+    for(unsigned int i = 0; i < solutions.size(); ++i)
+    {
+      double const alpha = symmetric ? (solutions[i] * rhs) : (images[i] * rhs);
+
+      if(i == 0)
+        dst.equ(alpha, solutions[i]);
+      else
+        dst.add(alpha, solutions[i]);
+    }
+
+    return true;
+  }
+
+  /*
+   * Adds the solution of the linear system with right-hand side rhs to the basis. This
+   * function has to be called with the right-hand side passed to compute_initial_guess().
+   */
+  void
+  add_solution(VectorType const & solution, VectorType const & rhs)
+  {
+    if(max_dimension == 0)
+      return;
+
+    VectorType x(solution), b(rhs);
+
+    double const norm_sqr = symmetric ? (x * b) : (b * b);
+    if(not(norm_sqr > 0.0))
+      return;
+
+    // orthogonalize against the current basis (modified Gram-Schmidt)
+    for(unsigned int i = 0; i < solutions.size(); ++i)
+    {
+      double const beta = symmetric ? (solutions[i] * b) : (images[i] * b);
+      x.add(-beta, solutions[i]);
+      b.add(-beta, images[i]);
+    }
+
+    double const norm_sqr_orthogonal = symmetric ? (x * b) : (b * b);
+
+    // The norm of the orthogonal part of the solution is the error of the initial guess
+    // that has been computed from the current basis.
+    if(not(solutions.empty()))
+    {
+      double const relative_error = std::sqrt(std::max(norm_sqr_orthogonal, 0.0) / norm_sqr);
+      sum_digits += -std::log10(std::max(relative_error, 1.e-16));
+      ++n_guesses;
+    }
+
+    if(solutions.size() == max_dimension)
+    {
+      // restart the basis from the latest solution
+      solutions.clear();
+      images.clear();
+
+      x = solution;
+      b = rhs;
+      add_normalized(x, b, norm_sqr);
+    }
+    // skip solutions that are (numerically) contained in the basis
+    else if(norm_sqr_orthogonal > 1.e-20 * norm_sqr)
+    {
+      add_normalized(x, b, norm_sqr_orthogonal);
+    }
+  }
+
+  /*
+   * Removes all vectors from the basis, e.g. after a change of the matrix.
+   */
+  void
+  clear()
+  {
+    solutions.clear();
+    images.clear();
+  }
+
+  bool
+  is_active() const
+  {
+    return max_dimension > 0;
+  }
+
+  /*
+   * Returns the average reduction of the error (in the energy norm for symmetric matrices,
+   * of the residual otherwise) achieved by the initial guesses, measured in orders of
+   * magnitude.
+   */
+  double
+  get_average_digits_gained() const
+  {
+    return sum_digits / std::max(1., (double)n_guesses);
+  }
+
+private:
+  void
+  add_normalized(VectorType & x, VectorType & b, double const norm_sqr)
+  {
+    double const factor = 1.0 / std::sqrt(norm_sqr);
+    x *= factor;
+    b *= factor;
+
+    solutions.push_back(x);
+    images.push_back(b);
+  }
+
+  unsigned int const max_dimension;
+  bool const         symmetric;
+
+  // scaling factor of the mass matrix contained in the matrix of the current basis
+  double mass_scaling_factor;
+
+  // A-orthonormal basis (symmetric case) and approximations of A x_i
+  std::vector<VectorType> solutions;
+  std::vector<VectorType> images;
+
+  // statistics
+  unsigned int n_guesses;
+  double       sum_digits;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_PROJECTION_H_ */
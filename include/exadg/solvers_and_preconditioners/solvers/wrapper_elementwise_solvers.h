@@ -128,8 +128,12 @@ private:
       op.setup(cell, dofs_per_cell);
       preconditioner.setup(cell);
 
-      // call iterative solver and solve on current cell
-      solver->solve(&op, solution.begin(), integrator.begin_dof_values(), &preconditioner);
+      // call iterative solver and solve on current cell, unless the preconditioner already
+      // provides the exact inverse
+      if(preconditioner.is_exact_inverse())
+        preconditioner.vmult(solution.begin(), integrator.begin_dof_values());
+      else
+        solver->solve(&op, solution.begin(), integrator.begin_dof_values(), &preconditioner);
 
       // write solution on current element to global dof vector
       for(unsigned int j = 0; j < dofs_per_cell; ++j)
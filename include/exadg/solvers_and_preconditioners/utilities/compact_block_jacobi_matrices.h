@@ -0,0 +1,304 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_COMPACT_BLOCK_JACOBI_MATRICES_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_COMPACT_BLOCK_JACOBI_MATRICES_H_
+
+// C/C++
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Memory-lean storage of the LU factorizations of the block Jacobi matrices of all cells.
+ *
+ * Compared to one dealii::LAPACKFullMatrix per cell, all factors are stored in one contiguous
+ * buffer in which the entries of the cells of a cell batch are interleaved, i.e., entry (i,j) of
+ * all cells of a batch is stored as one dealii::VectorizedArray. The forward and backward
+ * substitutions are therefore applied to all cells of a batch at once. Optionally, the factors
+ * are stored in single precision, which is usually sufficient for a preconditioner.
+ *
+ * The LU factorization uses partial pivoting separately for each cell. A zero pivot (singular
+ * matrix, or lanes of a cell batch that are not filled) is replaced by a small positive value.
+ */
+template<typename Number>
+class CompactBlockJacobiMatrices
+{
+public:
+  typedef dealii::VectorizedArray<Number> VectorizedArrayType;
+
+  static unsigned int const n_lanes = VectorizedArrayType::size();
+
+  CompactBlockJacobiMatrices() : n_batches(0), block_size(0), single_precision(false)
+  {
+  }
+
+  /*
+   * Allocates memory for n_batches cell batches with matrices of size block_size x block_size.
+   */
+  void
+  reinit(unsigned int const n_batches_in,
+         unsigned int const block_size_in,
+         bool const         single_precision_in)
+  {
+    n_batches        = n_batches_in;
+    block_size       = block_size_in;
+    single_precision = single_precision_in and not(std::is_same<Number, float>::value);
+
+    std::size_t const n_entries = std::size_t(n_batches) * block_size * block_size;
+
+    if(single_precision)
+    {
+      factors.clear();
+      factors_single.resize(n_entries * n_lanes);
+    }
+    else
+    {
+      factors_single.clear();
+      factors.resize(n_entries);
+    }
+
+    pivots.resize(std::size_t(n_batches) * block_size * n_lanes);
+  }
+
+  /*
+   * Computes the LU factorization of the matrices of cell batch "batch". The matrices are given in
+   * the interleaved layout, i.e., entry (i,j) of all cells of the batch is stored in
+   * blocks[i * block_size + j]. The vector is used as working memory and is overwritten.
+   */
+  void
+  factorize(unsigned int const batch, dealii::AlignedVector<VectorizedArrayType> & blocks)
+  {
+    unsigned int const n = block_size;
+
+    AssertDimension(blocks.size(), n * n);
+
+    dealii::AlignedVector<VectorizedArrayType> & lu = blocks;
+
+    unsigned int * pivot = &pivots[std::size_t(batch) * n * n_lanes];
+
+    for(unsigned int k = 0; k < n; ++k)
+    {
+      // partial pivoting is done separately for each lane
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        unsigned int p         = k;
+        Number       max_value = std::abs(lu[k * n + k][v]);
+        for(unsigned int i = k + 1; i < n; ++i)
+        {
+          if(std::abs(lu[i * n + k][v]) > max_value)
+          {
+            p         = i;
+            max_value = std::abs(lu[i * n + k][v]);
+          }
+        }
+
+        pivot[k * n_lanes + v] = p;
+
+        if(p != k)
+        {
+          for(unsigned int j = 0; j < n; ++j)
+            std::swap(lu[k * n + j][v], lu[p * n + j][v]);
+        }
+
+        if(max_value == Number(0.0))
+          lu[k * n + k][v] = 1.e-4;
+      }
+
+      VectorizedArrayType const inverse_pivot = Number(1.0) / lu[k * n + k];
+      for(unsigned int i = k + 1; i < n; ++i)
+      {
+        lu[i * n + k] *= inverse_pivot;
+        for(unsigned int j = k + 1; j < n; ++j)
+          lu[i * n + j] -= lu[i * n + k] * lu[k * n + j];
+      }
+
+      // store the inverse of the diagonal entry to avoid divisions in solve()
+      lu[k * n + k] = inverse_pivot;
+    }
+
+    std::size_t const offset = std::size_t(batch) * n * n;
+    for(unsigned int e = 0; e < n * n; ++e)
+    {
+      if(single_precision)
+      {
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          factors_single[(offset + e) * n_lanes + v] = lu[e][v];
+      }
+      else
+      {
+        factors[offset + e] = lu[e];
+      }
+    }
+  }
+
+  /*
+   * Overwrites the values of the cells of cell batch "batch" (block_size entries) by the
+   * solution of the linear systems with the factorized matrices.
+   */
+  void
+  solve(unsigned int const batch, VectorizedArrayType * values) const
+  {
+    if(single_precision)
+      do_solve(batch, values, factors_single.data());
+    else
+      do_solve(batch, values, factors.data());
+  }
+
+  /*
+   * Overwrites the values of the cells of cell batch "batch" (block_size entries) by the product
+   * with the original matrices, which are recovered from the LU factors as A = P^T * L * U.
+   */
+  void
+  vmult(unsigned int const batch, VectorizedArrayType * values) const
+  {
+    if(single_precision)
+      do_vmult(batch, values, factors_single.data());
+    else
+      do_vmult(batch, values, factors.data());
+  }
+
+  std::size_t
+  memory_consumption() const
+  {
+    return factors.memory_consumption() + factors_single.capacity() * sizeof(float) +
+           pivots.capacity() * sizeof(unsigned int);
+  }
+
+private:
+  static VectorizedArrayType
+  load(VectorizedArrayType const * data, std::size_t const index)
+  {
+    return data[index];
+  }
+
+  static VectorizedArrayType
+  load(float const * data, std::size_t const index)
+  {
+    VectorizedArrayType value;
+    for(unsigned int v = 0; v < n_lanes; ++v)
+      value[v] = data[index * n_lanes + v];
+    return value;
+  }
+
+  template<typename StorageType>
+  void
+  do_solve(unsigned int const batch, VectorizedArrayType * x, StorageType const * data) const
+  {
+    unsigned int const n = block_size;
+
+    std::size_t const    offset = std::size_t(batch) * n * n;
+    unsigned int const * pivot  = &pivots[std::size_t(batch) * n * n_lanes];
+
+    // apply row interchanges
+    for(unsigned int k = 0; k < n; ++k)
+    {
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        unsigned int const p = pivot[k * n_lanes + v];
+        if(p != k)
+          std::swap(x[k][v], x[p][v]);
+      }
+    }
+
+    // forward substitution with unit lower triangular factor
+    for(unsigned int i = 1; i < n; ++i)
+    {
+      VectorizedArrayType sum = x[i];
+      for(unsigned int j = 0; j < i; ++j)
+        sum -= load(data, offset + i * n + j) * x[j];
+      x[i] = sum;
+    }
+
+    // backward substitution with upper triangular factor (inverse diagonal stored)
+    for(int i = static_cast<int>(n) - 1; i >= 0; --i)
+    {
+      VectorizedArrayType sum = x[i];
+      for(unsigned int j = i + 1; j < n; ++j)
+        sum -= load(data, offset + i * n + j) * x[j];
+      x[i] = sum * load(data, offset + i * n + i);
+    }
+  }
+
+  template<typename StorageType>
+  void
+  do_vmult(unsigned int const batch, VectorizedArrayType * x, StorageType const * data) const
+  {
+    unsigned int const n = block_size;
+
+    std::size_t const    offset = std::size_t(batch) * n * n;
+    unsigned int const * pivot  = &pivots[std::size_t(batch) * n * n_lanes];
+
+    // multiplication with upper triangular factor (inverse diagonal stored)
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      VectorizedArrayType sum = x[i] / load(data, offset + i * n + i);
+      for(unsigned int j = i + 1; j < n; ++j)
+        sum += load(data, offset + i * n + j) * x[j];
+      x[i] = sum;
+    }
+
+    // multiplication with unit lower triangular factor
+    for(int i = static_cast<int>(n) - 1; i > 0; --i)
+    {
+      VectorizedArrayType sum = x[i];
+      for(int j = 0; j < i; ++j)
+        sum += load(data, offset + i * n + j) * x[j];
+      x[i] = sum;
+    }
+
+    // undo row interchanges in reverse order
+    for(int k = static_cast<int>(n) - 1; k >= 0; --k)
+    {
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        unsigned int const p = pivot[k * n_lanes + v];
+        if(p != static_cast<unsigned int>(k))
+          std::swap(x[k][v], x[p][v]);
+      }
+    }
+  }
+
+  unsigned int n_batches;
+  unsigned int block_size;
+  bool         single_precision;
+
+  // LU factors in working precision, entries of the cells of a batch interleaved
+  dealii::AlignedVector<VectorizedArrayType> factors;
+
+  // LU factors in single precision with the same layout
+  std::vector<float> factors_single;
+
+  // row interchanges of the LU factorization for every cell
+  std::vector<unsigned int> pivots;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_COMPACT_BLOCK_JACOBI_MATRICES_H_ */
@@ -0,0 +1,145 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_EIGENVALUE_CACHE_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_EIGENVALUE_CACHE_H_
+
+// C/C++
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+namespace ExaDG
+{
+/*
+ * Performs n_iterations steps of a power iteration for the Jacobi-preconditioned operator,
+ * starting from the normalized vector eigenvector, and returns the resulting estimate of the
+ * largest eigenvalue. On return, eigenvector contains the normalized last iterate.
+ */
+template<typename Operator, typename VectorType>
+double
+power_iteration(VectorType &       eigenvector,
+                Operator const &   op,
+                VectorType const & inverse_diagonal,
+                unsigned int const n_iterations)
+{
+  VectorType tmp;
+  tmp.reinit(eigenvector, true);
+
+  double eigenvalue = 0.0;
+  for(unsigned int i = 0; i < n_iterations; ++i)
+  {
+    op.vmult(tmp, eigenvector);
+    tmp.scale(inverse_diagonal);
+
+    eigenvalue = tmp.l2_norm();
+    if(eigenvalue == 0.0)
+      break;
+
+    eigenvector.equ(1.0 / eigenvalue, tmp);
+  }
+
+  return eigenvalue;
+}
+
+/*
+ * Cache for eigenvalue estimates (min, max) of the Jacobi-preconditioned operator used to set up
+ * Chebyshev iterations. When the operator is updated, e.g. for a new convective velocity, a few
+ * steps of a power iteration warm-started from the approximate eigenvector of the previous call
+ * tell whether the largest eigenvalue has moved. If it has not, the expensive estimation can be
+ * skipped and the cached estimates are reused.
+ */
+template<typename VectorType>
+class EigenvalueCache
+{
+public:
+  EigenvalueCache() : valid(false), reference_eigenvalue(1.0), eigenvalues(1.0, 1.0)
+  {
+  }
+
+  /*
+   * Returns true if the cached estimates can be reused for the operator op, in which case
+   * eigenvalues_out contains the cached estimates rescaled by the change of the largest eigenvalue.
+   * The largest eigenvalue is approached from below by the power iteration, so that the rescaling
+   * errs on the safe side for the Chebyshev iteration.
+   */
+  template<typename Operator>
+  bool
+  reuse(std::pair<double, double> & eigenvalues_out,
+        Operator const &            op,
+        VectorType const &          inverse_diagonal,
+        unsigned int const          n_iterations,
+        double const                tolerance)
+  {
+    if(not valid or eigenvector.size() != inverse_diagonal.size())
+      return false;
+
+    double const ratio =
+      power_iteration(eigenvector, op, inverse_diagonal, n_iterations) / reference_eigenvalue;
+
+    if(std::abs(ratio - 1.0) > tolerance)
+      return false;
+
+    eigenvalues_out.first  = ratio * eigenvalues.first;
+    eigenvalues_out.second = ratio * eigenvalues.second;
+
+    return true;
+  }
+
+  /*
+   * Stores new estimates computed for the operator op and the reference value of the power
+   * iteration against which later operators are compared.
+   */
+  template<typename Operator>
+  void
+  store(std::pair<double, double> const & eigenvalues_in,
+        Operator const &                  op,
+        VectorType const &                inverse_diagonal,
+        unsigned int const                n_iterations)
+  {
+    if(eigenvector.size() != inverse_diagonal.size())
+    {
+      eigenvector.reinit(inverse_diagonal, true);
+      // NB: initialize rand in order to obtain "reproducible" results !!!
+      srand(1);
+      for(unsigned int i = 0; i < eigenvector.locally_owned_size(); ++i)
+        eigenvector.local_element(i) = (double)rand() / RAND_MAX;
+      eigenvector /= eigenvector.l2_norm();
+    }
+
+    eigenvalues          = eigenvalues_in;
+    reference_eigenvalue = power_iteration(eigenvector, op, inverse_diagonal, n_iterations);
+    valid                = (reference_eigenvalue > 0.0);
+  }
+
+private:
+  bool valid;
+
+  double reference_eigenvalue;
+
+  std::pair<double, double> eigenvalues;
+
+  VectorType eigenvector;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_EIGENVALUE_CACHE_H_ */
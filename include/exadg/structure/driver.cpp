@@ -232,10 +232,19 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   pde_operator->initialize_dof_vector(dst);
   src = 1.0;
 
-  if(application->get_parameters().large_deformation && operator_type == OperatorType::Linearized)
+  bool const linearized =
+    (operator_type == OperatorType::Linearized or operator_type == OperatorType::LinearizedCached);
+
+  if(application->get_parameters().large_deformation && linearized)
   {
     pde_operator->initialize_dof_vector(linearization);
     linearization = 1.0;
+
+    // The point of linearization does not change between repeated applications of the
+    // linearized operator. Hence, it is set only once outside the measurement so that the
+    // cached variant is not charged for computing the cache in every operator evaluation.
+    pde_operator->set_cache_linearization(operator_type == OperatorType::LinearizedCached);
+    pde_operator->set_solution_linearization(linearization);
   }
 
   const std::function<void(void)> operator_evaluation = [&](void) {
@@ -245,9 +254,8 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
       {
         pde_operator->apply_nonlinear_operator(dst, src, 1.0, 0.0);
       }
-      else if(operator_type == OperatorType::Linearized)
+      else if(linearized)
       {
-        pde_operator->set_solution_linearization(linearization);
         pde_operator->apply_linearized_operator(dst, src, 1.0, 0.0);
       }
     }
@@ -44,7 +44,8 @@ namespace Structure
 enum class OperatorType
 {
   Nonlinear,
-  Linearized
+  Linearized,
+  LinearizedCached
 };
 
 inline std::string
@@ -55,8 +56,9 @@ enum_to_string(OperatorType const enum_type)
   switch(enum_type)
   {
     // clang-format off
-    case OperatorType::Nonlinear:  string_type = "Nonlinear";  break;
-    case OperatorType::Linearized: string_type = "Linearized"; break;
+    case OperatorType::Nonlinear:        string_type = "Nonlinear";        break;
+    case OperatorType::Linearized:       string_type = "Linearized";       break;
+    case OperatorType::LinearizedCached: string_type = "LinearizedCached"; break;
     default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
       // clang-format on
   }
@@ -68,8 +70,9 @@ inline void
 string_to_enum(OperatorType & enum_type, std::string const string_type)
 {
   // clang-format off
-  if     (string_type == "Nonlinear")  enum_type = OperatorType::Nonlinear;
-  else if(string_type == "Linearized") enum_type = OperatorType::Linearized;
+  if     (string_type == "Nonlinear")        enum_type = OperatorType::Nonlinear;
+  else if(string_type == "Linearized")       enum_type = OperatorType::Linearized;
+  else if(string_type == "LinearizedCached") enum_type = OperatorType::LinearizedCached;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
@@ -27,7 +27,7 @@ namespace Structure
 {
 template<int dim, typename Number>
 MultigridPreconditioner<dim, Number>::MultigridPreconditioner(MPI_Comm const & mpi_comm)
-  : Base(mpi_comm), pde_operator(nullptr), nonlinear(true)
+  : Base(mpi_comm, "Multigrid structure"), pde_operator(nullptr), nonlinear(true)
 {
 }
 
@@ -272,11 +272,13 @@ Operator<dim, Number>::setup_operators()
   operator_data.density             = param.density;
   if(param.large_deformation)
   {
-    operator_data.pull_back_traction = param.pull_back_traction;
+    operator_data.pull_back_traction  = param.pull_back_traction;
+    operator_data.cache_linearization = param.cache_linearization;
   }
   else
   {
-    operator_data.pull_back_traction = false;
+    operator_data.pull_back_traction  = false;
+    operator_data.cache_linearization = false;
   }
 
   if(param.large_deformation)
@@ -707,6 +709,13 @@ Operator<dim, Number>::set_solution_linearization(VectorType const & vector) con
   elasticity_operator_nonlinear.set_solution_linearization(vector);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_cache_linearization(bool const cache) const
+{
+  elasticity_operator_nonlinear.set_cache_linearization(cache);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::apply_linearized_operator(VectorType &       dst,
@@ -242,6 +242,9 @@ public:
   void
   set_solution_linearization(VectorType const & vector) const;
 
+  void
+  set_cache_linearization(bool const cache) const;
+
   void
   apply_linearized_operator(VectorType &       dst,
                             VectorType const & src,
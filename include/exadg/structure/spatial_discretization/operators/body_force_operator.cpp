@@ -39,6 +39,8 @@ BodyForceOperator<dim, Number>::initialize(dealii::MatrixFree<dim, Number> const
 {
   this->matrix_free = &matrix_free;
   this->data        = data;
+
+  function = make_function_vectorized(data.function);
 }
 
 template<int dim, typename Number>
@@ -87,7 +89,7 @@ BodyForceOperator<dim, Number>::cell_loop(dealii::MatrixFree<dim, Number> const
     for(unsigned int q = 0; q < integrator.n_q_points; ++q)
     {
       auto q_points = integrator.quadrature_point(q);
-      auto b        = FunctionEvaluator<1, dim, Number>::value(data.function, q_points, time);
+      auto b        = FunctionEvaluator<1, dim, Number>::value(function, q_points, time);
 
       if(data.pull_back_body_force)
       {
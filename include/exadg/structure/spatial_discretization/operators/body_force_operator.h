@@ -23,6 +23,7 @@
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_RHS_OPERATOR_H_
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
 
@@ -89,6 +90,9 @@ private:
 
   BodyForceData<dim> data;
 
+  // vectorized representation of data.function, resolved once in initialize()
+  std::shared_ptr<FunctionVectorized<dim>> function;
+
   double mutable time;
 };
 
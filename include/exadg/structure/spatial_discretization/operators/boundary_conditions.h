@@ -46,7 +46,7 @@ inline DEAL_II_ALWAYS_INLINE //
 
   if(boundary_type == BoundaryType::Neumann)
   {
-    auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
+    auto bc       = boundary_descriptor->neumann_bc_vectorized.find(boundary_id)->second;
     auto q_points = integrator.quadrature_point(q);
 
     traction = FunctionEvaluator<1, dim, Number>::value(bc, q_points, time);
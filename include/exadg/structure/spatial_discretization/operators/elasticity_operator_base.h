@@ -37,6 +37,7 @@ struct OperatorData : public OperatorBaseData
   OperatorData()
     : OperatorBaseData(),
       pull_back_traction(false),
+      cache_linearization(false),
       unsteady(false),
       density(1.0),
       n_q_points_1d(2),
@@ -52,6 +53,11 @@ struct OperatorData : public OperatorBaseData
   // is pulled back to the reference configuration, t_0 = da/dA t.
   bool pull_back_traction;
 
+  // This parameter is only relevant for the nonlinear operator. When set to true, the
+  // deformation gradient and the stresses at the point of linearization are computed once
+  // and stored in all quadrature points, trading memory for a faster linearized operator.
+  bool cache_linearization;
+
   // activates mass operator in operator evaluation for unsteady problems
   bool unsteady;
 
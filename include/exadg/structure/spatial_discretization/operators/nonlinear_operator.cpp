@@ -39,6 +39,9 @@ NonLinearOperator<dim, Number>::initialize(
   integrator_lin = std::make_shared<IntegratorCell>(*this->matrix_free);
   this->matrix_free->initialize_dof_vector(displacement_lin, data.dof_index);
   displacement_lin.update_ghost_values();
+
+  cache_linearization = false;
+  set_cache_linearization(data.cache_linearization);
 }
 
 template<int dim, typename Number>
@@ -60,6 +63,9 @@ NonLinearOperator<dim, Number>::set_solution_linearization(VectorType const & ve
 {
   displacement_lin = vector;
   displacement_lin.update_ghost_values();
+
+  if(cache_linearization)
+    compute_linearization_cache();
 }
 
 template<int dim, typename Number>
@@ -69,6 +75,73 @@ NonLinearOperator<dim, Number>::get_solution_linearization() const
   return displacement_lin;
 }
 
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::set_cache_linearization(bool const cache) const
+{
+  if(cache == cache_linearization)
+    return;
+
+  cache_linearization = cache;
+
+  if(cache_linearization)
+  {
+    unsigned int const n_q_points = this->integrator->n_q_points;
+    F_lin_cache.reinit(this->matrix_free->n_cell_batches(), n_q_points);
+    S_lin_cache.reinit(this->matrix_free->n_cell_batches(), n_q_points);
+
+    compute_linearization_cache();
+  }
+  else
+  {
+    // release memory
+    F_lin_cache.reinit(0, 0);
+    S_lin_cache.reinit(0, 0);
+  }
+}
+
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::compute_linearization_cache() const
+{
+  VectorType dummy;
+  this->matrix_free->cell_loop(&This::cell_loop_linearization_cache,
+                               this,
+                               dummy,
+                               displacement_lin);
+}
+
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::cell_loop_linearization_cache(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &,
+  VectorType const & src,
+  Range const &      range) const
+{
+  IntegratorCell integrator(matrix_free,
+                            this->operator_data.dof_index,
+                            this->operator_data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    reinit_cell_nonlinear(integrator, cell);
+
+    integrator.read_dof_values_plain(src);
+    integrator.evaluate(dealii::EvaluationFlags::gradients);
+
+    std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      tensor const F_lin = get_F<dim, Number>(integrator.get_gradient(q));
+
+      F_lin_cache(cell, q) = F_lin;
+      S_lin_cache(cell, q) = material->evaluate_stress(get_E<dim, Number>(F_lin), cell, q);
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::reinit_cell_nonlinear(IntegratorCell &   integrator,
@@ -221,6 +294,10 @@ NonLinearOperator<dim, Number>::reinit_cell(unsigned int const cell) const
 {
   Base::reinit_cell(cell);
 
+  // the linearization is read from the cache in do_cell_integral()
+  if(cache_linearization)
+    return;
+
   integrator_lin->reinit(cell);
 
   integrator_lin->read_dof_values_plain(displacement_lin);
@@ -233,26 +310,35 @@ NonLinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) co
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
+  unsigned int const cell = integrator.get_current_cell_index();
+
   // loop over all quadrature points
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     // kinematics
     tensor const Grad_delta = integrator.get_gradient(q);
 
-    tensor const F_lin = get_F<dim, Number>(integrator_lin->get_gradient(q));
+    tensor F_lin, S_lin;
+    if(cache_linearization)
+    {
+      F_lin = F_lin_cache(cell, q);
+      S_lin = S_lin_cache(cell, q);
+    }
+    else
+    {
+      F_lin = get_F<dim, Number>(integrator_lin->get_gradient(q));
 
-    // Green-Lagrange strains
-    tensor const E_lin = get_E<dim, Number>(F_lin);
+      // Green-Lagrange strains
+      tensor const E_lin = get_E<dim, Number>(F_lin);
 
-    // 2nd Piola-Kirchhoff stresses
-    tensor const S_lin = material->evaluate_stress(E_lin, integrator.get_current_cell_index(), q);
+      // 2nd Piola-Kirchhoff stresses
+      S_lin = material->evaluate_stress(E_lin, cell, q);
+    }
 
     // directional derivative of 1st Piola-Kirchhoff stresses P
 
     // 1. elastic and initial displacement stiffness contributions
-    tensor delta_P =
-      F_lin *
-      material->apply_C(transpose(F_lin) * Grad_delta, integrator.get_current_cell_index(), q);
+    tensor delta_P = F_lin * material->apply_C(transpose(F_lin) * Grad_delta, cell, q);
 
     // 2. geometric (or initial stress) stiffness contribution
     delta_P += Grad_delta * S_lin;
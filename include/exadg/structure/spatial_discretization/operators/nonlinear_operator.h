@@ -22,6 +22,10 @@
 #ifndef INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 
+// deal.II
+#include <deal.II/base/table.h>
+
+// ExaDG
 #include <exadg/structure/spatial_discretization/operators/elasticity_operator_base.h>
 
 namespace ExaDG
@@ -67,7 +71,28 @@ public:
   VectorType const &
   get_solution_linearization() const;
 
+  /*
+   * Switches between evaluating the linearization (deformation gradient and stresses) on the
+   * fly in every application of the linearized operator and computing it once in
+   * set_solution_linearization() and storing it in every quadrature point.
+   */
+  void
+  set_cache_linearization(bool const cache) const;
+
 private:
+  /*
+   * Computes and stores the deformation gradient F(d_lin) and the 2nd Piola-Kirchhoff stresses
+   * S(d_lin) in all quadrature points.
+   */
+  void
+  compute_linearization_cache() const;
+
+  void
+  cell_loop_linearization_cache(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                VectorType &                            dst,
+                                VectorType const &                      src,
+                                Range const &                           range) const;
+
   /*
    * Non-linear operator.
    */
@@ -173,6 +198,12 @@ private:
 
   mutable std::shared_ptr<IntegratorCell> integrator_lin;
   mutable VectorType                      displacement_lin;
+
+  // linearization stored per cell batch and quadrature point (only used if
+  // cache_linearization is true)
+  mutable bool                     cache_linearization;
+  mutable dealii::Table<2, tensor> F_lin_cache;
+  mutable dealii::Table<2, tensor> S_lin_cache;
 };
 
 } // namespace Structure
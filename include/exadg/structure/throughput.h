@@ -79,13 +79,13 @@ create_input_file(std::string const & input_file)
 
 template<int dim, typename Number>
 void
-run(ThroughputParameters const & throughput,
-    std::string const &          input_file,
-    unsigned int const           degree,
-    unsigned int const           refine_space,
-    unsigned int const           n_cells_1d,
-    MPI_Comm const &             mpi_comm,
-    bool const                   is_test)
+run(std::vector<ThroughputParameters> const & throughputs,
+    std::string const &                       input_file,
+    unsigned int const                        degree,
+    unsigned int const                        refine_space,
+    unsigned int const                        n_cells_1d,
+    MPI_Comm const &                          mpi_comm,
+    bool const                                is_test)
 {
   std::shared_ptr<Structure::ApplicationBase<dim, Number>> application =
     Structure::get_application<dim, Number>(input_file, mpi_comm);
@@ -97,12 +97,15 @@ run(ThroughputParameters const & throughput,
 
   driver->setup();
 
-  std::tuple<unsigned int, dealii::types::global_dof_index, double> wall_time =
-    driver->apply_operator(throughput.operator_type,
-                           throughput.n_repetitions_inner,
-                           throughput.n_repetitions_outer);
+  for(auto const & throughput : throughputs)
+  {
+    std::tuple<unsigned int, dealii::types::global_dof_index, double> wall_time =
+      driver->apply_operator(throughput.operator_type,
+                             throughput.n_repetitions_inner,
+                             throughput.n_repetitions_outer);
 
-  throughput.wall_times.push_back(wall_time);
+    throughput.wall_times.push_back(wall_time);
+  }
 }
 } // namespace ExaDG
 
@@ -148,6 +151,15 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
   ExaDG::ThroughputParameters          throughput(input_file);
 
+  // the linearized operator is measured both with and without caching the linearization in
+  // the quadrature points to report the speed-up obtained at the price of additional memory
+  std::vector<ExaDG::ThroughputParameters> throughputs = {throughput};
+  if(throughput.operator_type == "Linearized")
+  {
+    throughputs.push_back(throughput);
+    throughputs.back().operator_type = "LinearizedCached";
+  }
+
   // fill resolution vector depending on the operator_type
   resolution.fill_resolution_vector(&ExaDG::Structure::get_dofs_per_element, input_file);
 
@@ -160,23 +172,26 @@ main(int argc, char ** argv)
 
     if(general.dim == 2 && general.precision == "float")
       ExaDG::run<2, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+        throughputs, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
     else if(general.dim == 2 && general.precision == "double")
       ExaDG::run<2, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+        throughputs, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
     else if(general.dim == 3 && general.precision == "float")
       ExaDG::run<3, float>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+        throughputs, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
     else if(general.dim == 3 && general.precision == "double")
       ExaDG::run<3, double>(
-        throughput, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
+        throughputs, input_file, degree, refine_space, n_cells_1d, mpi_comm, general.is_test);
     else
       AssertThrow(false,
                   dealii::ExcMessage("Only dim = 2|3 and precision = float|double implemented."));
   }
 
   if(not(general.is_test))
-    throughput.print_results(mpi_comm);
+  {
+    for(auto const & throughput_i : throughputs)
+      throughput_i.print_results(mpi_comm);
+  }
 
 #ifdef EXADG_WITH_LIKWID
   LIKWID_MARKER_CLOSE;
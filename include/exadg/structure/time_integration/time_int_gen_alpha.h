@@ -99,6 +99,9 @@ public:
   void
   advance_one_timestep_partitioned_solve(bool const use_extrapolation);
 
+  bool
+  print_solver_info() const final;
+
 private:
   void
   do_timestep_solve() final;
@@ -115,9 +118,6 @@ private:
   void
   postprocessing() const final;
 
-  bool
-  print_solver_info() const final;
-
   std::shared_ptr<Interface::Operator<Number>> pde_operator;
 
   std::shared_ptr<PostProcessorBase<Number>> postprocessor;
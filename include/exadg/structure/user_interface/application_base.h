@@ -80,6 +80,7 @@ public:
     boundary_descriptor = std::make_shared<BoundaryDescriptor<dim>>();
     set_boundary_descriptor();
     verify_boundary_conditions(*boundary_descriptor, *grid);
+    boundary_descriptor->set_vectorized_functions();
 
     // material
     material_descriptor = std::make_shared<MaterialDescriptor>();
@@ -29,6 +29,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/function_cached.h>
+#include <exadg/functions_and_boundary_conditions/function_vectorized.h>
 
 namespace ExaDG
 {
@@ -63,6 +64,19 @@ struct BoundaryDescriptor
   // is required for fluid-structure interaction problems)
   std::map<dealii::types::boundary_id, std::shared_ptr<FunctionCached<1, dim>>> neumann_cached_bc;
 
+  // Vectorized representation of neumann_bc evaluated by the matrix-free kernels, see
+  // set_vectorized_functions(). The Dirichlet values are only interpolated during setup and
+  // therefore do not need a vectorized representation.
+  std::map<dealii::types::boundary_id, std::shared_ptr<FunctionVectorized<dim>>>
+    neumann_bc_vectorized;
+
+  // has to be called once all boundary conditions have been prescribed
+  void
+  set_vectorized_functions()
+  {
+    neumann_bc_vectorized = make_function_vectorized(neumann_bc);
+  }
+
   inline DEAL_II_ALWAYS_INLINE //
     BoundaryType
     get_boundary_type(dealii::types::boundary_id const & boundary_id) const
@@ -70,6 +70,7 @@ Parameters::Parameters()
     update_preconditioner(false),
     update_preconditioner_every_time_steps(1),
     update_preconditioner_every_newton_iterations(10),
+    cache_linearization(false),
     multigrid_data(MultigridData())
 {
 }
@@ -199,6 +200,7 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
   {
     pcout << std::endl << "Newton:" << std::endl;
     newton_solver_data.print(pcout);
+    print_parameter(pcout, "Cache linearization", cache_linearization);
   }
 
   // linear solver
@@ -205,6 +205,11 @@ public:
   // ... every Newton iterations
   unsigned int update_preconditioner_every_newton_iterations;
 
+  // only relevant for nonlinear problems: store the deformation gradient and the stresses at
+  // the point of linearization in all quadrature points instead of recomputing them in every
+  // application of the linearized operator (trades memory for speed)
+  bool cache_linearization;
+
   // description: see declaration of MultigridData
   MultigridData multigrid_data;
 };
@@ -22,6 +22,13 @@
 #ifndef INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 #define INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 
+// C/C++
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
 namespace ExaDG
 {
 template<typename Operator, typename VectorType>
@@ -650,6 +657,82 @@ private:
 };
 
 
+/*
+ *  Coefficients of the low-storage Runge-Kutta schemes of Toulorge & Desmet (2011), see
+ *  class LowStorageRKTD below.
+ */
+inline void
+get_coefficients_low_storage_rk_td(std::vector<double> & A,
+                                   std::vector<double> & B,
+                                   std::vector<double> & c,
+                                   unsigned int const    order,
+                                   unsigned int const    stages)
+{
+  A.resize(stages);
+  B.resize(stages);
+  c.resize(stages);
+
+  if(order == 3 && stages == 7)
+  {
+    A[0] = 0.;
+    A[1] = -0.8083163874983830;
+    A[2] = -1.503407858773331;
+    A[3] = -1.053064525050744;
+    A[4] = -1.463149119280508;
+    A[5] = -0.6592881281087830;
+    A[6] = -1.667891931891068;
+
+    B[0] = 0.01197052673097840;
+    B[1] = 0.8886897793820711;
+    B[2] = 0.4578382089261419;
+    B[3] = 0.5790045253338471;
+    B[4] = 0.3160214638138484;
+    B[5] = 0.2483525368264122;
+    B[6] = 0.06771230959408840;
+
+    c[0] = 0.;
+    c[1] = 0.01197052673097840;
+    c[2] = 0.1823177940361990;
+    c[3] = 0.5082168062551849;
+    c[4] = 0.6532031220148590;
+    c[5] = 0.8534401385678250;
+    c[6] = 0.9980466084623790;
+  }
+  else if(order == 4 && stages == 8)
+  {
+    A[0] = 0.;
+    A[1] = -0.7212962482279240;
+    A[2] = -0.01077336571612980;
+    A[3] = -0.5162584698930970;
+    A[4] = -1.730100286632201;
+    A[5] = -5.200129304403076;
+    A[6] = 0.7837058945416420;
+    A[7] = -0.5445836094332190;
+
+    B[0] = 0.2165936736758085;
+    B[1] = 0.1773950826411583;
+    B[2] = 0.01802538611623290;
+    B[3] = 0.08473476372541490;
+    B[4] = 0.8129106974622483;
+    B[5] = 1.903416030422760;
+    B[6] = 0.1314841743399048;
+    B[7] = 0.2082583170674149;
+
+    c[0] = 0.;
+    c[1] = 0.2165936736758085;
+    c[2] = 0.2660343487538170;
+    c[3] = 0.2840056122522720;
+    c[4] = 0.3251266843788570;
+    c[5] = 0.4555149599187530;
+    c[6] = 0.7713219317101170;
+    c[7] = 0.9199028964538660;
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
 /*
  *  Explicit Runge-Kutta of Toulorge & Desmet (2011) in low-storage format (2N scheme)
  *  of order q with additional stages s>q in order to optimize the stability region of
@@ -680,82 +763,242 @@ public:
       vec_tmp.reinit(vec_np);
     }
 
-    std::vector<double> A;
-    A.resize(stages);
-    std::vector<double> B;
-    B.resize(stages);
-    std::vector<double> c;
-    c.resize(stages);
+    std::vector<double> A, B, c;
+    get_coefficients_low_storage_rk_td(A, B, c, order, stages);
+
+    // loop over all stages
+    for(unsigned int s = 0; s < stages; s++)
+    {
+      this->underlying_operator->evaluate(vec_np, vec_n, time + c[s] * time_step);
+      vec_tmp.sadd(A[s], time_step, vec_np);
+      vec_n.add(B[s], vec_tmp);
+    }
+
+    vec_np = vec_n;
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+private:
+  VectorType   vec_tmp;
+  unsigned int order;
+  unsigned int stages;
+};
 
-    if(order == 3 && stages == 7)
+/*
+ *  Low-storage Runge-Kutta methods with 2 registers of Kennedy et al. (2000), i.e., the
+ *  schemes RK3(2)4[2R+]C, RK4(3)5[2R+]C, and RK5(4)9[2R+]S implemented above, in a variant
+ *  where the vector updates of each stage are fused with the evaluation of the operator.
+ *  The operator has to provide a function evaluate_fused() calling a vector update
+ *  function on index ranges of the result, so that each stage reads and writes every
+ *  vector only once.
+ */
+template<typename Operator, typename VectorType>
+class LowStorageRKReg2Fused : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+public:
+  LowStorageRKReg2Fused(std::shared_ptr<Operator> const operator_in,
+                        unsigned int const              order_in,
+                        unsigned int const              stages_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), order(order_in), stages(stages_in)
+  {
+    // subdiagonal a_{s+1,s} of the Butcher table (the last entry is unused) and weights b_s
+    if(order == 3 && stages == 4)
     {
-      A[0] = 0.;
-      A[1] = -0.8083163874983830;
-      A[2] = -1.503407858773331;
-      A[3] = -1.053064525050744;
-      A[4] = -1.463149119280508;
-      A[5] = -0.6592881281087830;
-      A[6] = -1.667891931891068;
-
-      B[0] = 0.01197052673097840;
-      B[1] = 0.8886897793820711;
-      B[2] = 0.4578382089261419;
-      B[3] = 0.5790045253338471;
-      B[4] = 0.3160214638138484;
-      B[5] = 0.2483525368264122;
-      B[6] = 0.06771230959408840;
-
-      c[0] = 0.;
-      c[1] = 0.01197052673097840;
-      c[2] = 0.1823177940361990;
-      c[3] = 0.5082168062551849;
-      c[4] = 0.6532031220148590;
-      c[5] = 0.8534401385678250;
-      c[6] = 0.9980466084623790;
+      a = {11847461282814. / 36547543011857.,
+           3943225443063. / 7078155732230.,
+           -346793006927. / 4029903576067.,
+           0.};
+
+      b = {1017324711453. / 9774461848756.,
+           8237718856693. / 13685301971492.,
+           57731312506979. / 19404895981398.,
+           -101169746363290. / 37734290219643.};
     }
-    else if(order == 4 && stages == 8)
+    else if(order == 4 && stages == 5)
     {
-      A[0] = 0.;
-      A[1] = -0.7212962482279240;
-      A[2] = -0.01077336571612980;
-      A[3] = -0.5162584698930970;
-      A[4] = -1.730100286632201;
-      A[5] = -5.200129304403076;
-      A[6] = 0.7837058945416420;
-      A[7] = -0.5445836094332190;
-
-      B[0] = 0.2165936736758085;
-      B[1] = 0.1773950826411583;
-      B[2] = 0.01802538611623290;
-      B[3] = 0.08473476372541490;
-      B[4] = 0.8129106974622483;
-      B[5] = 1.903416030422760;
-      B[6] = 0.1314841743399048;
-      B[7] = 0.2082583170674149;
-
-      c[0] = 0.;
-      c[1] = 0.2165936736758085;
-      c[2] = 0.2660343487538170;
-      c[3] = 0.2840056122522720;
-      c[4] = 0.3251266843788570;
-      c[5] = 0.4555149599187530;
-      c[6] = 0.7713219317101170;
-      c[7] = 0.9199028964538660;
+      a = {970286171893. / 4311952581923.,
+           6584761158862. / 12103376702013.,
+           2251764453980. / 15575788980749.,
+           26877169314380. / 34165994151039.,
+           0.};
+
+      b = {1153189308089. / 22510343858157.,
+           1772645290293. / 4653164025191.,
+           -1672844663538. / 4480602732383.,
+           2114624349019. / 3568978502595.,
+           5198255086312. / 14908931495163.};
+    }
+    else if(order == 5 && stages == 9)
+    {
+      a = {1107026461565. / 5417078080134.,
+           38141181049399. / 41724347789894.,
+           493273079041. / 11940823631197.,
+           1851571280403. / 6147804934346.,
+           11782306865191. / 62590030070788.,
+           9452544825720. / 13648368537481.,
+           4435885630781. / 26285702406235.,
+           2357909744247. / 11371140753790.,
+           0.};
+
+      b = {2274579626619. / 23610510767302.,
+           693987741272. / 12394497460941.,
+           -347131529483. / 15096185902911.,
+           1144057200723. / 32081666971178.,
+           1562491064753. / 11797114684756.,
+           13113619727965. / 44346030145118.,
+           393957816125. / 7825732611452.,
+           720647959663. / 6565743875477.,
+           3559252274877. / 14424734981077.};
     }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
 
+    // c_1 = 0, c_s = b_1 + ... + b_{s-2} + a_{s,s-1}
+    c.resize(stages, 0.);
+    double sum_b = 0.;
+    for(unsigned int s = 1; s < stages; ++s)
+    {
+      c[s] = sum_b + a[s - 1];
+      sum_b += b[s - 1];
+    }
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    if(!vec_tmp.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      vec_tmp.reinit(vec_np, true);
+    }
+
+    // vec_n contains the current stage u_s and vec_np accumulates the solution u_p
+    for(unsigned int s = 0; s < stages; ++s)
+    {
+      // u_p = u_n in the first stage
+      VectorType const & vec_p_old = (s == 0) ? vec_n : vec_np;
+
+      Number const factor_p     = b[s] * time_step;
+      Number const factor_stage = a[s] * time_step;
+      bool const   last_stage   = (s == stages - 1);
+
+      this->underlying_operator->evaluate_fused(
+        vec_tmp /* F_s */,
+        vec_n /* u_s */,
+        time + c[s] * time_step,
+        [&](unsigned int const start_range, unsigned int const end_range) {
+          Number const * F       = vec_tmp.begin();
+          Number const * u_p_old = vec_p_old.begin();
+          Number *       u_p     = vec_np.begin();
+          Number *       u_stage = vec_n.begin();
+
+          if(last_stage)
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for(unsigned int i = start_range; i < end_range; ++i)
+              u_p[i] = u_p_old[i] + factor_p * F[i];
+          }
+          else
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for(unsigned int i = start_range; i < end_range; ++i)
+            {
+              Number const F_i   = F[i];
+              Number const u_p_i = u_p_old[i];
+
+              u_p[i]     = u_p_i + factor_p * F_i;     /* = u_p */
+              u_stage[i] = u_p_i + factor_stage * F_i; /* = u_{s+1} */
+            }
+          }
+        });
+    }
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+private:
+  VectorType vec_tmp;
+
+  unsigned int order;
+  unsigned int stages;
+
+  std::vector<double> a, b, c;
+};
+
+/*
+ *  Low-storage Runge-Kutta methods of Toulorge & Desmet (2011), see class LowStorageRKTD,
+ *  with the vector updates of each stage fused with the evaluation of the operator, see
+ *  class LowStorageRKReg2Fused.
+ */
+template<typename Operator, typename VectorType>
+class LowStorageRKTDFused : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+public:
+  LowStorageRKTDFused(std::shared_ptr<Operator> const operator_in,
+                      unsigned int const              order_in,
+                      unsigned int const              stages_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), order(order_in), stages(stages_in)
+  {
+    get_coefficients_low_storage_rk_td(A, B, c, order, stages);
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    if(!vec_tmp.partitioners_are_globally_compatible(*vec_n.get_partitioner()))
+    {
+      vec_tmp.reinit(vec_np);
+    }
+
     // loop over all stages
     for(unsigned int s = 0; s < stages; s++)
     {
-      this->underlying_operator->evaluate(vec_np, vec_n, time + c[s] * time_step);
-      vec_tmp.sadd(A[s], time_step, vec_np);
-      vec_n.add(B[s], vec_tmp);
+      Number const factor_A = A[s];
+      Number const factor_B = B[s];
+      Number const dt       = time_step;
+
+      this->underlying_operator->evaluate_fused(
+        vec_np,
+        vec_n,
+        time + c[s] * time_step,
+        [&](unsigned int const start_range, unsigned int const end_range) {
+          Number const * F   = vec_np.begin();
+          Number *       tmp = vec_tmp.begin();
+          Number *       u   = vec_n.begin();
+
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for(unsigned int i = start_range; i < end_range; ++i)
+          {
+            tmp[i] = factor_A * tmp[i] + dt * F[i];
+            u[i] += factor_B * tmp[i];
+          }
+        });
     }
 
-    vec_np = vec_n;
+    // the caller only uses vec_np after the time step
+    vec_np.swap(vec_n);
   }
 
   unsigned int
@@ -765,9 +1008,12 @@ public:
   }
 
 private:
-  VectorType   vec_tmp;
+  VectorType vec_tmp;
+
   unsigned int order;
   unsigned int stages;
+
+  std::vector<double> A, B, c;
 };
 
 } // namespace ExaDG
@@ -42,6 +42,12 @@ restart_filename(std::string const & name, MPI_Comm const & mpi_comm)
   return filename;
 }
 
+inline std::string
+restart_filename_mpi_io(std::string const & name)
+{
+  return name + ".restart";
+}
+
 inline void
 rename_restart_files(std::string const & filename)
 {
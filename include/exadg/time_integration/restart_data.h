@@ -41,6 +41,9 @@ struct RestartData
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
       filename("restart"),
+      use_mpi_io(false),
+      compress(false),
+      asynchronous(false),
       counter(1)
   {
   }
@@ -57,6 +60,10 @@ struct RestartData
       print_parameter(pcout, "Interval wall time", interval_wall_time);
       print_parameter(pcout, "Interval time steps", interval_time_steps);
       print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Use MPI-IO", use_mpi_io);
+      if(use_mpi_io)
+        print_parameter(pcout, "Compress", compress);
+      print_parameter(pcout, "Asynchronous", asynchronous);
     }
   }
 
@@ -96,6 +103,20 @@ struct RestartData
   // filename for restart files
   std::string filename;
 
+  // write (and read) a single restart file collectively by all processes using MPI-IO instead
+  // of one file per process. Such restart files can be read on a different number of
+  // processes.
+  bool use_mpi_io;
+
+  // compress the vectors stored in restart files written with MPI-IO (lossless)
+  bool compress;
+
+  // write restart files in the background while the time integration continues. The data is
+  // copied into staging buffers, and the files are written by non-blocking MPI-IO (use_mpi_io
+  // = true) or by a separate thread (one file per process). A restart is completed before the
+  // next one is started.
+  bool asynchronous;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 };
@@ -0,0 +1,559 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/grid/cell_id.h>
+
+// ExaDG
+#include <exadg/time_integration/restart_file.h>
+
+namespace ExaDG
+{
+namespace
+{
+struct FileHeader
+{
+  char          magic[8];
+  std::uint64_t version;
+  std::uint64_t compressed;
+  std::uint64_t dof_numbering_checksum;
+};
+
+struct VectorHeader
+{
+  std::uint64_t size;
+  std::uint64_t bytes_per_entry;
+  std::uint64_t n_chunks;
+};
+
+// the entries [first_index, first_index + n_entries) of a vector stored at position
+// file_offset in the file using n_bytes bytes
+struct ChunkInfo
+{
+  std::uint64_t first_index;
+  std::uint64_t n_entries;
+  std::uint64_t file_offset;
+  std::uint64_t n_bytes;
+};
+
+char const          magic[8]       = {'E', 'X', 'A', 'D', 'G', 'R', 'S', 'T'};
+std::uint64_t const format_version = 2;
+
+int
+to_mpi_count(std::uint64_t const n_bytes)
+{
+  AssertThrow(n_bytes <= static_cast<std::uint64_t>(std::numeric_limits<int>::max()),
+              dealii::ExcMessage("Restart files do not support more than 2 GB per process and "
+                                 "vector."));
+
+  return static_cast<int>(n_bytes);
+}
+
+/*
+ * Shuffle the bytes such that the i-th bytes of all entries are contiguous in memory, which
+ * improves the compression ratio for floating point numbers.
+ */
+template<typename Number>
+std::string
+compress_entries(Number const * entries, std::uint64_t const n_entries)
+{
+  std::string shuffled(n_entries * sizeof(Number), '\0');
+
+  char const * bytes = reinterpret_cast<char const *>(entries);
+  for(std::uint64_t i = 0; i < n_entries; ++i)
+    for(unsigned int b = 0; b < sizeof(Number); ++b)
+      shuffled[b * n_entries + i] = bytes[i * sizeof(Number) + b];
+
+  return dealii::Utilities::compress(shuffled);
+}
+
+template<typename Number>
+std::vector<Number>
+decompress_entries(std::string const & compressed, std::uint64_t const n_entries)
+{
+  std::string const shuffled = dealii::Utilities::decompress(compressed);
+
+  AssertThrow(shuffled.size() == n_entries * sizeof(Number),
+              dealii::ExcMessage("Invalid size of decompressed data in restart file."));
+
+  std::vector<Number> entries(n_entries);
+
+  char * bytes = reinterpret_cast<char *>(entries.data());
+  for(std::uint64_t i = 0; i < n_entries; ++i)
+    for(unsigned int b = 0; b < sizeof(Number); ++b)
+      bytes[i * sizeof(Number) + b] = shuffled[b * n_entries + i];
+
+  return entries;
+}
+
+// 64-bit FNV-1a hash, which does not depend on the compiler or the standard library
+std::uint64_t
+hash_bytes(void const * data, std::size_t const n_bytes, std::uint64_t hash)
+{
+  unsigned char const * bytes = static_cast<unsigned char const *>(data);
+  for(std::size_t i = 0; i < n_bytes; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+} // namespace
+
+RestartFileWriter::RestartFileWriter(std::string const & filename,
+                                     MPI_Comm const &    mpi_comm_in,
+                                     std::uint64_t const dof_numbering_checksum,
+                                     bool const          compress_in,
+                                     bool const          asynchronous_in)
+  : mpi_comm(mpi_comm_in), compress(compress_in), asynchronous(asynchronous_in), offset(0)
+{
+  int ierr = MPI_File_open(
+    mpi_comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  AssertThrow(ierr == MPI_SUCCESS,
+              dealii::ExcMessage("Could not open file " + filename + " for writing."));
+
+  // discard the content of a file that might already exist
+  ierr = MPI_File_set_size(file, 0);
+  AssertThrowMPI(ierr);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    FileHeader header;
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version    = format_version;
+    header.compressed = compress ? 1 : 0;
+
+    header.dof_numbering_checksum = dof_numbering_checksum;
+
+    write_at(0, &header, sizeof(header), false);
+  }
+
+  offset = sizeof(FileHeader);
+}
+
+RestartFileWriter::~RestartFileWriter()
+{
+  if(not(requests.empty()))
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  MPI_File_close(&file);
+}
+
+void
+RestartFileWriter::write_preamble(std::string const & preamble)
+{
+  std::uint64_t size = preamble.size();
+
+  int ierr = MPI_Bcast(&size, 1, MPI_UINT64_T, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    write_at(offset, &size, sizeof(size), false);
+    write_at(offset + sizeof(size), preamble.data(), size, false);
+  }
+
+  offset += sizeof(size) + size;
+}
+
+template<typename Number>
+void
+RestartFileWriter::write_vector(dealii::LinearAlgebra::distributed::Vector<Number> const & vector)
+{
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  auto const local_range = vector.get_partitioner()->local_range();
+
+  ChunkInfo chunk;
+  chunk.first_index = local_range.first;
+  chunk.n_entries   = local_range.second - local_range.first;
+
+  std::string compressed_entries;
+  if(compress)
+  {
+    compressed_entries = compress_entries(vector.begin(), chunk.n_entries);
+    chunk.n_bytes      = compressed_entries.size();
+  }
+  else
+  {
+    chunk.n_bytes = chunk.n_entries * sizeof(Number);
+  }
+
+  // the chunks are stored in the order of the MPI ranks after the chunk table
+  std::uint64_t const data_begin = offset + sizeof(VectorHeader) + n_ranks * sizeof(ChunkInfo);
+
+  std::uint64_t chunk_offset = 0;
+  int ierr = MPI_Exscan(&chunk.n_bytes, &chunk_offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  // the result of MPI_Exscan is undefined on the first rank
+  if(rank == 0)
+    chunk_offset = 0;
+
+  chunk.file_offset = data_begin + chunk_offset;
+
+  if(rank == 0)
+  {
+    VectorHeader header;
+    header.size            = vector.size();
+    header.bytes_per_entry = sizeof(Number);
+    header.n_chunks        = n_ranks;
+
+    write_at(offset, &header, sizeof(header), false);
+  }
+
+  write_at(offset + sizeof(VectorHeader) + rank * sizeof(ChunkInfo),
+           &chunk,
+           sizeof(chunk),
+           true);
+
+  // uncompressed data is taken directly from the memory of the vector
+  if(compress)
+    write_at(chunk.file_offset, std::move(compressed_entries), true);
+  else
+    write_at(chunk.file_offset, vector.begin(), chunk.n_bytes, true);
+
+  std::uint64_t n_bytes_total = 0;
+  ierr = MPI_Allreduce(&chunk.n_bytes, &n_bytes_total, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  offset = data_begin + n_bytes_total;
+}
+
+bool
+RestartFileWriter::test()
+{
+  int completed = 1;
+
+  if(not(requests.empty()))
+  {
+    int const ierr =
+      MPI_Testall(requests.size(), requests.data(), &completed, MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  return completed != 0;
+}
+
+void
+RestartFileWriter::wait()
+{
+  if(not(requests.empty()))
+  {
+    int const ierr = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  requests.clear();
+  staging_buffers.clear();
+}
+
+void
+RestartFileWriter::write_at(std::uint64_t const position,
+                            void const *        data,
+                            std::uint64_t const n_bytes,
+                            bool const          collective)
+{
+  if(asynchronous)
+  {
+    // the data might change before the write has completed
+    write_at(position, std::string(static_cast<char const *>(data), n_bytes), collective);
+  }
+  else
+  {
+    int ierr = 0;
+    if(collective)
+      ierr = MPI_File_write_at_all(
+        file, position, data, to_mpi_count(n_bytes), MPI_BYTE, MPI_STATUS_IGNORE);
+    else
+      ierr =
+        MPI_File_write_at(file, position, data, to_mpi_count(n_bytes), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+}
+
+void
+RestartFileWriter::write_at(std::uint64_t const position,
+                            std::string &&      buffer,
+                            bool const          collective)
+{
+  if(asynchronous)
+  {
+    // Non-blocking writes are always independent since collective non-blocking I/O requires
+    // MPI 3.1.
+    staging_buffers.push_back(std::move(buffer));
+    std::string const & staged = staging_buffers.back();
+
+    MPI_Request request;
+    int const   ierr = MPI_File_iwrite_at(
+      file, position, staged.data(), to_mpi_count(staged.size()), MPI_BYTE, &request);
+    AssertThrowMPI(ierr);
+
+    requests.push_back(request);
+  }
+  else
+  {
+    write_at(position, buffer.data(), buffer.size(), collective);
+  }
+}
+
+RestartFileReader::RestartFileReader(std::string const & filename,
+                                     MPI_Comm const &    mpi_comm_in,
+                                     std::uint64_t const dof_numbering_checksum)
+  : mpi_comm(mpi_comm_in), compressed(false), offset(0)
+{
+  int ierr = MPI_File_open(mpi_comm, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  // the header is read by the first rank and then broadcast to all other ranks
+  FileHeader header;
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    ierr = MPI_File_read_at(file, 0, &header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  ierr = MPI_Bcast(&header, sizeof(header), MPI_BYTE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  AssertThrow(std::memcmp(header.magic, magic, sizeof(magic)) == 0,
+              dealii::ExcMessage("File " + filename + " is not a collective restart file."));
+
+  AssertThrow(header.version == format_version,
+              dealii::ExcMessage("Unsupported version of restart file " + filename + "."));
+
+  // close the file before throwing, since the destructor is not called in this case
+  bool const same_numbering = (header.dof_numbering_checksum == dof_numbering_checksum);
+  if(not(same_numbering))
+    MPI_File_close(&file);
+
+  AssertThrow(same_numbering,
+              dealii::ExcMessage(
+                "The numbering of the unknowns differs from the one used to write the restart "
+                "file " + filename + ". This happens if the mesh has changed or if the "
+                "numbering depends on the partitioning of the mesh, which might be the case when "
+                "restarting on a different number of processes."));
+
+  compressed = (header.compressed == 1);
+
+  offset = sizeof(FileHeader);
+}
+
+RestartFileReader::~RestartFileReader()
+{
+  MPI_File_close(&file);
+}
+
+std::string
+RestartFileReader::read_preamble()
+{
+  bool const is_first_rank = (dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  std::uint64_t size = 0;
+  if(is_first_rank)
+  {
+    int ierr = MPI_File_read_at(file, offset, &size, sizeof(size), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  int ierr = MPI_Bcast(&size, 1, MPI_UINT64_T, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  std::string preamble(size, '\0');
+  if(is_first_rank)
+  {
+    ierr = MPI_File_read_at(file,
+                            offset + sizeof(size),
+                            &preamble[0],
+                            to_mpi_count(size),
+                            MPI_BYTE,
+                            MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  ierr = MPI_Bcast(&preamble[0], to_mpi_count(size), MPI_BYTE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  offset += sizeof(size) + size;
+
+  return preamble;
+}
+
+template<typename Number>
+void
+RestartFileReader::read_vector(dealii::LinearAlgebra::distributed::Vector<Number> & vector)
+{
+  bool const is_first_rank = (dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  // header and chunk table are read by the first rank and then broadcast to all other ranks
+  VectorHeader header;
+  if(is_first_rank)
+  {
+    int ierr = MPI_File_read_at(file, offset, &header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  int ierr = MPI_Bcast(&header, sizeof(header), MPI_BYTE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  AssertThrow(header.size == vector.size(),
+              dealii::ExcMessage("Size of vector in restart file (" +
+                                 dealii::Utilities::to_string(header.size) +
+                                 ") does not match size of vector (" +
+                                 dealii::Utilities::to_string(vector.size()) + ")."));
+
+  AssertThrow(header.bytes_per_entry == sizeof(Number),
+              dealii::ExcMessage("Restart file has been written with a different precision."));
+
+  std::vector<ChunkInfo> chunks(header.n_chunks);
+  if(is_first_rank)
+  {
+    ierr = MPI_File_read_at(file,
+                            offset + sizeof(VectorHeader),
+                            chunks.data(),
+                            to_mpi_count(chunks.size() * sizeof(ChunkInfo)),
+                            MPI_BYTE,
+                            MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  ierr = MPI_Bcast(
+    chunks.data(), to_mpi_count(chunks.size() * sizeof(ChunkInfo)), MPI_BYTE, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  // read those parts of the chunks that overlap with the locally owned range
+  vector.zero_out_ghost_values();
+
+  auto const local_range = vector.get_partitioner()->local_range();
+
+  std::uint64_t n_entries_read = 0;
+  for(ChunkInfo const & chunk : chunks)
+  {
+    std::uint64_t const begin = std::max<std::uint64_t>(chunk.first_index, local_range.first);
+    std::uint64_t const end =
+      std::min<std::uint64_t>(chunk.first_index + chunk.n_entries, local_range.second);
+
+    if(begin >= end)
+      continue;
+
+    Number * dst = vector.begin() + (begin - local_range.first);
+
+    if(compressed)
+    {
+      std::string buffer(chunk.n_bytes, '\0');
+      ierr = MPI_File_read_at(file,
+                              chunk.file_offset,
+                              &buffer[0],
+                              to_mpi_count(chunk.n_bytes),
+                              MPI_BYTE,
+                              MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      std::vector<Number> const entries = decompress_entries<Number>(buffer, chunk.n_entries);
+
+      std::copy(entries.begin() + (begin - chunk.first_index),
+                entries.begin() + (end - chunk.first_index),
+                dst);
+    }
+    else
+    {
+      ierr = MPI_File_read_at(file,
+                              chunk.file_offset + (begin - chunk.first_index) * sizeof(Number),
+                              dst,
+                              to_mpi_count((end - begin) * sizeof(Number)),
+                              MPI_BYTE,
+                              MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+
+    n_entries_read += end - begin;
+  }
+
+  AssertThrow(n_entries_read == local_range.second - local_range.first,
+              dealii::ExcMessage("Restart file does not contain all entries of the vector."));
+
+  offset = chunks.back().file_offset + chunks.back().n_bytes;
+}
+
+template<int dim>
+std::uint64_t
+compute_dof_numbering_checksum(dealii::DoFHandler<dim> const & dof_handler)
+{
+  std::uint64_t checksum = 0;
+
+  std::vector<dealii::types::global_dof_index> dof_indices;
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+      cell->get_dof_indices(dof_indices);
+
+      auto const cell_id = cell->id().template to_binary<dim>();
+
+      std::uint64_t hash = hash_bytes(cell_id.data(), sizeof(cell_id), 14695981039346656037ULL);
+      for(auto const index : dof_indices)
+      {
+        std::uint64_t const index_64 = index;
+        hash                         = hash_bytes(&index_64, sizeof(index_64), hash);
+      }
+
+      // the sum does not depend on the order of the cells
+      checksum += hash;
+    }
+  }
+
+  std::uint64_t checksum_global = 0;
+  int const     ierr            = MPI_Allreduce(
+    &checksum, &checksum_global, 1, MPI_UINT64_T, MPI_SUM, dof_handler.get_communicator());
+  AssertThrowMPI(ierr);
+
+  return checksum_global;
+}
+
+template void
+RestartFileWriter::write_vector(dealii::LinearAlgebra::distributed::Vector<float> const &);
+template void
+RestartFileWriter::write_vector(dealii::LinearAlgebra::distributed::Vector<double> const &);
+
+template void
+RestartFileReader::read_vector(dealii::LinearAlgebra::distributed::Vector<float> &);
+template void
+RestartFileReader::read_vector(dealii::LinearAlgebra::distributed::Vector<double> &);
+
+template std::uint64_t
+compute_dof_numbering_checksum(dealii::DoFHandler<2> const &);
+template std::uint64_t
+compute_dof_numbering_checksum(dealii::DoFHandler<3> const &);
+
+} // namespace ExaDG
@@ -0,0 +1,243 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_RESTART_FILE_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_RESTART_FILE_H_
+
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Restart file written collectively by all MPI processes into a single file by means of
+ * MPI-IO. The file consists of a preamble (scalar data like the time or time step sizes,
+ * serialized by the caller) followed by a sequence of distributed vectors. The locally owned
+ * entries of a vector are written directly from the memory of the vector, i.e., without an
+ * intermediate copy, into a chunk of the file. A table of all chunks (global index range,
+ * position in the file) is stored in front of the data of each vector so that the vector can
+ * be read back on a different number of processes, see RestartFileReader. The file header
+ * contains a checksum of the DoF numbering, see compute_dof_numbering_checksum().
+ *
+ * Optionally, the chunks are compressed losslessly (the bytes of the entries are shuffled
+ * such that equal bytes of different numbers are adjacent, and then compressed by zlib if
+ * deal.II has been configured with zlib).
+ *
+ * In asynchronous mode, all data is copied into staging buffers owned by the writer and
+ * written by non-blocking MPI-IO operations, so that the caller can modify the vectors
+ * immediately. The writes are completed by wait() or at the latest in the destructor. Since
+ * the destructor closes the file, it has to be called collectively.
+ */
+class RestartFileWriter
+{
+public:
+  RestartFileWriter(std::string const & filename,
+                    MPI_Comm const &    mpi_comm,
+                    std::uint64_t const dof_numbering_checksum,
+                    bool const          compress,
+                    bool const          asynchronous);
+
+  ~RestartFileWriter();
+
+  /*
+   * Writes the preamble. Only the data provided by the process with rank 0 is written. This
+   * function has to be called before writing vectors.
+   */
+  void
+  write_preamble(std::string const & preamble);
+
+  template<typename Number>
+  void
+  write_vector(dealii::LinearAlgebra::distributed::Vector<Number> const & vector);
+
+  /*
+   * Returns whether all asynchronous writes of this process have completed. This function
+   * does not block and can be called regularly to let the MPI library make progress.
+   */
+  bool
+  test();
+
+  /*
+   * Waits until all asynchronous writes of this process have completed.
+   */
+  void
+  wait();
+
+private:
+  /*
+   * Writes n_bytes bytes starting at data into the file at the given position. The write is
+   * collective if all processes call this function.
+   */
+  void
+  write_at(std::uint64_t const position,
+           void const *        data,
+           std::uint64_t const n_bytes,
+           bool const          collective);
+
+  /*
+   * Same as above, but the data is provided in a buffer that can be used as staging buffer
+   * without copying in asynchronous mode.
+   */
+  void
+  write_at(std::uint64_t const position, std::string && buffer, bool const collective);
+
+  MPI_Comm const mpi_comm;
+
+  bool const compress;
+
+  bool const asynchronous;
+
+  MPI_File file;
+
+  // position in the file where the next block of data is written
+  std::uint64_t offset;
+
+  // asynchronous mode: data to be written and requests of pending writes
+  std::list<std::string>   staging_buffers;
+  std::vector<MPI_Request> requests;
+};
+
+/*
+ * Reads restart files written by RestartFileWriter. Every process reads the chunks that
+ * overlap with the locally owned range of the vector to be filled. This allows to restart on
+ * a different number of processes, provided that the global numbering of the unknowns is the
+ * same as when writing the file. Whether this is the case depends on the triangulation (e.g.,
+ * a fully distributed triangulation partitioned by a graph partitioner numbers the cells
+ * differently for a different number of processes). Therefore, the checksum of the DoF
+ * numbering stored in the file is compared with @param dof_numbering_checksum and an
+ * exception is thrown if they differ.
+ */
+class RestartFileReader
+{
+public:
+  RestartFileReader(std::string const & filename,
+                    MPI_Comm const &    mpi_comm,
+                    std::uint64_t const dof_numbering_checksum);
+
+  ~RestartFileReader();
+
+  std::string
+  read_preamble();
+
+  template<typename Number>
+  void
+  read_vector(dealii::LinearAlgebra::distributed::Vector<Number> & vector);
+
+private:
+  MPI_Comm const mpi_comm;
+
+  bool compressed;
+
+  MPI_File file;
+
+  // position in the file where the next block of data is read from
+  std::uint64_t offset;
+};
+
+/*
+ * Returns a checksum of the DoF numbering of @param dof_handler that does not depend on the
+ * parallel partitioning: the hashes of the CellId and the DoF indices of all locally owned
+ * cells are summed over all processes. Two DoFHandlers on the same mesh have the same checksum
+ * if and only if (up to hash collisions) every cell has the same DoF indices.
+ */
+template<int dim>
+std::uint64_t
+compute_dof_numbering_checksum(dealii::DoFHandler<dim> const & dof_handler);
+
+/*
+ * Thin wrappers used by the time integrators to write/read the solution vectors needed for
+ * a restart either to/from a boost archive (one file per process) or to/from a
+ * RestartFileWriter/RestartFileReader (one file written collectively by all processes).
+ */
+template<typename VectorType>
+class RestartOutputArchive
+{
+public:
+  explicit RestartOutputArchive(boost::archive::binary_oarchive & archive_in)
+    : archive(&archive_in), writer(nullptr)
+  {
+  }
+
+  explicit RestartOutputArchive(RestartFileWriter & writer_in)
+    : archive(nullptr), writer(&writer_in)
+  {
+  }
+
+  RestartOutputArchive &
+  operator<<(VectorType const & vector)
+  {
+    if(writer != nullptr)
+      writer->write_vector(vector);
+    else
+      *archive << vector;
+
+    return *this;
+  }
+
+private:
+  boost::archive::binary_oarchive * archive;
+  RestartFileWriter *               writer;
+};
+
+template<typename VectorType>
+class RestartInputArchive
+{
+public:
+  explicit RestartInputArchive(boost::archive::binary_iarchive & archive_in)
+    : archive(&archive_in), reader(nullptr)
+  {
+  }
+
+  explicit RestartInputArchive(RestartFileReader & reader_in)
+    : archive(nullptr), reader(&reader_in)
+  {
+  }
+
+  RestartInputArchive &
+  operator>>(VectorType & vector)
+  {
+    if(reader != nullptr)
+      reader->read_vector(vector);
+    else
+      *archive >> vector;
+
+    return *this;
+  }
+
+private:
+  boost::archive::binary_iarchive * archive;
+  RestartFileReader *               reader;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_RESTART_FILE_H_ */
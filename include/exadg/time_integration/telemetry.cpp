@@ -0,0 +1,260 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <tuple>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/utilities.h>
+
+// ExaDG
+#include <exadg/time_integration/telemetry.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+TelemetrySink::TelemetrySink(TelemetryData const & data_in,
+                             bool const            append_in,
+                             MPI_Comm const &      mpi_comm_in)
+  : active(data_in.write_telemetry),
+    data(data_in),
+    append(append_in),
+    mpi_comm(mpi_comm_in),
+    is_root(dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
+    record_open(false),
+    n_buffered_records(0),
+    file_initialized(false)
+{
+  if(active)
+  {
+    AssertThrow(data.flush_interval > 0,
+                dealii::ExcMessage("The flush interval of the telemetry has to be positive."));
+
+    create_directories(data.directory, mpi_comm);
+  }
+
+  column_time_step      = register_column("time_step");
+  column_time           = register_column("time");
+  column_time_step_size = register_column("time_step_size");
+  column_wall_time      = register_column("wall_time");
+  column_memory         = register_column("memory_high_water_mark_MB");
+}
+
+TelemetrySink::~TelemetrySink()
+{
+  try
+  {
+    flush();
+  }
+  catch(std::exception const & exc)
+  {
+    std::cerr << "Writing the telemetry file failed: " << exc.what() << std::endl;
+  }
+}
+
+bool
+TelemetrySink::is_active() const
+{
+  return active;
+}
+
+unsigned int
+TelemetrySink::register_column(std::string const & name)
+{
+  AssertThrow(not file_initialized,
+              dealii::ExcMessage("Telemetry column " + name +
+                                 " registered after the first record has been written."));
+
+  for(unsigned int i = 0; i < columns.size(); ++i)
+    if(columns[i] == name)
+      return i;
+
+  columns.push_back(name);
+  record.push_back(std::numeric_limits<double>::quiet_NaN());
+
+  return columns.size() - 1;
+}
+
+TelemetrySink::SolveColumns
+TelemetrySink::register_solve(std::string const & name)
+{
+  SolveColumns solve_columns;
+
+  solve_columns.iterations             = register_column(name + "_iterations");
+  solve_columns.wall_time              = register_column(name + "_wall_time");
+  solve_columns.preconditioner_updates = register_column(name + "_preconditioner_updates");
+
+  return solve_columns;
+}
+
+void
+TelemetrySink::begin_record(unsigned int const time_step_number,
+                            double const       time,
+                            double const       time_step_size)
+{
+  if(not active)
+    return;
+
+  std::fill(record.begin(), record.end(), std::numeric_limits<double>::quiet_NaN());
+  record_open = true;
+
+  record[column_time_step]      = time_step_number;
+  record[column_time]           = time;
+  record[column_time_step_size] = time_step_size;
+
+  timer.restart();
+}
+
+void
+TelemetrySink::set(unsigned int const column, double const value)
+{
+  if(not(active and record_open))
+    return;
+
+  record[column] = value;
+}
+
+void
+TelemetrySink::add(unsigned int const column, double const value)
+{
+  if(not(active and record_open))
+    return;
+
+  record[column] = std::isnan(record[column]) ? value : record[column] + value;
+}
+
+void
+TelemetrySink::add_solve(SolveColumns const & solve_columns,
+                         unsigned int const   n_iterations,
+                         double const         wall_time,
+                         bool const           update_preconditioner)
+{
+  add(solve_columns.iterations, n_iterations);
+  add(solve_columns.wall_time, wall_time);
+  add(solve_columns.preconditioner_updates, update_preconditioner ? 1.0 : 0.0);
+}
+
+void
+TelemetrySink::end_record()
+{
+  if(not(active and record_open))
+    return;
+
+  record[column_wall_time] = timer.wall_time();
+
+  record_open = false;
+
+  if(is_root)
+    buffered_records.push_back(record);
+
+  if(++n_buffered_records >= data.flush_interval)
+    flush();
+}
+
+void
+TelemetrySink::flush()
+{
+  if(not active or n_buffered_records == 0)
+    return;
+
+  dealii::Utilities::System::MemoryStats stats;
+  dealii::Utilities::System::get_memory_stats(stats);
+  double const memory = dealii::Utilities::MPI::max(stats.VmHWM / 1024.0, mpi_comm);
+
+  if(is_root)
+  {
+    buffered_records.back()[column_memory] = memory;
+
+    std::string const header = get_header();
+
+    bool append_to_file = true;
+    if(not file_initialized)
+      std::tie(filename, append_to_file) = get_filename(header);
+
+    std::ofstream f(filename, std::ios::out | (append_to_file ? std::ios::app : std::ios::trunc));
+    AssertThrow(f.good(), dealii::ExcMessage("Could not open file " + filename + "."));
+
+    if(not append_to_file)
+      f << header << "\n";
+
+    f << std::setprecision(12);
+    for(auto const & buffered_record : buffered_records)
+    {
+      for(unsigned int i = 0; i < buffered_record.size(); ++i)
+      {
+        if(i > 0)
+          f << ",";
+        if(not std::isnan(buffered_record[i]))
+          f << buffered_record[i];
+      }
+      f << "\n";
+    }
+    f.flush();
+
+    buffered_records.clear();
+  }
+
+  file_initialized   = true;
+  n_buffered_records = 0;
+}
+
+std::string
+TelemetrySink::get_header() const
+{
+  std::string header;
+  for(unsigned int i = 0; i < columns.size(); ++i)
+    header += (i > 0 ? "," : "") + columns[i];
+
+  return header;
+}
+
+std::pair<std::string, bool>
+TelemetrySink::get_filename(std::string const & header) const
+{
+  std::string const basename = data.directory + data.filename;
+
+  if(not append)
+    return {basename + ".csv", false};
+
+  // append to the first file with the same columns, do not overwrite files with other columns
+  for(unsigned int suffix = 0;; ++suffix)
+  {
+    std::string const name =
+      basename + (suffix > 0 ? "_" + std::to_string(suffix) : std::string()) + ".csv";
+
+    std::ifstream existing(name);
+    if(not existing.good())
+      return {name, false};
+
+    std::string first_line;
+    if(std::getline(existing, first_line) and first_line == header)
+      return {name, true};
+  }
+}
+
+} // namespace ExaDG
@@ -0,0 +1,192 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_TELEMETRY_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_TELEMETRY_H_
+
+// C/C++
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+struct TelemetryData
+{
+  TelemetryData()
+    : write_telemetry(false), directory("output/"), filename("telemetry"), flush_interval(100)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << "  Telemetry:" << std::endl;
+    print_parameter(pcout, "Write telemetry", write_telemetry);
+
+    if(write_telemetry == true)
+    {
+      print_parameter(pcout, "Directory", directory);
+      print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Flush interval", flush_interval);
+    }
+  }
+
+  // write one record per time step to the file directory + filename + ".csv"
+  bool write_telemetry;
+
+  std::string directory;
+  std::string filename;
+
+  // number of records buffered before they are written to file
+  unsigned int flush_interval;
+};
+
+/*
+ *  Writes one record per time step with performance data (time step size, wall time, memory
+ *  high-water mark, iterations and wall times of the solvers, preconditioner updates, etc.) to a
+ *  CSV file, which allows to monitor the performance of long simulations while they are running.
+ *
+ *  The columns are registered by the time integrators during setup. In each time step, a record
+ *  is opened by begin_record(), filled by the sub-steps of the time integrator, and closed by
+ *  end_record(). Columns that have not been set in a time step remain empty. The records are
+ *  buffered and written by rank 0 only, every flush_interval time steps and on destruction.
+ *
+ *  The memory high-water mark is sampled and reduced over all processes only when flushing, and
+ *  is written to the last buffered record. Since the high-water mark is non-decreasing, this value
+ *  bounds the memory usage of all preceding records.
+ *
+ *  When continuing a simulation from a restart, the records are appended to an existing file with
+ *  the same columns. If the columns of the existing file differ, the records are written to a new
+ *  file with the suffix _1, _2, etc. instead of overwriting the existing file.
+ */
+class TelemetrySink
+{
+public:
+  // columns of a linear or nonlinear solve: accumulated iterations, wall time, and number of
+  // preconditioner updates in the current time step
+  struct SolveColumns
+  {
+    unsigned int iterations;
+    unsigned int wall_time;
+    unsigned int preconditioner_updates;
+  };
+
+  TelemetrySink(TelemetryData const & data, bool const append, MPI_Comm const & mpi_comm);
+
+  ~TelemetrySink();
+
+  bool
+  is_active() const;
+
+  /*
+   * Registers a column and returns its index. Columns have to be registered before the first
+   * record is written to file.
+   */
+  unsigned int
+  register_column(std::string const & name);
+
+  /*
+   * Registers the columns name_iterations, name_wall_time, and name_preconditioner_updates.
+   */
+  SolveColumns
+  register_solve(std::string const & name);
+
+  void
+  begin_record(unsigned int const time_step_number, double const time, double const time_step_size);
+
+  void
+  set(unsigned int const column, double const value);
+
+  void
+  add(unsigned int const column, double const value);
+
+  void
+  add_solve(SolveColumns const & columns,
+            unsigned int const   n_iterations,
+            double const         wall_time,
+            bool const           update_preconditioner);
+
+  /*
+   * Completes the current record by the wall time of the time step. Has to be called by all
+   * processes.
+   */
+  void
+  end_record();
+
+  /*
+   * Completes the last buffered record by the maximum memory high-water mark over all processes
+   * and writes the buffered records to file. Has to be called by all processes.
+   */
+  void
+  flush();
+
+private:
+  std::string
+  get_header() const;
+
+  /*
+   * Returns the file the records are written to, and whether records are appended to this file.
+   */
+  std::pair<std::string, bool>
+  get_filename(std::string const & header) const;
+
+  bool const active;
+
+  TelemetryData const data;
+
+  bool const append;
+
+  MPI_Comm const mpi_comm;
+
+  bool const is_root;
+
+  std::vector<std::string> columns;
+
+  unsigned int column_time_step, column_time, column_time_step_size, column_wall_time,
+    column_memory;
+
+  // values of the current record, NaN if not set
+  std::vector<double> record;
+  bool                record_open;
+
+  dealii::Timer timer;
+
+  // records buffered on rank 0
+  std::vector<std::vector<double>> buffered_records;
+  unsigned int                     n_buffered_records;
+
+  // the file is chosen and the header is written (unless appending) by the first flush
+  bool        file_initialized;
+  std::string filename;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_TELEMETRY_H_ */
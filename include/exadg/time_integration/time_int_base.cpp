@@ -40,8 +40,29 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
     restart_data(restart_data_),
     mpi_comm(mpi_comm_),
     timer_tree(new TimerTree()),
-    is_test(is_test_)
+    is_test(is_test_),
+    telemetry(std::make_shared<TelemetrySink>(TelemetryData(), false, mpi_comm_)),
+    dof_numbering_checksum(0),
+    dof_numbering_checksum_is_set(false)
 {
+  Profiler & profiler = Profiler::instance();
+
+  region_timeloop   = profiler.register_region("Timeloop");
+  region_pre_solve  = profiler.register_region("Pre-solve", region_timeloop);
+  region_solve      = profiler.register_region("Solve", region_timeloop);
+  region_post_solve = profiler.register_region("Post-solve", region_timeloop);
+}
+
+TimeIntBase::~TimeIntBase()
+{
+  try
+  {
+    finish_restart();
+  }
+  catch(std::exception const & exc)
+  {
+    std::cerr << "Writing the last restart file failed: " << exc.what() << std::endl;
+  }
 }
 
 bool
@@ -59,6 +80,8 @@ TimeIntBase::finished() const
 void
 TimeIntBase::timeloop()
 {
+  Profiler::Scope scope(region_timeloop);
+
   while(!finished())
   {
     advance_one_timestep();
@@ -78,6 +101,8 @@ TimeIntBase::advance_one_timestep()
 void
 TimeIntBase::advance_one_timestep_pre_solve(bool const print_header)
 {
+  Profiler::Scope scope(region_pre_solve);
+
   dealii::Timer timer;
   timer.restart();
 
@@ -92,6 +117,8 @@ TimeIntBase::advance_one_timestep_pre_solve(bool const print_header)
       postprocessing();
     }
 
+    telemetry->begin_record(time_step_number, time, get_time_step_size());
+
     do_timestep_pre_solve(print_header);
   }
 
@@ -101,6 +128,8 @@ TimeIntBase::advance_one_timestep_pre_solve(bool const print_header)
 void
 TimeIntBase::advance_one_timestep_solve()
 {
+  Profiler::Scope scope(region_solve);
+
   dealii::Timer timer;
   timer.restart();
 
@@ -115,14 +144,21 @@ TimeIntBase::advance_one_timestep_solve()
 void
 TimeIntBase::advance_one_timestep_post_solve()
 {
+  Profiler::Scope scope(region_post_solve);
+
   dealii::Timer timer;
   timer.restart();
 
   if(started() && !finished())
   {
+    if(telemetry->is_active())
+      record_telemetry();
+
     do_timestep_post_solve();
 
     postprocessing();
+
+    telemetry->end_record();
   }
   else
   {
@@ -169,6 +205,13 @@ TimeIntBase::get_timings() const
   return timer_tree;
 }
 
+void
+TimeIntBase::set_dof_numbering_checksum(std::uint64_t const checksum)
+{
+  dof_numbering_checksum        = checksum;
+  dof_numbering_checksum_is_set = true;
+}
+
 void
 TimeIntBase::do_timestep()
 {
@@ -190,6 +233,10 @@ TimeIntBase::write_restart() const
 {
   double const wall_time = global_timer.wall_time();
 
+  // let the MPI library make progress with pending asynchronous writes
+  if(restart_writer)
+    restart_writer->test();
+
   if(restart_data.do_restart(wall_time, time - start_time, time_step_number, time_step_number == 2))
   {
     pcout << std::endl
@@ -197,16 +244,94 @@ TimeIntBase::write_restart() const
           << std::endl
           << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
-    std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+    dealii::Timer timer;
+    timer.restart();
+
+    // the previous restart file has to be complete before it is renamed
+    finish_restart();
+
+    double const wait_time = timer.wall_time();
+
+    if(restart_data.use_mpi_io)
+    {
+      std::string const filename = restart_filename_mpi_io(restart_data.filename);
+
+      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+        rename_restart_files(filename);
+
+      int const ierr = MPI_Barrier(mpi_comm);
+      AssertThrowMPI(ierr);
+
+      AssertThrow(dof_numbering_checksum_is_set,
+                  dealii::ExcMessage("Restart files written with MPI-IO require a checksum of "
+                                     "the DoF numbering, see set_dof_numbering_checksum()."));
+
+      std::unique_ptr<RestartFileWriter> writer =
+        std::make_unique<RestartFileWriter>(filename,
+                                            mpi_comm,
+                                            dof_numbering_checksum,
+                                            restart_data.compress,
+                                            restart_data.asynchronous);
+
+      do_write_restart_mpi_io(*writer);
+
+      // an asynchronous writer is kept alive until its writes have completed
+      if(restart_data.asynchronous)
+        restart_writer = std::move(writer);
+    }
+    else
+    {
+      std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+
+      rename_restart_files(filename);
+
+      do_write_restart(filename);
+    }
 
-    rename_restart_files(filename);
+    double const total_time = timer.wall_time();
 
-    do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+    timer_tree->insert({"Timeloop", "Restart", "Wait"}, wait_time);
+    timer_tree->insert({"Timeloop", "Restart", "Write"}, total_time - wait_time);
+    timer_tree->insert({"Timeloop", "Restart"}, total_time);
 
     pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
   }
 }
 
+void
+TimeIntBase::store_restart_file(std::ostringstream & oss, std::string const & filename) const
+{
+  if(restart_data.asynchronous)
+  {
+    // The thread must not call MPI functions, since MPI is not necessarily initialized with
+    // support for multiple threads.
+    restart_file_task = std::async(std::launch::async, [buffer = oss.str(), filename]() {
+      std::ofstream stream(filename.c_str());
+      AssertThrow(stream, dealii::ExcMessage("Could not open file " + filename + "."));
+
+      stream << buffer << std::endl;
+    });
+  }
+  else
+  {
+    write_restart_file(oss, filename);
+  }
+}
+
+void
+TimeIntBase::finish_restart() const
+{
+  // rethrows exceptions of the thread
+  if(restart_file_task.valid())
+    restart_file_task.get();
+
+  if(restart_writer)
+  {
+    restart_writer->wait();
+    restart_writer.reset();
+  }
+}
+
 void
 TimeIntBase::read_restart()
 {
@@ -215,11 +340,25 @@ TimeIntBase::read_restart()
         << std::endl
         << " Reading restart file:" << std::endl;
 
-  std::string   filename = restart_filename(restart_data.filename, mpi_comm);
-  std::ifstream in(filename);
-  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+  if(restart_data.use_mpi_io)
+  {
+    AssertThrow(dof_numbering_checksum_is_set,
+                dealii::ExcMessage("Restart files written with MPI-IO require a checksum of the "
+                                   "DoF numbering, see set_dof_numbering_checksum()."));
+
+    RestartFileReader reader(restart_filename_mpi_io(restart_data.filename),
+                             mpi_comm,
+                             dof_numbering_checksum);
+    do_read_restart_mpi_io(reader);
+  }
+  else
+  {
+    std::string   filename = restart_filename(restart_data.filename, mpi_comm);
+    std::ifstream in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
 
-  do_read_restart(in);
+    do_read_restart(in);
+  }
 
   pcout << std::endl
         << " ... done!" << std::endl
@@ -227,6 +366,24 @@ TimeIntBase::read_restart()
         << std::endl;
 }
 
+void
+TimeIntBase::do_write_restart_mpi_io(RestartFileWriter & writer) const
+{
+  (void)writer;
+  AssertThrow(false,
+              dealii::ExcMessage("Restart files written with MPI-IO are not implemented for this "
+                                 "time integrator."));
+}
+
+void
+TimeIntBase::do_read_restart_mpi_io(RestartFileReader & reader)
+{
+  (void)reader;
+  AssertThrow(false,
+              dealii::ExcMessage("Restart files written with MPI-IO are not implemented for this "
+                                 "time integrator."));
+}
+
 void
 TimeIntBase::output_solver_info_header() const
 {
@@ -27,6 +27,8 @@
 #include <boost/archive/binary_oarchive.hpp>
 
 #include <fstream>
+#include <future>
+#include <memory>
 #include <sstream>
 
 // deal.II
@@ -36,6 +38,9 @@
 // ExaDG
 #include <exadg/time_integration/restart.h>
 #include <exadg/time_integration/restart_data.h>
+#include <exadg/time_integration/restart_file.h>
+#include <exadg/time_integration/telemetry.h>
+#include <exadg/utilities/profiler.h>
 #include <exadg/utilities/timer_tree.h>
 
 
@@ -51,9 +56,7 @@ public:
               MPI_Comm const &    mpi_comm_,
               bool const          is_test_);
 
-  virtual ~TimeIntBase()
-  {
-  }
+  virtual ~TimeIntBase();
 
   /*
    * Setup of time integration scheme.
@@ -137,6 +140,14 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const;
 
+  /*
+   * Sets the checksum of the DoF numbering, see compute_dof_numbering_checksum(), that is
+   * stored in restart files written with MPI-IO and compared when reading them. This function
+   * has to be called before setup() if restart files are written or read with MPI-IO.
+   */
+  void
+  set_dof_numbering_checksum(std::uint64_t const checksum);
+
 protected:
   /*
    * Do one time step including pre and post routines done before and after the actual solution of
@@ -173,6 +184,15 @@ protected:
   virtual void
   postprocessing() const = 0;
 
+  /*
+   * Adds data of the current time step to the telemetry record, e.g. the CFL number. Called after
+   * the solution of the time step and only if telemetry is active.
+   */
+  virtual void
+  record_telemetry()
+  {
+  }
+
   /*
    * Get the current time step number.
    */
@@ -192,6 +212,13 @@ protected:
   void
   read_restart();
 
+  /*
+   * Stores the restart data of this process collected in oss in a file. In asynchronous mode,
+   * the data is copied and the file is written by a separate thread.
+   */
+  void
+  store_restart_file(std::ostringstream & oss, std::string const & filename) const;
+
   /*
    * Output solver information before solving the time step.
    */
@@ -252,7 +279,37 @@ protected:
   std::shared_ptr<TimerTree> timer_tree;
   bool                       is_test;
 
+  /*
+   * Profiler regions of the time loop.
+   */
+  Profiler::RegionID region_timeloop, region_pre_solve, region_solve, region_post_solve;
+
+  /*
+   * Per-time-step performance telemetry. Inactive by default, derived classes replace it by an
+   * active sink and register additional columns during setup.
+   */
+  std::shared_ptr<TelemetrySink> telemetry;
+
 private:
+  /*
+   * Waits until a restart file written asynchronously is complete.
+   */
+  void
+  finish_restart() const;
+
+  /*
+   * Asynchronous restart: pending writes of the previous restart, either of the MPI-IO writer
+   * or of the thread writing the file of this process.
+   */
+  mutable std::unique_ptr<RestartFileWriter> restart_writer;
+  mutable std::future<void>                  restart_file_task;
+
+  /*
+   * Checksum of the DoF numbering for restart files written with MPI-IO.
+   */
+  std::uint64_t dof_numbering_checksum;
+  bool          dof_numbering_checksum_is_set;
+
   /*
    * Write restart data.
    */
@@ -264,6 +321,18 @@ private:
    */
   virtual void
   do_read_restart(std::ifstream & in) = 0;
+
+  /*
+   * Write restart data into a single file shared by all processes (MPI-IO).
+   */
+  virtual void
+  do_write_restart_mpi_io(RestartFileWriter & writer) const;
+
+  /*
+   * Read restart data from a single file shared by all processes (MPI-IO).
+   */
+  virtual void
+  do_read_restart_mpi_io(RestartFileReader & reader);
 };
 
 } // namespace ExaDG
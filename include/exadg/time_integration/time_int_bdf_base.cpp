@@ -280,7 +280,9 @@ TimeIntBDFBase<Number>::do_read_restart(std::ifstream & in)
 {
   boost::archive::binary_iarchive ia(in);
   read_restart_preamble(ia);
-  read_restart_vectors(ia);
+
+  RestartInputArchive<VectorType> archive(ia);
+  read_restart_vectors(archive);
 
   // In order to change the CFL number (or the time step calculation criterion in general),
   // start_with_low_order = true has to be used. Otherwise, the old solutions would not fit the
@@ -289,6 +291,24 @@ TimeIntBDFBase<Number>::do_read_restart(std::ifstream & in)
     time_steps[0] = calculate_time_step_size();
 }
 
+template<typename Number>
+void
+TimeIntBDFBase<Number>::do_read_restart_mpi_io(RestartFileReader & reader)
+{
+  {
+    std::istringstream              iss(reader.read_preamble());
+    boost::archive::binary_iarchive ia(iss);
+    read_restart_preamble(ia);
+  }
+
+  RestartInputArchive<VectorType> archive(reader);
+  read_restart_vectors(archive);
+
+  // see do_read_restart()
+  if(start_with_low_order == true)
+    time_steps[0] = calculate_time_step_size();
+}
+
 template<typename Number>
 void
 TimeIntBDFBase<Number>::read_restart_preamble(boost::archive::binary_iarchive & ia)
@@ -299,8 +319,10 @@ TimeIntBDFBase<Number>::read_restart_preamble(boost::archive::binary_iarchive &
   unsigned int n_old_ranks = 1;
   ia &         n_old_ranks;
 
+  // Restart files written with MPI-IO can be read on a different number of processes, provided
+  // that the DoF numbering is the same, which is checked by RestartFileReader.
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
+  AssertThrow(n_old_ranks == n_ranks or restart_data.use_mpi_io,
               dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
                                  " processes, "
                                  "but restart was written on " +
@@ -333,8 +355,26 @@ TimeIntBDFBase<Number>::do_write_restart(std::string const & filename) const
   boost::archive::binary_oarchive oa(oss);
 
   write_restart_preamble(oa);
-  write_restart_vectors(oa);
-  write_restart_file(oss, filename);
+
+  RestartOutputArchive<VectorType> archive(oa);
+  write_restart_vectors(archive);
+
+  this->store_restart_file(oss, filename);
+}
+
+template<typename Number>
+void
+TimeIntBDFBase<Number>::do_write_restart_mpi_io(RestartFileWriter & writer) const
+{
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    write_restart_preamble(oa);
+  }
+  writer.write_preamble(oss.str());
+
+  RestartOutputArchive<VectorType> archive(writer);
+  write_restart_vectors(archive);
 }
 
 template<typename Number>
@@ -225,8 +225,11 @@ private:
   void
   read_restart_preamble(boost::archive::binary_iarchive & ia);
 
+  void
+  do_read_restart_mpi_io(RestartFileReader & reader) final;
+
   virtual void
-  read_restart_vectors(boost::archive::binary_iarchive & ia) = 0;
+  read_restart_vectors(RestartInputArchive<VectorType> & ia) = 0;
 
   /*
    * Write solution vectors to files so that the simulation can be restart from an intermediate
@@ -238,8 +241,11 @@ private:
   void
   write_restart_preamble(boost::archive::binary_oarchive & oa) const;
 
+  void
+  do_write_restart_mpi_io(RestartFileWriter & writer) const final;
+
   virtual void
-  write_restart_vectors(boost::archive::binary_oarchive & oa) const = 0;
+  write_restart_vectors(RestartOutputArchive<VectorType> & oa) const = 0;
 
   /*
    * Recalculate the time step size after each time step in case of adaptive time stepping.
@@ -135,6 +135,85 @@ TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
 
   boost::archive::binary_oarchive oa(oss);
 
+  write_restart_preamble(oa);
+
+  // 4. solution vectors
+  oa << solution_n;
+
+  // 5. additional vectors
+  for(VectorType const * vector : get_additional_restart_vectors())
+    oa << *vector;
+
+  this->store_restart_file(oss, filename);
+}
+
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+{
+  boost::archive::binary_iarchive ia(in);
+
+  read_restart_preamble(ia);
+
+  // 4. solution vectors
+  ia >> solution_n;
+
+  // 5. additional vectors
+  std::vector<VectorType const *> const additional_vectors = get_additional_restart_vectors();
+  std::vector<VectorType>               vectors(additional_vectors.size());
+  for(unsigned int i = 0; i < vectors.size(); ++i)
+  {
+    vectors[i].reinit(*additional_vectors[i]);
+    ia >> vectors[i];
+  }
+  if(not vectors.empty())
+    set_additional_restart_vectors(vectors);
+}
+
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::do_write_restart_mpi_io(RestartFileWriter & writer) const
+{
+  std::ostringstream oss;
+  {
+    boost::archive::binary_oarchive oa(oss);
+    write_restart_preamble(oa);
+  }
+  writer.write_preamble(oss.str());
+
+  writer.write_vector(solution_n);
+
+  for(VectorType const * vector : get_additional_restart_vectors())
+    writer.write_vector(*vector);
+}
+
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::do_read_restart_mpi_io(RestartFileReader & reader)
+{
+  {
+    std::istringstream              iss(reader.read_preamble());
+    boost::archive::binary_iarchive ia(iss);
+    read_restart_preamble(ia);
+  }
+
+  reader.read_vector(solution_n);
+
+  std::vector<VectorType const *> const additional_vectors = get_additional_restart_vectors();
+  std::vector<VectorType>               vectors(additional_vectors.size());
+  for(unsigned int i = 0; i < vectors.size(); ++i)
+  {
+    vectors[i].reinit(*additional_vectors[i]);
+    reader.read_vector(vectors[i]);
+  }
+  if(not vectors.empty())
+    set_additional_restart_vectors(vectors);
+}
+
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::write_restart_preamble(boost::archive::binary_oarchive & oa) const
+{
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
 
   // 1. ranks
@@ -145,27 +224,22 @@ TimeIntExplRKBase<Number>::do_write_restart(std::string const & filename) const
 
   // 3. time step size
   oa & time_step;
-
-  // 4. solution vectors
-  oa << solution_n;
-
-  write_restart_file(oss, filename);
 }
 
 template<typename Number>
 void
-TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
+TimeIntExplRKBase<Number>::read_restart_preamble(boost::archive::binary_iarchive & ia)
 {
-  boost::archive::binary_iarchive ia(in);
-
   // Note that the operations done here must be in sync with the output.
 
   // 1. ranks
   unsigned int n_old_ranks = 1;
   ia &         n_old_ranks;
 
+  // Restart files written with MPI-IO can be read on a different number of processes, provided
+  // that the DoF numbering is the same, which is checked by RestartFileReader.
   unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
-  AssertThrow(n_old_ranks == n_ranks,
+  AssertThrow(n_old_ranks == n_ranks or this->restart_data.use_mpi_io,
               dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
                                  " processes, "
                                  "but restart was written on " +
@@ -180,9 +254,6 @@ TimeIntExplRKBase<Number>::do_read_restart(std::ifstream & in)
 
   // 3. time step size
   ia & time_step;
-
-  // 4. solution vectors
-  ia >> solution_n;
 }
 
 // instantiations
@@ -64,6 +64,25 @@ protected:
   bool const adaptive_time_stepping;
 
 private:
+  /*
+   * Vectors that are stored in restart files in addition to the solution vector.
+   */
+  virtual std::vector<VectorType const *>
+  get_additional_restart_vectors() const
+  {
+    return {};
+  }
+
+  /*
+   * Sets the additional vectors read from restart files, given in the same order as returned by
+   * get_additional_restart_vectors().
+   */
+  virtual void
+  set_additional_restart_vectors(std::vector<VectorType> const & vectors)
+  {
+    (void)vectors;
+  }
+
   void
   do_timestep_pre_solve(bool const print_header) final;
 
@@ -99,6 +118,18 @@ private:
 
   void
   do_read_restart(std::ifstream & in) final;
+
+  void
+  do_write_restart_mpi_io(RestartFileWriter & writer) const final;
+
+  void
+  do_read_restart_mpi_io(RestartFileReader & reader) final;
+
+  void
+  write_restart_preamble(boost::archive::binary_oarchive & oa) const;
+
+  void
+  read_restart_preamble(boost::archive::binary_iarchive & ia);
 };
 
 } // namespace ExaDG
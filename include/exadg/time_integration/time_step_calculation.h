@@ -238,12 +238,16 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
 }
 
 /*
- * Calculate time step size according to local CFL criterion where the velocity field is a numerical
- * solution field. The computed time step size corresponds to CFL = 1.0.
+ * Calculate time step size according to local CFL criterion for each cell batch, where the velocity
+ * field is a numerical solution field. Optionally, an isotropic wave speed given as a scalar
+ * numerical solution field (e.g. the speed of sound) is added to the transport velocity, where the
+ * wave speed is transformed to the reference cell by the norm of the inverse Jacobian. The
+ * computed time step sizes correspond to CFL = 1.0.
  */
 template<int dim, typename value_type>
-inline double
+inline void
 calculate_time_step_cfl_local(
+  dealii::AlignedVector<dealii::VectorizedArray<value_type>> &   time_step_cells,
   dealii::MatrixFree<dim, value_type> const &                    data,
   unsigned int const                                             dof_index,
   unsigned int const                                             quad_index,
@@ -251,14 +255,16 @@ calculate_time_step_cfl_local(
   unsigned int const                                             degree,
   double const                                                   exponent_fe_degree,
   CFLConditionType const                                         cfl_condition_type,
-  MPI_Comm const &                                               mpi_comm)
+  dealii::LinearAlgebra::distributed::Vector<value_type> const * wave_speed           = nullptr,
+  unsigned int const                                             dof_index_wave_speed = 0)
 {
   CellIntegrator<dim, dim, value_type> fe_eval(data, dof_index, quad_index);
-
-  double new_time_step = std::numeric_limits<double>::max();
+  CellIntegrator<dim, 1, value_type>   fe_eval_wave_speed(data, dof_index_wave_speed, quad_index);
 
   double const cfl_p = 1.0 / pow(degree, exponent_fe_degree);
 
+  time_step_cells.resize(data.n_cell_batches());
+
   // loop over cells of processor
   for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
   {
@@ -268,11 +274,19 @@ calculate_time_step_cfl_local(
     dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> invJ;
     dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> u_x;
     dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> ut_xi;
+    dealii::VectorizedArray<value_type>                         c = 0.0;
 
     fe_eval.reinit(cell);
     fe_eval.read_dof_values(velocity);
     fe_eval.evaluate(dealii::EvaluationFlags::values);
 
+    if(wave_speed != nullptr)
+    {
+      fe_eval_wave_speed.reinit(cell);
+      fe_eval_wave_speed.read_dof_values(*wave_speed);
+      fe_eval_wave_speed.evaluate(dealii::EvaluationFlags::values);
+    }
+
     // loop over quadrature points
     for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
     {
@@ -281,14 +295,18 @@ calculate_time_step_cfl_local(
       invJ  = transpose(invJ);
       ut_xi = invJ * u_x;
 
+      if(wave_speed != nullptr)
+        c = fe_eval_wave_speed.get_value(q);
+
       if(cfl_condition_type == CFLConditionType::VelocityNorm)
       {
-        delta_t_cell = std::min(delta_t_cell, cfl_p / ut_xi.norm());
+        delta_t_cell = std::min(delta_t_cell, cfl_p / (ut_xi.norm() + c * invJ.norm()));
       }
       else if(cfl_condition_type == CFLConditionType::VelocityComponents)
       {
         for(unsigned int d = 0; d < dim; ++d)
-          delta_t_cell = std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d])));
+          delta_t_cell =
+            std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d]) + c * invJ[d].norm()));
       }
       else
       {
@@ -296,11 +314,46 @@ calculate_time_step_cfl_local(
       }
     }
 
+    time_step_cells[cell] = delta_t_cell;
+  }
+}
+
+/*
+ * Calculate time step size according to local CFL criterion where the velocity field is a numerical
+ * solution field. The computed time step size corresponds to CFL = 1.0.
+ */
+template<int dim, typename value_type>
+inline double
+calculate_time_step_cfl_local(
+  dealii::MatrixFree<dim, value_type> const &                    data,
+  unsigned int const                                             dof_index,
+  unsigned int const                                             quad_index,
+  dealii::LinearAlgebra::distributed::Vector<value_type> const & velocity,
+  unsigned int const                                             degree,
+  double const                                                   exponent_fe_degree,
+  CFLConditionType const                                         cfl_condition_type,
+  MPI_Comm const &                                               mpi_comm)
+{
+  dealii::AlignedVector<dealii::VectorizedArray<value_type>> time_step_cells;
+  calculate_time_step_cfl_local(time_step_cells,
+                                data,
+                                dof_index,
+                                quad_index,
+                                velocity,
+                                degree,
+                                exponent_fe_degree,
+                                cfl_condition_type);
+
+  double new_time_step = std::numeric_limits<double>::max();
+
+  // loop over cells of processor
+  for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
+  {
     // loop over vectorized array
     double dt = std::numeric_limits<double>::max();
     for(unsigned int v = 0; v < dealii::VectorizedArray<value_type>::size(); ++v)
     {
-      dt = std::min(dt, (double)delta_t_cell[v]);
+      dt = std::min(dt, (double)time_step_cells[cell][v]);
     }
 
     new_time_step = std::min(new_time_step, dt);
@@ -323,6 +376,41 @@ calculate_time_step_cfl_local(
   return new_time_step;
 }
 
+/*
+ * Calculate time step size according to the diffusion number for each cell batch, where the mesh
+ * size is measured by the norm of the inverse Jacobian. The computed time step sizes correspond to
+ * a diffusion number of 1.0, see also calculate_const_time_step_diff().
+ */
+template<int dim, typename value_type>
+inline void
+calculate_time_step_diffusion_local(
+  dealii::AlignedVector<dealii::VectorizedArray<value_type>> & time_step_cells,
+  dealii::MatrixFree<dim, value_type> const &                  data,
+  unsigned int const                                           dof_index,
+  unsigned int const                                           quad_index,
+  double const                                                 diffusivity,
+  unsigned int const                                           degree,
+  double const                                                 exponent_fe_degree = 3.0)
+{
+  CellIntegrator<dim, 1, value_type> fe_eval(data, dof_index, quad_index);
+
+  double const diffusion_number_p = 1.0 / pow(degree, exponent_fe_degree);
+
+  time_step_cells.resize(data.n_cell_batches());
+
+  for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
+  {
+    dealii::VectorizedArray<value_type> inv_h_squared = 0.0;
+
+    fe_eval.reinit(cell);
+
+    for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
+      inv_h_squared = std::max(inv_h_squared, fe_eval.inverse_jacobian(q).norm_square());
+
+    time_step_cells[cell] = diffusion_number_p / (diffusivity * inv_h_squared);
+  }
+}
+
 /*
  * this function computes the actual CFL number in each cell given a global time step size
  * (that holds for all cells)
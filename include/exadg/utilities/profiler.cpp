@@ -0,0 +1,375 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <set>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/profiler.h>
+
+namespace ExaDG
+{
+namespace
+{
+std::string
+escape_json(std::string const & in)
+{
+  std::string out;
+  for(char const c : in)
+  {
+    if(c == '"' or c == '\\')
+      out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+std::vector<std::string>
+split_path(std::string const & path)
+{
+  std::vector<std::string> components;
+
+  std::stringstream stream(path);
+  std::string       component;
+  while(std::getline(stream, component, '/'))
+    components.push_back(component);
+
+  return components;
+}
+} // namespace
+
+Profiler::Profiler() : enabled(false), n_dropped_events(0), reference_time(Clock::now())
+{
+  // root region
+  regions.push_back({"", "", 0, 0, 0.0});
+}
+
+Profiler &
+Profiler::instance()
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+void
+Profiler::reinit(ProfilerParameters const & parameters_in, MPI_Comm const & mpi_comm)
+{
+  parameters = parameters_in;
+
+  enabled = parameters.enable;
+
+  reset(mpi_comm);
+}
+
+bool
+Profiler::is_enabled() const
+{
+  return enabled;
+}
+
+Profiler::RegionID
+Profiler::register_region(std::string const & name, RegionID const parent)
+{
+  AssertThrow(parent < regions.size(), dealii::ExcMessage("Invalid parent region."));
+  AssertThrow(not name.empty() and name.find('/') == std::string::npos,
+              dealii::ExcMessage("The name of a profiler region must be non-empty and must not "
+                                 "contain '/', but is '" +
+                                 name + "'."));
+
+  auto const it = region_ids.find(std::make_pair(parent, name));
+  if(it != region_ids.end())
+    return it->second;
+
+  Region region;
+  region.path      = (parent == root) ? name : regions[parent].path + "/" + name;
+  region.name      = name;
+  region.depth     = regions[parent].depth + 1;
+  region.n_calls   = 0;
+  region.wall_time = 0.0;
+
+  RegionID const id = regions.size();
+  regions.push_back(region);
+  region_ids.insert(std::make_pair(std::make_pair(parent, name), id));
+
+  return id;
+}
+
+Profiler::RegionID
+Profiler::register_unique_region(std::string const & name, RegionID const parent)
+{
+  std::string unique_name = name;
+  for(unsigned int i = 2; region_ids.count(std::make_pair(parent, unique_name)) > 0; ++i)
+    unique_name = name + " " + std::to_string(i);
+
+  return register_region(unique_name, parent);
+}
+
+void
+Profiler::add(RegionID const region, double const wall_time)
+{
+  if(not enabled)
+    return;
+
+  regions[region].n_calls += 1;
+  regions[region].wall_time += wall_time;
+}
+
+void
+Profiler::reset(MPI_Comm const & mpi_comm)
+{
+  for(auto & region : regions)
+  {
+    region.n_calls   = 0;
+    region.wall_time = 0.0;
+  }
+
+  events.clear();
+  n_dropped_events = 0;
+
+  if(enabled and parameters.trace)
+  {
+    events.reserve(parameters.max_trace_events);
+
+    // the clocks of different processes are not related, so the reference time is taken at the
+    // same point in time on all processes (up to the latency of the barrier)
+    int const ierr = MPI_Barrier(mpi_comm);
+    AssertThrowMPI(ierr);
+  }
+
+  reference_time = Clock::now();
+}
+
+std::vector<Profiler::Statistics>
+Profiler::compute_statistics(MPI_Comm const & mpi_comm) const
+{
+  // regions of all processes, sorted such that children follow their parent
+  std::vector<std::string> local_paths;
+  for(RegionID id = 1; id < regions.size(); ++id)
+    local_paths.push_back(regions[id].path);
+
+  std::vector<std::vector<std::string>> const all_paths =
+    dealii::Utilities::MPI::all_gather(mpi_comm, local_paths);
+
+  std::set<std::vector<std::string>> sorted_paths;
+  for(auto const & paths : all_paths)
+    for(auto const & path : paths)
+      sorted_paths.insert(split_path(path));
+
+  std::map<std::string, RegionID> local_ids;
+  for(RegionID id = 1; id < regions.size(); ++id)
+    local_ids.insert(std::make_pair(regions[id].path, id));
+
+  std::vector<Statistics> statistics;
+  std::vector<double>     wall_times, calls;
+  for(auto const & components : sorted_paths)
+  {
+    Statistics data;
+    data.name  = components.back();
+    data.depth = components.size();
+    data.path  = components[0];
+    for(unsigned int i = 1; i < components.size(); ++i)
+      data.path += "/" + components[i];
+    statistics.push_back(data);
+
+    auto const it = local_ids.find(data.path);
+    wall_times.push_back(it != local_ids.end() ? regions[it->second].wall_time : 0.0);
+    calls.push_back(it != local_ids.end() ? regions[it->second].n_calls : 0.0);
+  }
+
+  std::vector<dealii::Utilities::MPI::MinMaxAvg> const wall_time_statistics =
+    dealii::Utilities::MPI::min_max_avg(wall_times, mpi_comm);
+
+  std::vector<double> calls_sum(calls.size());
+  dealii::Utilities::MPI::sum(calls, mpi_comm, calls_sum);
+
+  double const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  for(unsigned int i = 0; i < statistics.size(); ++i)
+  {
+    statistics[i].wall_time = wall_time_statistics[i];
+    statistics[i].calls_avg = calls_sum[i] / n_processes;
+  }
+
+  return statistics;
+}
+
+void
+Profiler::print_summary(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_comm) const
+{
+  if(not enabled)
+    return;
+
+  std::vector<Statistics> const statistics = compute_statistics(mpi_comm);
+
+  unsigned int length = 6;
+  for(auto const & data : statistics)
+    length = std::max(length, static_cast<unsigned int>(2 * (data.depth - 1) + data.name.size()));
+
+  std::ostringstream stream;
+
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  stream << std::endl
+         << "Profiler (wall times in seconds over " << n_processes << " processes):" << std::endl
+         << std::endl;
+
+  stream << std::left << std::setw(length + 2) << "Region" << std::right << std::setw(12)
+         << "Calls" << std::setw(12) << "Min" << std::setw(12) << "Avg" << std::setw(12) << "Max"
+         << std::setw(12) << "Max/Avg" << std::setw(10) << "Max rank" << std::endl;
+
+  for(auto const & data : statistics)
+  {
+    double const imbalance =
+      data.wall_time.avg > 0.0 ? data.wall_time.max / data.wall_time.avg : 1.0;
+
+    stream << std::left << std::setw(length + 2)
+           << std::string(2 * (data.depth - 1), ' ') + data.name << std::right << std::fixed
+           << std::setprecision(0) << std::setw(12) << data.calls_avg << std::scientific
+           << std::setprecision(3) << std::setw(12) << data.wall_time.min << std::setw(12)
+           << data.wall_time.avg << std::setw(12) << data.wall_time.max << std::fixed
+           << std::setprecision(2) << std::setw(12) << imbalance << std::setw(10)
+           << data.wall_time.max_index << std::endl;
+  }
+
+  unsigned long long const n_dropped = dealii::Utilities::MPI::sum(n_dropped_events, mpi_comm);
+  if(n_dropped > 0)
+    stream << std::endl
+           << "Warning: " << n_dropped << " calls have not been recorded in the trace, "
+           << "increase MaxTraceEvents." << std::endl;
+
+  pcout << stream.str();
+}
+
+void
+Profiler::write_results(MPI_Comm const & mpi_comm) const
+{
+  if(not enabled)
+    return;
+
+  std::vector<Statistics> const statistics = compute_statistics(mpi_comm);
+
+  create_directories(parameters.directory, mpi_comm);
+
+  std::string const filename = parameters.directory + parameters.filename;
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    write_json(filename + ".json", statistics);
+
+  if(parameters.trace)
+    write_chrome_trace(filename + "_trace.json", mpi_comm);
+}
+
+void
+Profiler::write_json(std::string const & filename, std::vector<Statistics> const & statistics) const
+{
+  std::ofstream f(filename.c_str(), std::ios::trunc);
+  AssertThrow(f.good(), dealii::ExcMessage("Could not open file " + filename + "."));
+
+  f << std::setprecision(10);
+
+  f << "{" << std::endl << "  \"regions\": [" << std::endl;
+
+  for(unsigned int i = 0; i < statistics.size(); ++i)
+  {
+    Statistics const & data = statistics[i];
+
+    f << "    {\"path\": \"" << escape_json(data.path) << "\", \"calls\": " << data.calls_avg
+      << ", \"min\": " << data.wall_time.min << ", \"avg\": " << data.wall_time.avg
+      << ", \"max\": " << data.wall_time.max << ", \"min_rank\": " << data.wall_time.min_index
+      << ", \"max_rank\": " << data.wall_time.max_index << "}"
+      << (i + 1 < statistics.size() ? "," : "") << std::endl;
+  }
+
+  f << "  ]" << std::endl << "}" << std::endl;
+}
+
+void
+Profiler::write_chrome_trace(std::string const & filename, MPI_Comm const & mpi_comm) const
+{
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // every process formats its own calls, which are then written to disjoint parts of the file
+  std::ostringstream stream;
+
+  stream << std::fixed << std::setprecision(3);
+
+  if(rank == 0)
+    stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+  else
+    stream << ",\n";
+
+  stream << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << rank
+         << ", \"args\": {\"name\": \"rank " << rank << "\"}}";
+
+  for(auto const & event : events)
+  {
+    Region const & region = regions[event.region];
+
+    stream << ",\n{\"name\": \"" << escape_json(region.name) << "\", \"cat\": \""
+           << escape_json(region.path) << "\", \"ph\": \"X\", \"pid\": " << rank
+           << ", \"tid\": 0, \"ts\": " << event.start << ", \"dur\": " << event.duration << "}";
+  }
+
+  if(rank == n_ranks - 1)
+    stream << std::endl << "]}" << std::endl;
+
+  std::string const chunk = stream.str();
+
+  AssertThrow(chunk.size() <= static_cast<std::size_t>(std::numeric_limits<int>::max()),
+              dealii::ExcMessage("The trace of one process must not exceed 2 GB."));
+
+  // position of the chunk of this process in the file
+  std::uint64_t const n_bytes = chunk.size();
+  std::uint64_t       offset  = 0;
+  int ierr = MPI_Exscan(&n_bytes, &offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  // the result of MPI_Exscan is undefined on the first rank
+  if(rank == 0)
+    offset = 0;
+
+  MPI_File file;
+  ierr = MPI_File_open(
+    mpi_comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  AssertThrow(ierr == MPI_SUCCESS, dealii::ExcMessage("Could not open file " + filename + "."));
+
+  // discard the content of a file that might already exist
+  ierr = MPI_File_set_size(file, 0);
+  AssertThrowMPI(ierr);
+
+  ierr = MPI_File_write_at_all(
+    file, offset, chunk.data(), static_cast<int>(n_bytes), MPI_CHAR, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  MPI_File_close(&file);
+}
+
+} // namespace ExaDG
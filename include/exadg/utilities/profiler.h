@@ -0,0 +1,313 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_PROFILER_H_
+#define INCLUDE_EXADG_UTILITIES_PROFILER_H_
+
+// C/C++
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+
+namespace ExaDG
+{
+struct ProfilerParameters
+{
+  ProfilerParameters()
+  {
+  }
+
+  ProfilerParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    // clang-format off
+    prm.enter_subsection("Profiler");
+      prm.add_parameter("Enable",
+                        enable,
+                        "Measure wall times and call counts of profiler regions.",
+                        dealii::Patterns::Bool(),
+                        false);
+      prm.add_parameter("Trace",
+                        trace,
+                        "Record individual calls of profiler regions for Chrome trace export.",
+                        dealii::Patterns::Bool(),
+                        false);
+      prm.add_parameter("MaxTraceEvents",
+                        max_trace_events,
+                        "Maximum number of recorded calls per process.",
+                        dealii::Patterns::Integer(1),
+                        false);
+      prm.add_parameter("Directory",
+                        directory,
+                        "Directory of the JSON and Chrome trace files.",
+                        dealii::Patterns::Anything(),
+                        false);
+      prm.add_parameter("Filename",
+                        filename,
+                        "Name of the JSON and Chrome trace files (without extension).",
+                        dealii::Patterns::Anything(),
+                        false);
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+  bool enable = false;
+
+  bool trace = false;
+
+  // bounds the memory consumption of the trace for long simulations, further calls are not
+  // recorded in the trace but still in the accumulated wall times
+  unsigned int max_trace_events = 1000000;
+
+  std::string directory = "output/";
+
+  std::string filename = "profile";
+};
+
+/*
+ *  Hierarchical profiler with low overhead, intended to be used also on hot paths (e.g. in every
+ *  time step or on every multigrid level).
+ *
+ *  Regions are registered once by name and parent region, which returns an integer ID. Entering
+ *  and leaving a region via Profiler::Scope then costs O(1) without any string operations. For
+ *  each region, the accumulated wall time and the number of calls are recorded. Optionally, the
+ *  individual calls are recorded as well (trace) for the export in Chrome trace format, which
+ *  can be viewed e.g. in chrome://tracing or https://ui.perfetto.dev.
+ *
+ *  At the end of a simulation, the wall times are reduced over all processes (minimum, average,
+ *  maximum) in order to identify load imbalances. Regions are matched by name between processes,
+ *  i.e., processes may register regions in a different order or not at all.
+ *
+ *  There is one profiler per process, which is accessed via Profiler::instance(). The profiler is
+ *  disabled by default, in which case a Profiler::Scope only checks a boolean.
+ */
+class Profiler
+{
+public:
+  typedef unsigned int RegionID;
+
+  typedef std::chrono::steady_clock Clock;
+
+  // the root region, which serves as parent of top-level regions and is not measured itself
+  static RegionID const root = 0;
+
+  static Profiler &
+  instance();
+
+  /*
+   * RAII object measuring the wall time between its construction and destruction.
+   */
+  class Scope
+  {
+  public:
+    Scope(RegionID const region_in) : region(region_in), active(Profiler::instance().enabled)
+    {
+      if(active)
+        start = Clock::now();
+    }
+
+    ~Scope()
+    {
+      if(active)
+        Profiler::instance().add(region, start, Clock::now());
+    }
+
+    Scope(Scope const &) = delete;
+
+    Scope &
+    operator=(Scope const &) = delete;
+
+  private:
+    RegionID const region;
+
+    bool const active;
+
+    Clock::time_point start;
+  };
+
+  /*
+   * Sets up the profiler according to the parameters and resets all measurements. Has to be called
+   * by all processes of mpi_comm.
+   */
+  void
+  reinit(ProfilerParameters const & parameters, MPI_Comm const & mpi_comm);
+
+  bool
+  is_enabled() const;
+
+  /*
+   * Returns the ID of the region with the given name as child of the given parent region. The
+   * region is created when this function is called the first time with these arguments. This
+   * function involves string operations and should be called outside of hot paths, storing the ID.
+   */
+  RegionID
+  register_region(std::string const & name, RegionID const parent = root);
+
+  /*
+   * Creates a new region as child of the given parent region, also if a region with the given name
+   * exists already. In this case, a number is appended to the name ("name 2", "name 3", ...). This
+   * is intended for objects with several instances, whose measurements should not be merged.
+   */
+  RegionID
+  register_unique_region(std::string const & name, RegionID const parent = root);
+
+  /*
+   * Adds a call of a region with the given start and end times.
+   */
+  void
+  add(RegionID const region, Clock::time_point const start, Clock::time_point const end);
+
+  /*
+   * Adds a call of a region with a wall time measured elsewhere (not recorded in the trace).
+   */
+  void
+  add(RegionID const region, double const wall_time);
+
+  /*
+   * Resets the measured wall times, call counts, and the trace. Registered regions are kept. The
+   * processes of mpi_comm are synchronized, so that the times of the trace start at the same point
+   * in time on all processes. Has to be called by all processes of mpi_comm.
+   */
+  void
+  reset(MPI_Comm const & mpi_comm);
+
+  /*
+   * Prints the number of calls and the minimum, average, and maximum wall time over all processes
+   * of mpi_comm for all regions. Has to be called by all processes.
+   */
+  void
+  print_summary(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_comm) const;
+
+  /*
+   * Writes the statistics printed by print_summary() to a JSON file and, if the trace is enabled,
+   * the calls of all processes to a Chrome trace file, both in the directory and with the filename
+   * specified in the parameters. The trace is written by all processes in parallel using MPI-IO.
+   * Has to be called by all processes.
+   */
+  void
+  write_results(MPI_Comm const & mpi_comm) const;
+
+private:
+  Profiler();
+
+  struct Region
+  {
+    // name including the names of all parent regions, separated by '/'
+    std::string path;
+
+    std::string name;
+
+    unsigned int depth;
+
+    unsigned long long n_calls;
+
+    double wall_time;
+  };
+
+  struct Event
+  {
+    RegionID region;
+
+    // in microseconds since the last reset, which is synchronized between all processes
+    double start;
+    double duration;
+  };
+
+  // statistics of one region over all processes
+  struct Statistics
+  {
+    std::string path;
+
+    std::string name;
+
+    unsigned int depth;
+
+    double calls_avg;
+
+    dealii::Utilities::MPI::MinMaxAvg wall_time;
+  };
+
+  std::vector<Statistics>
+  compute_statistics(MPI_Comm const & mpi_comm) const;
+
+  void
+  write_json(std::string const & filename, std::vector<Statistics> const & statistics) const;
+
+  void
+  write_chrome_trace(std::string const & filename, MPI_Comm const & mpi_comm) const;
+
+  ProfilerParameters parameters;
+
+  bool enabled;
+
+  std::vector<Region> regions;
+
+  std::map<std::pair<RegionID, std::string>, RegionID> region_ids;
+
+  std::vector<Event> events;
+
+  unsigned long long n_dropped_events;
+
+  Clock::time_point reference_time;
+};
+
+inline void
+Profiler::add(RegionID const region, Clock::time_point const start, Clock::time_point const end)
+{
+  Region & data = regions[region];
+
+  double const wall_time = std::chrono::duration<double>(end - start).count();
+
+  data.n_calls += 1;
+  data.wall_time += wall_time;
+
+  if(parameters.trace)
+  {
+    if(events.size() < parameters.max_trace_events)
+    {
+      double const offset =
+        std::chrono::duration<double, std::micro>(start - reference_time).count();
+      events.push_back({region, offset, 1.e6 * wall_time});
+    }
+    else
+    {
+      ++n_dropped_events;
+    }
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_PROFILER_H_ */
@@ -122,7 +122,7 @@ struct ThroughputParameters
   }
 
   void
-  print_results(MPI_Comm const & mpi_comm)
+  print_results(MPI_Comm const & mpi_comm) const
   {
     print_throughput(wall_times, operator_type, mpi_comm);
   }
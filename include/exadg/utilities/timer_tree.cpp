@@ -44,17 +44,27 @@ TimerTree::clear()
 }
 
 void
-TimerTree::insert(std::vector<std::string> const ids, double const wall_time)
+TimerTree::insert(std::vector<std::string> const & ids, double const wall_time)
 {
   AssertThrow(ids.size() > 0, dealii::ExcMessage("empty name."));
 
+  do_insert(ids, 0, wall_time);
+}
+
+void
+TimerTree::do_insert(std::vector<std::string> const & ids,
+                     unsigned int const               first,
+                     double const                     wall_time)
+{
+  bool const is_leaf = (first + 1 == ids.size());
+
   if(this->id == "") // the tree is currently empty
   {
     AssertThrow(sub_trees.empty(), dealii::ExcMessage("invalid state found. aborting."));
 
-    this->id = ids[0];
+    this->id = ids[first];
 
-    if(ids.size() == 1) // leaves of tree reached, insert the data
+    if(is_leaf) // leaves of tree reached, insert the data
     {
       data = std::make_shared<Data>();
       data->wall_time += wall_time;
@@ -63,16 +73,14 @@ TimerTree::insert(std::vector<std::string> const ids, double const wall_time)
     }
     else // go deeper
     {
-      std::vector<std::string> remaining_id = erase_first(ids);
-
       std::shared_ptr<TimerTree> new_tree = std::make_shared<TimerTree>();
-      new_tree->insert(remaining_id, wall_time);
+      new_tree->do_insert(ids, first + 1, wall_time);
       sub_trees.push_back(new_tree);
     }
   }
-  else if(this->id == ids[0]) // the tree already has some entries
+  else if(this->id == ids[first]) // the tree already has some entries
   {
-    if(ids.size() == 1) // leaves of tree reached, insert the data
+    if(is_leaf) // leaves of tree reached, insert the data
     {
       if(data.get() == nullptr)
         data = std::make_shared<Data>();
@@ -83,24 +91,24 @@ TimerTree::insert(std::vector<std::string> const ids, double const wall_time)
     }
     else // find correct sub-tree or insert new sub-tree
     {
-      std::vector<std::string> remaining_id = erase_first(ids);
+      std::string const & remaining_id = ids[first + 1];
 
       bool found = false;
       for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
       {
         // find out where to insert item
-        if((*it)->id == remaining_id[0])
+        if((*it)->id == remaining_id)
         {
           found = true;
 
-          (*it)->insert(remaining_id, wall_time);
+          (*it)->do_insert(ids, first + 1, wall_time);
         }
       }
 
       if(found == false)
       {
         std::shared_ptr<TimerTree> new_tree = std::make_shared<TimerTree>();
-        new_tree->insert(remaining_id, wall_time);
+        new_tree->do_insert(ids, first + 1, wall_time);
         sub_trees.push_back(new_tree);
       }
     }
@@ -108,7 +116,7 @@ TimerTree::insert(std::vector<std::string> const ids, double const wall_time)
   else // the provided name does not fit to this tree
   {
     AssertThrow(false,
-                dealii::ExcMessage("The name provided is " + ids[0] + ", but must be " + id +
+                dealii::ExcMessage("The name provided is " + ids[first] + ", but must be " + id +
                                    " instead."));
   }
 }
@@ -162,17 +170,19 @@ TimerTree::insert(std::vector<std::string>   ids,
 }
 
 void
-TimerTree::print_plain(dealii::ConditionalOStream const & pcout) const
+TimerTree::print_plain(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_comm) const
 {
   unsigned int const length = get_length();
 
   pcout << std::endl;
 
-  do_print_plain(pcout, 0, length);
+  do_print_plain(pcout, mpi_comm, 0, length);
 }
 
 void
-TimerTree::print_level(dealii::ConditionalOStream const & pcout, unsigned int const level) const
+TimerTree::print_level(dealii::ConditionalOStream const & pcout,
+                       unsigned int const                 level,
+                       MPI_Comm const &                   mpi_comm) const
 {
   unsigned int const length = get_length();
 
@@ -182,7 +192,7 @@ TimerTree::print_level(dealii::ConditionalOStream const & pcout, unsigned int co
   {
     pcout << std::endl;
 
-    do_print_level(pcout, level, 0, length);
+    do_print_level(pcout, mpi_comm, level, 0, length);
   }
   else
   {
@@ -226,10 +236,10 @@ TimerTree::erase_first(std::vector<std::string> const & in) const
 }
 
 double
-TimerTree::get_average_wall_time() const
+TimerTree::get_average_wall_time(MPI_Comm const & mpi_comm) const
 {
   dealii::Utilities::MPI::MinMaxAvg time_data =
-    dealii::Utilities::MPI::min_max_avg(data->wall_time, MPI_COMM_WORLD);
+    dealii::Utilities::MPI::min_max_avg(data->wall_time, mpi_comm);
 
   return time_data.avg;
 }
@@ -249,22 +259,24 @@ TimerTree::get_length() const
 
 void
 TimerTree::do_print_plain(dealii::ConditionalOStream const & pcout,
+                          MPI_Comm const &                   mpi_comm,
                           unsigned int const                 offset,
                           unsigned int const                 length) const
 {
   if(id.empty())
     return;
 
-  print_own(pcout, offset, length);
+  print_own(pcout, mpi_comm, offset, length);
 
   for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
   {
-    (*it)->do_print_plain(pcout, offset + offset_per_level, length);
+    (*it)->do_print_plain(pcout, mpi_comm, offset + offset_per_level, length);
   }
 }
 
 void
 TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
+                          MPI_Comm const &                   mpi_comm,
                           unsigned int const                 level,
                           unsigned int const                 offset,
                           unsigned int const                 length) const
@@ -274,7 +286,7 @@ TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
 
   if(level == 0)
   {
-    print_own(pcout, offset, length);
+    print_own(pcout, mpi_comm, offset, length);
   }
   else if(level == 1)
   {
@@ -282,13 +294,14 @@ TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
     {
       if(data.get())
       {
-        print_own(pcout, offset, length, true, data->wall_time);
-        print_direct_children(pcout, offset + offset_per_level, length, true, data->wall_time);
+        print_own(pcout, mpi_comm, offset, length, true, data->wall_time);
+        print_direct_children(
+          pcout, mpi_comm, offset + offset_per_level, length, true, data->wall_time);
       }
       else
       {
         print_name(pcout, offset, length, true);
-        print_direct_children(pcout, offset + offset_per_level, length);
+        print_direct_children(pcout, mpi_comm, offset + offset_per_level, length);
       }
     }
   }
@@ -301,7 +314,7 @@ TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
     // the offset)
     for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
     {
-      (*it)->do_print_level(pcout, level - 1, offset + offset_per_level, length);
+      (*it)->do_print_level(pcout, mpi_comm, level - 1, offset + offset_per_level, length);
     }
   }
 }
@@ -320,6 +333,7 @@ TimerTree::print_name(dealii::ConditionalOStream const & pcout,
 
 void
 TimerTree::print_own(dealii::ConditionalOStream const & pcout,
+                     MPI_Comm const &                   mpi_comm,
                      unsigned int const                 offset,
                      unsigned int const                 length,
                      bool const                         relative,
@@ -329,7 +343,7 @@ TimerTree::print_own(dealii::ConditionalOStream const & pcout,
 
   if(data.get())
   {
-    double const time_avg = get_average_wall_time();
+    double const time_avg = get_average_wall_time(mpi_comm);
 
     pcout << std::setprecision(precision) << std::scientific << std::setw(10) << std::right
           << time_avg << " s";
@@ -337,7 +351,7 @@ TimerTree::print_own(dealii::ConditionalOStream const & pcout,
     if(relative)
     {
       dealii::Utilities::MPI::MinMaxAvg ref_time_data =
-        dealii::Utilities::MPI::min_max_avg(ref_time, MPI_COMM_WORLD);
+        dealii::Utilities::MPI::min_max_avg(ref_time, mpi_comm);
       double const ref_time_avg = ref_time_data.avg;
 
       pcout << std::setprecision(precision) << std::fixed << std::setw(10) << std::right
@@ -350,6 +364,7 @@ TimerTree::print_own(dealii::ConditionalOStream const & pcout,
 
 void
 TimerTree::print_direct_children(dealii::ConditionalOStream const & pcout,
+                                 MPI_Comm const &                   mpi_comm,
                                  unsigned int const                 offset,
                                  unsigned int const                 length,
                                  bool const                         relative,
@@ -377,12 +392,12 @@ TimerTree::print_direct_children(dealii::ConditionalOStream const & pcout,
     {
       if((*it)->data.get())
       {
-        (*it)->print_own(pcout, offset, length, relative, ref_time);
+        (*it)->print_own(pcout, mpi_comm, offset, length, relative, ref_time);
         other.data->wall_time -= (*it)->data->wall_time;
       }
     }
 
-    other.print_own(pcout, offset, length, relative, ref_time);
+    other.print_own(pcout, mpi_comm, offset, length, relative, ref_time);
   }
   else
   {
@@ -391,7 +406,7 @@ TimerTree::print_direct_children(dealii::ConditionalOStream const & pcout,
     // if-branch above, this is unproblematic since the item "Other"
     // will not be printed.
     for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
-      (*it)->print_own(pcout, offset, length, relative, ref_time);
+      (*it)->print_own(pcout, mpi_comm, offset, length, relative, ref_time);
   }
 }
 
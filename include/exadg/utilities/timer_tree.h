@@ -29,6 +29,7 @@
 
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
 
 namespace ExaDG
 {
@@ -54,7 +55,7 @@ public:
    * entry already existing in the tree.
    */
   void
-  insert(std::vector<std::string> const ids, double const wall_time);
+  insert(std::vector<std::string> const & ids, double const wall_time);
 
   /**
    * This function inserts a whole sub_tree into an existing tree, where
@@ -70,10 +71,12 @@ public:
 
   /**
    * Prints wall time of all items of a tree without an analysis of
-   * the relative share of the children.
+   * the relative share of the children. The wall times are averaged over
+   * the processes of mpi_comm, which all have to call this function.
    */
   void
-  print_plain(dealii::ConditionalOStream const & pcout) const;
+  print_plain(dealii::ConditionalOStream const & pcout,
+              MPI_Comm const &                   mpi_comm = MPI_COMM_WORLD) const;
 
   /**
    * This is the actual function of interest of this class, i.e., an
@@ -83,10 +86,13 @@ public:
    * case, an additional item `other` is created in order to give insights
    * to which extent the code has been covered with timers and to which
    * extend time is spent is other code paths that are currently not
-   * covered by timers.
+   * covered by timers. As for print_plain(), wall times are averaged over
+   * the processes of mpi_comm.
    */
   void
-  print_level(dealii::ConditionalOStream const & pcout, unsigned int const level) const;
+  print_level(dealii::ConditionalOStream const & pcout,
+              unsigned int const                 level,
+              MPI_Comm const &                   mpi_comm = MPI_COMM_WORLD) const;
 
   /**
    * Returns the maximum number of levels of the timer tree.
@@ -102,6 +108,13 @@ private:
   void
   copy_from(std::shared_ptr<TimerTree> other);
 
+  /**
+   * Implementation of insert() for the IDs starting at position first, which avoids copying the
+   * IDs when going deeper into the tree.
+   */
+  void
+  do_insert(std::vector<std::string> const & ids, unsigned int const first, double const wall_time);
+
   /**
    * This function erases the first entry of a vector of strings.
    */
@@ -113,7 +126,7 @@ private:
    * underlying data object.
    */
   double
-  get_average_wall_time() const;
+  get_average_wall_time(MPI_Comm const & mpi_comm) const;
 
   /**
    * This function returns the number of characters needed by the "longest"
@@ -129,6 +142,7 @@ private:
    */
   void
   do_print_plain(dealii::ConditionalOStream const & pcout,
+                 MPI_Comm const &                   mpi_comm,
                  unsigned int const                 offset,
                  unsigned int const                 length) const;
 
@@ -137,6 +151,7 @@ private:
    */
   void
   do_print_level(dealii::ConditionalOStream const & pcout,
+                 MPI_Comm const &                   mpi_comm,
                  unsigned int const                 level,
                  unsigned int const                 offset,
                  unsigned int const                 length) const;
@@ -160,6 +175,7 @@ private:
    */
   void
   print_own(dealii::ConditionalOStream const & pcout,
+            MPI_Comm const &                   mpi_comm,
             unsigned int const                 offset,
             unsigned int const                 length,
             bool const                         relative = false,
@@ -173,6 +189,7 @@ private:
    */
   void
   print_direct_children(dealii::ConditionalOStream const & pcout,
+                        MPI_Comm const &                   mpi_comm,
                         unsigned int const                 offset,
                         unsigned int const                 length,
                         bool const                         relative = false,
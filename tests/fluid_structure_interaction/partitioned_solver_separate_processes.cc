@@ -0,0 +1,165 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/acceleration_schemes/partitioned_solver.h>
+#include <exadg/fluid_structure_interaction/acceleration_schemes/separate_processes.h>
+
+/*
+ * The partitioned solver is created on all processes, also on processes that only solve the
+ * fluid and on which the communicator of the structure is MPI_COMM_NULL (as done by the FSI
+ * driver in case of separate processes for the structure).
+ *
+ * Afterwards, a scalar model problem is solved by partitioned iterations following the
+ * protocol of the FSI driver: The processes of the structure relax the displacement d and
+ * announce every iteration, while the processes of the fluid follow. Within an iteration, the
+ * displacement is sent to the fluid, which returns the load 1 - d (summed over the processes
+ * of the fluid), and the structure computes d_tilde = load / 2. The fixed point is d = 1/3.
+ */
+void
+test(unsigned int const n_processes_structure)
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0);
+
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(comm);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(comm);
+
+  bool const is_structure_process = (rank < n_processes_structure);
+
+  MPI_Comm sub_comm;
+  MPI_Comm_split(comm, is_structure_process ? 0 : 1, rank, &sub_comm);
+
+  MPI_Comm const comm_structure = is_structure_process ? sub_comm : MPI_COMM_NULL;
+
+  ExaDG::FSI::Parameters parameters;
+  parameters.n_processes_structure = n_processes_structure;
+
+  ExaDG::FSI::PartitionedSolver<2, double> partitioned_solver(parameters, comm_structure);
+
+  unsigned int const n_structure =
+    dealii::Utilities::MPI::sum(is_structure_process ? 1U : 0U, comm);
+
+  pcout << std::endl
+        << "Structure is solved on " << n_structure << " of " << n_processes << " processes."
+        << std::endl;
+
+  partitioned_solver.print_iterations(pcout);
+
+  unsigned int const n_processes_fluid = n_processes - n_processes_structure;
+
+  auto const coupled_iteration = [&](double & d_tilde, double const d) {
+    // structure to fluid
+    double const d_fluid = dealii::Utilities::MPI::broadcast(comm, d, 0);
+
+    // solve fluid
+    double load = 0.0;
+    if(not(is_structure_process))
+      load = dealii::Utilities::MPI::sum((1.0 - d_fluid) / n_processes_fluid, sub_comm);
+
+    // fluid to structure (the fluid processes are the last processes of comm)
+    load = dealii::Utilities::MPI::broadcast(comm, load, n_processes_structure);
+
+    // solve structure
+    d_tilde = 0.5 * load;
+  };
+
+  double       d = 0.0, d_tilde = 0.0;
+  unsigned int iterations_structure = 0, iterations_fluid = 0;
+
+  if(is_structure_process)
+  {
+    bool converged = false;
+    while(not(converged))
+    {
+      ExaDG::FSI::broadcast_next_iteration(comm, true);
+
+      coupled_iteration(d_tilde, d);
+
+      double const residual = d_tilde - d;
+      converged             = std::abs(residual) < 1.e-8;
+      if(not(converged))
+        d += 0.5 * residual;
+
+      ++iterations_structure;
+    }
+
+    ExaDG::FSI::broadcast_next_iteration(comm, false);
+  }
+  else
+  {
+    iterations_fluid = ExaDG::FSI::follow_partitioned_iterations(
+      comm, [&](unsigned int const) { coupled_iteration(d_tilde, d); });
+  }
+
+  pcout << "Partitioned iterations (structure/fluid): "
+        << dealii::Utilities::MPI::max(iterations_structure, comm) << "/"
+        << dealii::Utilities::MPI::max(iterations_fluid, comm) << std::endl
+        << "Displacement: " << d << std::endl;
+
+  MPI_Comm_free(&sub_comm);
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test(1);
+
+    test(2);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
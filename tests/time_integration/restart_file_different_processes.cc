@@ -0,0 +1,235 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/restart_file.h>
+
+using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+/*
+ * The value of a DoF only depends on the cell and the local DoF index, i.e., it does not depend
+ * on the parallel partitioning.
+ */
+template<int dim>
+double
+reference_value(typename dealii::DoFHandler<dim>::active_cell_iterator const & cell,
+                unsigned int const                                             i)
+{
+  dealii::Point<dim> const center = cell->center();
+
+  return center[0] + 10.0 * center[1] + 100.0 * i;
+}
+
+template<int dim>
+void
+setup(dealii::parallel::distributed::Triangulation<dim> & triangulation,
+      dealii::DoFHandler<dim> &                           dof_handler,
+      unsigned int const                                  degree)
+{
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  dof_handler.distribute_dofs(dealii::FE_DGQ<dim>(degree));
+}
+
+template<int dim>
+double
+compute_max_error(dealii::DoFHandler<dim> const & dof_handler,
+                  VectorType const &              vector,
+                  MPI_Comm const &                comm)
+{
+  double max_error = 0.0;
+
+  std::vector<dealii::types::global_dof_index> dof_indices(
+    dof_handler.get_fe().n_dofs_per_cell());
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      cell->get_dof_indices(dof_indices);
+      for(unsigned int i = 0; i < dof_indices.size(); ++i)
+        max_error = std::max(max_error,
+                             std::abs(vector(dof_indices[i]) - reference_value<dim>(cell, i)));
+    }
+  }
+
+  return dealii::Utilities::MPI::max(max_error, comm);
+}
+
+/*
+ * A restart file is written on the first n_processes_write processes and read on all
+ * processes.
+ */
+void
+test(unsigned int const n_processes_write, bool const compress)
+{
+  unsigned int const dim = 2;
+
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0);
+
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+  std::string const filename = "restart_file_" + std::to_string(n_processes_write);
+
+  bool const is_write_process = (rank < n_processes_write);
+
+  MPI_Comm sub_comm;
+  MPI_Comm_split(comm, is_write_process ? 0 : MPI_UNDEFINED, rank, &sub_comm);
+
+  std::uint64_t checksum_write = 0;
+  if(is_write_process)
+  {
+    dealii::parallel::distributed::Triangulation<dim> triangulation(sub_comm);
+    dealii::DoFHandler<dim>                           dof_handler(triangulation);
+    setup(triangulation, dof_handler, 1);
+
+    VectorType vector(dof_handler.locally_owned_dofs(), sub_comm);
+
+    std::vector<dealii::types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        cell->get_dof_indices(dof_indices);
+        for(unsigned int i = 0; i < dof_indices.size(); ++i)
+          vector(dof_indices[i]) = reference_value<dim>(cell, i);
+      }
+    }
+
+    checksum_write = ExaDG::compute_dof_numbering_checksum(dof_handler);
+
+    {
+      ExaDG::RestartFileWriter writer(filename, sub_comm, checksum_write, compress, false);
+      writer.write_preamble("preamble");
+      writer.write_vector(vector);
+    }
+
+    MPI_Comm_free(&sub_comm);
+  }
+
+  checksum_write = dealii::Utilities::MPI::broadcast(comm, checksum_write, 0);
+
+  // read the file on all processes
+  {
+    dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+    dealii::DoFHandler<dim>                           dof_handler(triangulation);
+    setup(triangulation, dof_handler, 1);
+
+    std::uint64_t const checksum_read = ExaDG::compute_dof_numbering_checksum(dof_handler);
+
+    VectorType vector(dof_handler.locally_owned_dofs(), comm);
+
+    ExaDG::RestartFileReader reader(filename, comm, checksum_read);
+
+    std::string const preamble = reader.read_preamble();
+
+    reader.read_vector(vector);
+
+    pcout << std::endl
+          << "Written on " << n_processes_write << " and read on "
+          << dealii::Utilities::MPI::n_mpi_processes(comm)
+          << " processes (compressed: " << (compress ? "true" : "false") << "):" << std::endl
+          << "  Preamble:        " << preamble << std::endl
+          << "  Same checksum:   " << (checksum_read == checksum_write ? "true" : "false")
+          << std::endl
+          << "  Max error:       " << compute_max_error(dof_handler, vector, comm) << std::endl;
+  }
+
+  // a different numbering of the unknowns is detected when reading the file
+  {
+    dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+    dealii::DoFHandler<dim>                           dof_handler(triangulation);
+    setup(triangulation, dof_handler, 2);
+
+    bool detected = false;
+    try
+    {
+      ExaDG::RestartFileReader reader(filename,
+                                      comm,
+                                      ExaDG::compute_dof_numbering_checksum(dof_handler));
+    }
+    catch(std::exception const &)
+    {
+      detected = true;
+    }
+
+    pcout << "  Different numbering detected: " << (detected ? "true" : "false") << std::endl;
+  }
+
+  if(rank == 0)
+    std::remove(filename.c_str());
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test(1, false);
+
+    test(2, true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}